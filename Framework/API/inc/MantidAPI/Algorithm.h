@@ -307,6 +307,9 @@ public:
 
   void copyNonWorkspaceProperties(IAlgorithm *alg, int periodNum);
 
+  void executeGroupMembers(
+      const std::vector<boost::shared_ptr<Algorithm>> &algorithms);
+
   const Parallel::Communicator &communicator() const;
   void setCommunicator(const Parallel::Communicator &communicator);
 
@@ -324,6 +327,11 @@ protected:
   virtual Parallel::ExecutionMode getParallelExecutionMode(
       const std::map<std::string, Parallel::StorageMode> &storageModes) const;
 
+  /// Returns true if the members of a group may be processed concurrently.
+  /// Override if the algorithm only touches its own input and output
+  /// workspaces.
+  virtual bool canProcessGroupsInParallel() const { return false; }
+
   /// Returns a semi-colon separated list of workspace types to attach this
   /// algorithm
   virtual const std::string workspaceMethodOnTypes() const { return ""; }
@@ -374,7 +382,7 @@ protected:
 
   friend class WorkspaceHistory; // Allow workspace history loading to adjust
                                  // g_execCount
-  static size_t
+  static std::atomic<size_t>
       g_execCount; ///< Counter to keep track of algorithm execution order
 
   virtual void setOtherProperties(IAlgorithm *alg,
@@ -424,6 +432,7 @@ private:
   bool executeAsyncImpl(const Poco::Void &i);
 
   bool doCallProcessGroups(Mantid::Types::Core::DateAndTime &start_time);
+  void executeGroupMember(Algorithm &alg, const size_t entry);
 
   // Report that the algorithm has completed.
   void reportCompleted(const double &duration,
@@ -467,6 +476,9 @@ private:
   mutable double m_endChildProgress;   ///< Keeps value for algorithm's progress
                                        /// at Child Algorithm's finish
   AlgorithmID m_algorithmID;           ///< Algorithm ID for managed algorithms
+  /// Execution count reserved by a parent processing a group in parallel. 0
+  /// if the count is taken when the algorithm is executed
+  size_t m_reservedExecCount = 0;
   std::vector<boost::weak_ptr<IAlgorithm>> m_ChildAlgorithms; ///< A list of
                                                               /// weak pointers
                                                               /// to any child
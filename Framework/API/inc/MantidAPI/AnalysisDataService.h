@@ -11,6 +11,9 @@
 
 #include <Poco/AutoPtr.h>
 
+#include <atomic>
+#include <mutex>
+
 namespace Mantid {
 
 namespace API {
@@ -30,6 +33,12 @@ class WorkspaceGroup;
 
     This is the manager/owner of Workspace* when registered.
 
+    The memory used by the stored workspaces may be bounded. Above the limit
+    the least recently used workspaces that nothing else holds, not even a
+    weak handle such as a Python variable, are saved to the spill directory
+    and replaced by placeholders that are reloaded when they are retrieved.
+    Creating a workspace that would still exceed the limit throws.
+
     @author Russell Taylor, Tessella Support Services plc
     @date 01/10/2007
     @author L C Chapon, ISIS, Rutherford Appleton Laboratory
@@ -124,6 +133,8 @@ public:
   virtual void rename(const std::string &oldName, const std::string &newName);
   /// Overridden remove member to delete its name held by the workspace itself
   virtual void remove(const std::string &name);
+  /// Retrieve a workspace, reloading it if it was spilled to disk
+  Workspace_sptr retrieve(const std::string &name);
 
   /** Retrieve a workspace and cast it to the given WSTYPE
    *
@@ -132,11 +143,10 @@ public:
    * @return a shared pointer of WSTYPE
    */
   template <typename WSTYPE>
-  boost::shared_ptr<WSTYPE> retrieveWS(const std::string &name) const {
+  boost::shared_ptr<WSTYPE> retrieveWS(const std::string &name) {
     // Get as a bare workspace
     try {
-      boost::shared_ptr<Mantid::API::Workspace> workspace =
-          Kernel::DataService<API::Workspace>::retrieve(name);
+      boost::shared_ptr<Mantid::API::Workspace> workspace = retrieve(name);
       // Cast to the desired type and return that.
       return boost::dynamic_pointer_cast<WSTYPE>(workspace);
 
@@ -160,9 +170,27 @@ public:
   std::map<std::string, Workspace_sptr> topLevelItems() const;
   void shutdown() override;
 
+  /** @name Methods to bound the memory used by workspaces */
+  //@{
+  /// The memory used by the stored workspaces in bytes
+  size_t memoryUsage() const;
+  /// The memory limit in bytes, 0 if unlimited
+  size_t memoryLimit() const { return m_memoryLimit.load(); }
+  void setMemoryLimit(const size_t bytes);
+  std::string spillDirectory() const;
+  void setSpillDirectory(const std::string &directory);
+  /// Returns true if the workspace is currently spilled to disk
+  bool isSpilled(const std::string &name) const;
+  //@}
+
 private:
   /// Checks the name is valid, throwing if not
   void verifyName(const std::string &name);
+  void markUsed(const std::string &name) const;
+  void reserveMemory(const std::string &name, const Workspace_sptr &workspace);
+  size_t spillUntil(const size_t target, const std::string &keep);
+  bool spill(const std::string &name, const Workspace_sptr &workspace);
+  Workspace_sptr restore(const std::string &name);
 
   friend struct Mantid::Kernel::CreateUsingNew<AnalysisDataServiceImpl>;
   /// Constructor
@@ -176,6 +204,17 @@ private:
 
   /// The string of illegal characters
   std::string m_illegalChars;
+  /// Bytes the workspaces may use before they are spilled, 0 for no limit
+  std::atomic<size_t> m_memoryLimit;
+  /// Directory for spilled workspaces, empty to disable spilling
+  std::string m_spillDirectory;
+  /// Serializes spilling and reloading
+  mutable std::recursive_mutex m_spillMutex;
+  /// Guards the usage record
+  mutable std::mutex m_usageMutex;
+  /// The last use of each workspace, counted in uses of the service
+  mutable std::map<std::string, size_t, Kernel::CaseInsensitiveCmp> m_lastUse;
+  mutable size_t m_useCount;
 };
 
 typedef Mantid::Kernel::SingletonHolder<AnalysisDataServiceImpl>
@@ -0,0 +1,84 @@
+#ifndef MANTID_API_AUTODIFFFUNCTION1D_H_
+#define MANTID_API_AUTODIFFFUNCTION1D_H_
+
+#include "MantidAPI/DualNumber.h"
+#include "MantidAPI/IFunction1D.h"
+#include "MantidAPI/Jacobian.h"
+#include "MantidAPI/ParamFunction.h"
+
+#include <array>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+
+/** AutoDiffFunction1D : Base class for 1D functions of N parameters whose
+  derivatives are calculated by forward-mode automatic differentiation.
+
+  A concrete function derives from AutoDiffFunction1D<Function, N>, declares
+  its N parameters in init() and implements the formula once as a public
+  member template
+
+  template <typename T>
+  T evaluate(const double x, const std::array<T, N> &parameters) const;
+
+  function1D() calls it with doubles. functionDeriv1D() calls it with
+  DualNumber<N> parameters and fills a whole row of the Jacobian from one
+  evaluation, instead of the nParams() + 1 evaluations of the whole function
+  made by the numerical derivative.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+template <class Function, size_t N>
+class AutoDiffFunction1D : public ParamFunction, public IFunction1D {
+public:
+  void function1D(double *out, const double *xValues,
+                  const size_t nData) const override {
+    std::array<double, N> parameters;
+    for (size_t i = 0; i < N; ++i)
+      parameters[i] = getParameter(i);
+    const auto &function = static_cast<const Function &>(*this);
+    for (size_t i = 0; i < nData; ++i)
+      out[i] = function.evaluate(xValues[i], parameters);
+  }
+
+  void functionDeriv1D(Jacobian *out, const double *xValues,
+                       const size_t nData) override {
+    if (nParams() != N)
+      throw std::logic_error(name() + " declares a different number of "
+                                      "parameters than it differentiates.");
+    std::array<DualNumber<N>, N> parameters;
+    for (size_t i = 0; i < N; ++i)
+      parameters[i] = DualNumber<N>::variable(getParameter(i), i);
+    const auto &function = static_cast<const Function &>(*this);
+    for (size_t i = 0; i < nData; ++i) {
+      const auto y = function.evaluate(xValues[i], parameters);
+      for (size_t j = 0; j < N; ++j)
+        out->set(i, j, y.derivative(j));
+    }
+  }
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_AUTODIFFFUNCTION1D_H_ */
@@ -0,0 +1,122 @@
+#ifndef MANTID_API_COMPILEDEXPRESSION_H_
+#define MANTID_API_COMPILEDEXPRESSION_H_
+
+#include "MantidAPI/DllConfig.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Expression;
+
+/** CompiledExpression : A muParser expression compiled for evaluation over
+  arrays of points.
+
+  The expression is compiled into a list of instructions each of which is
+  applied to a chunk of points at a time, so the cost of interpreting the
+  expression is paid once per chunk rather than once per point, and the
+  arithmetic runs in simple loops that the compiler can vectorize. Parts of
+  the expression that do not depend on the arguments, e.g. combinations of
+  fit parameters, are calculated once per call, and constant parts once at
+  compilation.
+
+  The names in the expression are either arguments, which take a different
+  value at every point, or variables, which are read through a pointer at
+  every call. The constants _pi and _e and the muParser functions of one
+  argument, erf, erfc, min and max are supported. Constructs that are not
+  supported, e.g. comparisons, make the constructor throw
+  std::invalid_argument; callers should fall back to mu::Parser.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_API_DLL CompiledExpression {
+public:
+  CompiledExpression(const std::string &formula,
+                     const std::vector<std::string> &arguments,
+                     const std::map<std::string, const double *> &variables);
+
+  void evaluate(const double *values, double *out, const size_t n) const;
+  void evaluate(const std::vector<const double *> &values, double *out,
+                const size_t n) const;
+  /// True if the value depends on the arguments
+  bool dependsOnArguments() const { return m_result.isVector; }
+
+private:
+  enum class OpCode {
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Power,
+    Square,
+    Negate,
+    Minimum,
+    Maximum,
+    Call
+  };
+  /// A register holding a chunk of points or a scalar slot
+  struct Operand {
+    bool isVector;
+    size_t index;
+  };
+  struct Instruction {
+    OpCode code;
+    Operand result;
+    Operand lhs;
+    Operand rhs;
+    double (*function)(double);
+  };
+
+  Operand compile(const Expression &expr,
+                  const std::map<std::string, const double *> &variables);
+  Operand emit(const OpCode code, const Operand &lhs, const Operand &rhs,
+               double (*function)(double) = nullptr);
+  Operand addConstant(const double value);
+  static double apply(const Instruction &instruction, const double lhs,
+                      const double rhs);
+  void execute(const Instruction &instruction,
+               const std::vector<const double *> &registers, double *result,
+               const std::vector<double> &scalars, const size_t n) const;
+
+  /// The names of the arguments, one vector register each
+  std::vector<std::string> m_arguments;
+  /// Initial values of the scalar slots
+  std::vector<double> m_scalars;
+  /// Which scalar slots are known at compilation
+  std::vector<bool> m_isConstant;
+  /// Scalar slots read from variables at every call
+  std::vector<std::pair<size_t, const double *>> m_loads;
+  /// Instructions run once per call
+  std::vector<Instruction> m_scalarProgram;
+  /// Instructions run for every chunk of points
+  std::vector<Instruction> m_vectorProgram;
+  /// The number of vector registers, including the arguments
+  size_t m_nRegisters;
+  Operand m_result;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_COMPILEDEXPRESSION_H_ */
@@ -0,0 +1,270 @@
+#ifndef MANTID_API_DUALNUMBER_H_
+#define MANTID_API_DUALNUMBER_H_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace Mantid {
+namespace API {
+
+/** DualNumber : A value together with its partial derivatives with respect
+  to N independent variables, for forward-mode automatic differentiation.
+
+  Arithmetic on dual numbers applies the chain rule to the derivatives, so
+  evaluating an expression once with DualNumber arguments yields its value
+  and its gradient with no truncation error. The elementary functions are
+  found by argument-dependent lookup; code templated on the number type
+  should bring the std ones into scope with e.g. "using std::exp;" so that it
+  compiles for both double and DualNumber. Comparisons compare the values
+  only.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+template <size_t N> class DualNumber {
+public:
+  /// Create a constant, i.e. a number with zero derivatives
+  DualNumber(const double value = 0.0) : m_value(value), m_derivatives() {}
+  /// Create the independent variable number index with the given value
+  static DualNumber variable(const double value, const size_t index) {
+    DualNumber number(value);
+    number.m_derivatives[index] = 1.0;
+    return number;
+  }
+
+  /// The value
+  double value() const { return m_value; }
+  /// The partial derivative with respect to variable index
+  double derivative(const size_t index) const {
+    return m_derivatives[index];
+  }
+
+  /// Return a number with this value and the derivatives scaled by factor
+  DualNumber chain(const double value, const double factor) const {
+    DualNumber result(value);
+    for (size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] = factor * m_derivatives[i];
+    return result;
+  }
+
+  DualNumber operator-() const { return chain(-m_value, -1.0); }
+
+  DualNumber &operator+=(const DualNumber &other) {
+    m_value += other.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] += other.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator-=(const DualNumber &other) {
+    m_value -= other.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] -= other.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator*=(const DualNumber &other) {
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] = m_derivatives[i] * other.m_value +
+                         m_value * other.m_derivatives[i];
+    m_value *= other.m_value;
+    return *this;
+  }
+  DualNumber &operator/=(const DualNumber &other) {
+    const double inverse = 1.0 / other.m_value;
+    m_value *= inverse;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] =
+          (m_derivatives[i] - m_value * other.m_derivatives[i]) * inverse;
+    return *this;
+  }
+  DualNumber &operator+=(const double other) {
+    m_value += other;
+    return *this;
+  }
+  DualNumber &operator-=(const double other) {
+    m_value -= other;
+    return *this;
+  }
+  DualNumber &operator*=(const double other) {
+    *this = chain(m_value * other, other);
+    return *this;
+  }
+  DualNumber &operator/=(const double other) { return *this *= 1.0 / other; }
+
+private:
+  double m_value;
+  std::array<double, N> m_derivatives;
+
+  template <size_t M>
+  friend DualNumber<M> pow(const DualNumber<M> &base,
+                           const DualNumber<M> &exponent);
+};
+
+template <size_t N>
+DualNumber<N> operator+(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs += rhs;
+}
+template <size_t N>
+DualNumber<N> operator-(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs -= rhs;
+}
+template <size_t N>
+DualNumber<N> operator*(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs *= rhs;
+}
+template <size_t N>
+DualNumber<N> operator/(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs /= rhs;
+}
+template <size_t N>
+DualNumber<N> operator+(DualNumber<N> lhs, const double rhs) {
+  return lhs += rhs;
+}
+template <size_t N>
+DualNumber<N> operator-(DualNumber<N> lhs, const double rhs) {
+  return lhs -= rhs;
+}
+template <size_t N>
+DualNumber<N> operator*(DualNumber<N> lhs, const double rhs) {
+  return lhs *= rhs;
+}
+template <size_t N>
+DualNumber<N> operator/(DualNumber<N> lhs, const double rhs) {
+  return lhs /= rhs;
+}
+template <size_t N>
+DualNumber<N> operator+(const double lhs, DualNumber<N> rhs) {
+  return rhs += lhs;
+}
+template <size_t N>
+DualNumber<N> operator-(const double lhs, const DualNumber<N> &rhs) {
+  return -rhs + lhs;
+}
+template <size_t N>
+DualNumber<N> operator*(const double lhs, DualNumber<N> rhs) {
+  return rhs *= lhs;
+}
+template <size_t N>
+DualNumber<N> operator/(const double lhs, const DualNumber<N> &rhs) {
+  const double value = lhs / rhs.value();
+  return rhs.chain(value, -value / rhs.value());
+}
+
+template <size_t N>
+bool operator<(const DualNumber<N> &lhs, const DualNumber<N> &rhs) {
+  return lhs.value() < rhs.value();
+}
+template <size_t N>
+bool operator>(const DualNumber<N> &lhs, const DualNumber<N> &rhs) {
+  return lhs.value() > rhs.value();
+}
+template <size_t N> bool operator<(const DualNumber<N> &lhs, const double rhs) {
+  return lhs.value() < rhs;
+}
+template <size_t N> bool operator>(const DualNumber<N> &lhs, const double rhs) {
+  return lhs.value() > rhs;
+}
+template <size_t N> bool operator<(const double lhs, const DualNumber<N> &rhs) {
+  return lhs < rhs.value();
+}
+template <size_t N> bool operator>(const double lhs, const DualNumber<N> &rhs) {
+  return lhs > rhs.value();
+}
+
+template <size_t N> DualNumber<N> exp(const DualNumber<N> &x) {
+  const double value = std::exp(x.value());
+  return x.chain(value, value);
+}
+template <size_t N> DualNumber<N> log(const DualNumber<N> &x) {
+  return x.chain(std::log(x.value()), 1.0 / x.value());
+}
+template <size_t N> DualNumber<N> sqrt(const DualNumber<N> &x) {
+  const double value = std::sqrt(x.value());
+  return x.chain(value, 0.5 / value);
+}
+template <size_t N> DualNumber<N> sin(const DualNumber<N> &x) {
+  return x.chain(std::sin(x.value()), std::cos(x.value()));
+}
+template <size_t N> DualNumber<N> cos(const DualNumber<N> &x) {
+  return x.chain(std::cos(x.value()), -std::sin(x.value()));
+}
+template <size_t N> DualNumber<N> tan(const DualNumber<N> &x) {
+  const double value = std::tan(x.value());
+  return x.chain(value, 1.0 + value * value);
+}
+template <size_t N> DualNumber<N> atan(const DualNumber<N> &x) {
+  return x.chain(std::atan(x.value()), 1.0 / (1.0 + x.value() * x.value()));
+}
+template <size_t N> DualNumber<N> fabs(const DualNumber<N> &x) {
+  return x.chain(std::fabs(x.value()), x.value() < 0.0 ? -1.0 : 1.0);
+}
+template <size_t N> DualNumber<N> erf(const DualNumber<N> &x) {
+  return x.chain(std::erf(x.value()),
+                 2.0 / std::sqrt(M_PI) * std::exp(-x.value() * x.value()));
+}
+template <size_t N> DualNumber<N> erfc(const DualNumber<N> &x) {
+  return x.chain(std::erfc(x.value()),
+                 -2.0 / std::sqrt(M_PI) * std::exp(-x.value() * x.value()));
+}
+
+/// Raise a dual number to a constant power
+template <size_t N>
+DualNumber<N> pow(const DualNumber<N> &base, const double exponent) {
+  if (exponent == 2.0)
+    return base.chain(base.value() * base.value(), 2.0 * base.value());
+  const double value = std::pow(base.value(), exponent);
+  return base.chain(value, exponent * std::pow(base.value(), exponent - 1.0));
+}
+
+/// Raise a constant to a dual number power
+template <size_t N>
+DualNumber<N> pow(const double base, const DualNumber<N> &exponent) {
+  const double value = std::pow(base, exponent.value());
+  // The limit of the derivative of 0^y for y > 0 is 0
+  return exponent.chain(value, value == 0.0 ? 0.0 : value * std::log(base));
+}
+
+/** Raise a dual number to a dual number power. Where the base is zero only
+ * the derivatives that are finite in the limit are kept.
+ */
+template <size_t N>
+DualNumber<N> pow(const DualNumber<N> &base, const DualNumber<N> &exponent) {
+  const double value = std::pow(base.value(), exponent.value());
+  DualNumber<N> result(value);
+  const double baseFactor =
+      exponent.value() * std::pow(base.value(), exponent.value() - 1.0);
+  const double exponentFactor =
+      value == 0.0 ? 0.0 : value * std::log(base.value());
+  for (size_t i = 0; i < N; ++i) {
+    double derivative = 0.0;
+    if (base.m_derivatives[i] != 0.0)
+      derivative += baseFactor * base.m_derivatives[i];
+    if (exponent.m_derivatives[i] != 0.0)
+      derivative += exponentFactor * exponent.m_derivatives[i];
+    result.m_derivatives[i] = derivative;
+  }
+  return result;
+}
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_DUALNUMBER_H_ */
@@ -48,6 +48,10 @@ extern const MANTID_API_DLL std::map<std::string, oneVarFun>
 
 void MANTID_API_DLL extraOneVarFunctions(mu::Parser &parser);
 
+/// Differentiate a muParser expression symbolically.
+std::string MANTID_API_DLL differentiate(const std::string &formula,
+                                         const std::string &variable);
+
 } // namespace MuParserUtils
 } // namespace API
 } // namespace Mantid
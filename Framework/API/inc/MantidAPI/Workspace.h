@@ -7,6 +7,8 @@
 #include "MantidKernel/Exception.h"
 #include "MantidParallel/StorageMode.h"
 
+#include <atomic>
+
 namespace Mantid {
 
 namespace Kernel {
@@ -101,6 +103,14 @@ public:
 
   Parallel::StorageMode storageMode() const;
 
+  /// Count a handle that refers to the workspace without keeping it alive,
+  /// such as a Python variable
+  void addWeakHandle() const { ++m_weakHandles; }
+  /// Stop counting a handle added with addWeakHandle
+  void removeWeakHandle() const { --m_weakHandles; }
+  /// Returns true while handles that do not own the workspace refer to it
+  bool hasWeakHandles() const { return m_weakHandles.load() > 0; }
+
 protected:
   /// Protected copy constructor. May be used by childs for cloning.
   Workspace(const Workspace &);
@@ -119,6 +129,8 @@ private:
   std::unique_ptr<WorkspaceHistory> m_history;
   /// Storage mode of the Workspace (used for MPI runs)
   Parallel::StorageMode m_storageMode;
+  /// The number of live handles that do not own the workspace
+  mutable std::atomic<size_t> m_weakHandles{0};
 
   /// Virtual clone method. Not implemented to force implementation in children.
   virtual Workspace *doClone() const = 0;
@@ -7,7 +7,9 @@
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidKernel/EnvironmentHistory.h"
 #include <ctime>
+#include <mutex>
 #include <set>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // Forward declarations
@@ -24,6 +26,13 @@ class HistoryView;
 /** This class stores information about the Workspace History used by algorithms
   on a workspace and the environment history.
 
+  The algorithm histories are held in a graph of immutable nodes which are
+  shared between the histories of workspaces derived from one another, so
+  copying a history or appending to it does not copy the earlier entries.
+  The graph is merged into a single set of histories when the entries are
+  read, which is kept until the history changes, and whenever it becomes
+  deeper than a fixed limit.
+
   @author Dickon Champion, ISIS, RAL
   @date 21/01/2008
 
@@ -58,8 +67,8 @@ public:
   WorkspaceHistory(const WorkspaceHistory &);
   /// Deleted copy assignment operator
   WorkspaceHistory &operator=(const WorkspaceHistory &) = delete;
-  /// Retrieve the algorithm history list
-  const AlgorithmHistories &getAlgorithmHistories() const;
+  /// Retrieve a copy of the algorithm history list
+  AlgorithmHistories getAlgorithmHistories() const;
   /// Retrieve the environment history
   const Kernel::EnvironmentHistory &getEnvironmentHistory() const;
   /// Append an workspace history to this one
@@ -100,10 +109,31 @@ private:
   AlgorithmHistory_sptr parseAlgorithmHistory(const std::string &rawData);
   /// Find the history entries at this level in the file.
   std::set<int> findHistoryEntries(::NeXus::File *file);
+
+  struct Node;
+  typedef boost::shared_ptr<Node> Node_sptr;
+  /// Return the head of the graph with the lock held
+  Node_sptr head() const;
+  /// Return a node holding all the histories of the graph
+  Node_sptr mergedHead() const;
+  /// Return the node to extend, with the lock held
+  Node_sptr currentNode() const;
+  /// Replace the head of the graph
+  void setHead(Node_sptr node);
+  /// Add a node extending the given parents
+  void extend(AlgorithmHistory_sptr algorithm, std::vector<Node_sptr> parents);
+  /// Merge the graph ending at a node into a single node
+  static Node_sptr merge(const Node_sptr &head);
+
   /// The environment of the workspace
   const Kernel::EnvironmentHistory m_environment;
-  /// The algorithms which have been called on the workspace
-  Mantid::API::AlgorithmHistories m_algorithms;
+  /// The last node of the graph of algorithms which have been called on the
+  /// workspace, null if there are none
+  Node_sptr m_head;
+  /// The merged graph ending at m_head, built when the histories are read
+  mutable Node_sptr m_merged;
+  /// Protects m_head and m_merged
+  mutable std::mutex m_mutex;
 };
 
 MANTID_API_DLL std::ostream &operator<<(std::ostream &,
@@ -13,6 +13,7 @@
 
 namespace Mantid {
 namespace Geometry {
+class DetectorNeighbourIndex;
 class Instrument;
 class IDetector;
 }
@@ -32,6 +33,11 @@ class SpectrumInfo;
  * ANN is available from <http://www.cs.umd.edu/~mount/ANN/> and is released
  * under the GNU LGPL.
  *
+ * If a Geometry::DetectorNeighbourIndex is given and every spectrum maps to a
+ * single, distinct detector, the searches run on that index instead, which is
+ * built once per instrument and shared between workspaces. Radius searches
+ * then query the index directly rather than rebuilding the graph.
+ *
  * Known potential issue: boost's graph has an issue that may cause compilation
  * errors in some circumstances in the current version of boost used by
  * Mantid (1.43) based on tr1::tie. This issue is fixed in later versions
@@ -61,9 +67,12 @@ class SpectrumInfo;
  */
 class MANTID_API_DLL WorkspaceNearestNeighbours {
 public:
-  WorkspaceNearestNeighbours(int nNeighbours, const SpectrumInfo &spectrumInfo,
-                             std::vector<specnum_t> spectrumNumbers,
-                             bool ignoreMaskedDetectors = false);
+  WorkspaceNearestNeighbours(
+      int nNeighbours, const SpectrumInfo &spectrumInfo,
+      std::vector<specnum_t> spectrumNumbers,
+      bool ignoreMaskedDetectors = false,
+      boost::shared_ptr<const Geometry::DetectorNeighbourIndex> detectorIndex =
+          nullptr);
 
   // Neighbouring spectra by radius
   std::map<specnum_t, Mantid::Kernel::V3D>
@@ -94,6 +103,10 @@ private:
   /// Construct the graph based on the given number of neighbours and the
   /// current instument and spectra-detector mapping
   void build(const int noNeighbours);
+  /// Map the given spectra to detector indices of m_detectorIndex if possible
+  bool mapToDetectorIndex(const std::vector<size_t> &indices);
+  /// Fill the graph using m_detectorIndex
+  void buildFromDetectorIndex();
   /// Query the graph for the default number of nearest neighbours to specified
   /// detector
   std::map<specnum_t, Mantid::Kernel::V3D>
@@ -116,6 +129,18 @@ private:
   mutable double m_radius;
   /// Flag indicating that masked detectors should be ignored
   bool m_bIgnoreMaskedDetectors;
+  /// Optional shared spatial index over the detectors of the instrument
+  boost::shared_ptr<const Geometry::DetectorNeighbourIndex> m_detectorIndex;
+  /// True if the graph was built from m_detectorIndex
+  bool m_useDetectorIndex;
+  /// Detector index of each spectrum in the graph, in build order
+  std::vector<size_t> m_indexedDetectors;
+  /// Spectrum number of each detector in m_indexedDetectors
+  std::unordered_map<size_t, specnum_t> m_detectorToSpectrum;
+  /// Detector index of each spectrum number in the graph
+  std::unordered_map<specnum_t, size_t> m_spectrumToDetector;
+  /// Flags for the detectors of m_detectorIndex that are not in the graph
+  std::vector<bool> m_excludedDetectors;
 };
 
 } // namespace API
@@ -4,6 +4,7 @@
 #include "MantidAPI/AlgorithmProxy.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
+#include "MantidAPI/FileProperty.h"
 #include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidAPI/WorkspaceHistory.h"
@@ -14,6 +15,7 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/TraceService.h"
 #include "MantidKernel/UsageService.h"
 
 #include "MantidParallel/Communicator.h"
@@ -24,6 +26,8 @@
 #include <MantidKernel/StringTokenizer.h>
 #include <Poco/ActiveMethod.h>
 #include <Poco/ActiveResult.h>
+#include <Poco/Exception.h>
+#include <Poco/File.h>
 #include <Poco/NotificationCenter.h>
 #include <Poco/RWLock.h>
 #include <Poco/Void.h>
@@ -57,6 +61,67 @@ public:
 private:
   const std::string &m_value;
 };
+
+/**
+ * Check that algorithms can be executed in any order: no workspace written by
+ * one of them is read or written by another.
+ * @param algorithms :: The configured algorithms
+ * @return true if the algorithms use independent workspaces
+ */
+bool haveIndependentWorkspaces(
+    const std::vector<boost::shared_ptr<Algorithm>> &algorithms) {
+  // Workspace names are case insensitive in the ADS
+  std::map<std::string, size_t, CaseInsensitiveCmp> writers;
+  std::vector<std::pair<std::string, size_t>> reads;
+  for (size_t i = 0; i < algorithms.size(); ++i) {
+    for (const auto prop : algorithms[i]->getProperties()) {
+      if (!dynamic_cast<IWorkspaceProperty *>(prop) || prop->value().empty())
+        continue;
+      if (prop->direction() != Direction::Input) {
+        if (!writers.emplace(prop->value(), i).second)
+          return false;
+      }
+      if (prop->direction() != Direction::Output)
+        reads.emplace_back(prop->value(), i);
+    }
+  }
+  return std::none_of(reads.cbegin(), reads.cend(),
+                      [&writers](const std::pair<std::string, size_t> &read) {
+                        const auto writer = writers.find(read.first);
+                        return writer != writers.end() &&
+                               writer->second != read.second;
+                      });
+}
+
+/**
+ * Attach the sizes of the files loaded and saved by an algorithm to its span
+ * @param properties :: The properties of the algorithm
+ * @param span :: The span of the execution
+ */
+void addFileSizes(const std::vector<Property *> &properties,
+                  TraceSpan &span) {
+  double bytesRead(0.0), bytesWritten(0.0);
+  for (const auto prop : properties) {
+    const auto fileProp = dynamic_cast<FileProperty *>(prop);
+    if (!fileProp || fileProp->value().empty())
+      continue;
+    try {
+      Poco::File file(fileProp->value());
+      if (!file.exists() || !file.isFile())
+        continue;
+      if (fileProp->isLoadProperty())
+        bytesRead += static_cast<double>(file.getSize());
+      else if (fileProp->isSaveProperty())
+        bytesWritten += static_cast<double>(file.getSize());
+    } catch (Poco::Exception &) {
+      // The size is informational only
+    }
+  }
+  if (bytesRead > 0.0)
+    span.addArgument("bytes_read", bytesRead);
+  if (bytesWritten > 0.0)
+    span.addArgument("bytes_written", bytesWritten);
+}
 } // namespace
 
 // Doxygen can't handle member specialization at the moment:
@@ -83,7 +148,7 @@ template MANTID_API_DLL bool Algorithm::isEmpty<std::size_t>(const std::size_t);
 //=============================================================================================
 
 /// Initialize static algorithm counter
-size_t Algorithm::g_execCount = 0;
+std::atomic<size_t> Algorithm::g_execCount{0};
 
 /// Constructor
 Algorithm::Algorithm()
@@ -527,7 +592,8 @@ bool Algorithm::execute() {
     // If history is being recorded we need to count this as a separate
     // algorithm
     // as the history compares histories by their execution number
-    ++Algorithm::g_execCount;
+    if (m_reservedExecCount == 0)
+      ++Algorithm::g_execCount;
 
     // populate history record before execution so we can record child
     // algorithms in it
@@ -555,8 +621,13 @@ bool Algorithm::execute() {
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
       // Start a timer
       Timer timer;
+      TraceSpan span(name(), isChild() ? "Child algorithm" : "Algorithm");
       // Call the concrete algorithm's exec method
       this->exec(getExecutionMode());
+      if (span.isRecording()) {
+        span.addArgument("version", version());
+        addFileSizes(getProperties(), span);
+      }
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
@@ -565,8 +636,10 @@ bool Algorithm::execute() {
       // need it to throw before trying to run fillhistory() on an algorithm
       // which has failed
       if (trackingHistory() && m_history) {
-        m_history->fillAlgorithmHistory(this, startTime, duration,
-                                        Algorithm::g_execCount);
+        const size_t execCount = m_reservedExecCount > 0
+                                     ? m_reservedExecCount
+                                     : Algorithm::g_execCount.load();
+        m_history->fillAlgorithmHistory(this, startTime, duration, execCount);
         fillHistory();
         linkHistoryWithLastChild();
       }
@@ -1221,6 +1294,7 @@ bool Algorithm::doCallProcessGroups(
 
   bool completed = false;
   try {
+    TraceSpan span(name(), "Group algorithm");
     // Call the concrete algorithm's processGroups method
     completed = processGroups();
   } catch (std::exception &ex) {
@@ -1269,7 +1343,7 @@ bool Algorithm::doCallProcessGroups(
  *
  * This should be called after checkGroups(), which sets up required members.
  * It goes through each member of the group(s), creates and sets an algorithm
- * for each and executes them one by one.
+ * for each and executes them with executeGroupMembers().
  *
  * If there are several group input workspaces, then the member of each group
  * is executed pair-wise.
@@ -1294,6 +1368,9 @@ bool Algorithm::processGroups() {
   }
 
   double progress_proportion = 1.0 / static_cast<double>(m_groupSize);
+  std::vector<Algorithm_sptr> algorithms;
+  algorithms.reserve(m_groupSize);
+  std::vector<std::vector<std::string>> outputWSNames(m_groupSize);
   // Go through each entry in the input group(s)
   for (size_t entry = 0; entry < m_groupSize; entry++) {
     // use create Child Algorithm that look like this one
@@ -1342,7 +1419,7 @@ bool Algorithm::processGroups() {
       } // not an empty (i.e. optional) input
     }   // for each InputWorkspace property
 
-    std::vector<std::string> outputWSNames(m_pureOutputWorkspaceProps.size());
+    outputWSNames[entry].resize(m_pureOutputWorkspaceProps.size());
     // ---------- Set all the output workspaces ----------------------------
     for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
       if (Property *prop =
@@ -1376,33 +1453,28 @@ bool Algorithm::processGroups() {
         // Set in the output
         alg->setPropertyValue(prop->name(), outName);
 
-        outputWSNames[owp] = outName;
+        outputWSNames[entry][owp] = outName;
       } else {
         throw std::logic_error(
             "Found a Workspace property which doesn't inherit from Property.");
       }
     } // for each OutputWorkspace property
 
-    // ------------ Execute the algo --------------
-    try {
-      alg->execute();
-    } catch (std::exception &e) {
-      std::ostringstream msg;
-      msg << "Execution of " << this->name() << " for group entry "
-          << (entry + 1) << " failed: ";
-      msg << e.what(); // Add original message
-      throw std::runtime_error(msg.str());
-    }
+    algorithms.push_back(alg_sptr);
+  } // for each entry in each group
+
+  // ------------ Execute the algos --------------
+  executeGroupMembers(algorithms);
 
-    // ------------ Fill in the output workspace group ------------------
-    // this has to be done after execute() because a workspace must exist
-    // when it is added to a group
+  // ------------ Fill in the output workspace groups ------------------
+  // this has to be done after execute() because a workspace must exist
+  // when it is added to a group
+  for (size_t entry = 0; entry < m_groupSize; entry++) {
     for (size_t owp = 0; owp < m_pureOutputWorkspaceProps.size(); owp++) {
       // And add it to the output group
-      outGroups[owp]->add(outputWSNames[owp]);
+      outGroups[owp]->add(outputWSNames[entry][owp]);
     }
-
-  } // for each entry in each group
+  }
 
   // restore group notifications
   for (auto &outGroup : outGroups) {
@@ -1412,6 +1484,90 @@ bool Algorithm::processGroups() {
   return true;
 }
 
+//--------------------------------------------------------------------------------------------
+/** Execute the algorithms created for each entry of the input group(s).
+ *
+ * They are executed one by one unless this algorithm allows concurrent
+ * processing of groups, there are enough entries to occupy every thread and
+ * the entries use independent workspaces. When executed concurrently the
+ * OpenMP loops inside each algorithm run on a single thread and the history
+ * execution counts are reserved in entry order, so the histories do not
+ * depend on which entry finishes first.
+ *
+ * @param algorithms :: The configured algorithms, one for each entry
+ * @throw std::runtime_error if the execution of any entry fails
+ */
+void Algorithm::executeGroupMembers(
+    const std::vector<boost::shared_ptr<Algorithm>> &algorithms) {
+  const size_t nEntries = algorithms.size();
+  const double progress_proportion = 1.0 / static_cast<double>(nEntries);
+  const bool inParallel =
+      canProcessGroupsInParallel() && nEntries > 1 &&
+      nEntries >= static_cast<size_t>(PARALLEL_GET_MAX_THREADS) &&
+      haveIndependentWorkspaces(algorithms);
+
+  if (!inParallel) {
+    for (size_t entry = 0; entry < nEntries; ++entry) {
+      m_startChildProgress = progress_proportion * static_cast<double>(entry);
+      m_endChildProgress = m_startChildProgress + progress_proportion;
+      executeGroupMember(*algorithms[entry], entry);
+    }
+    return;
+  }
+
+  // Progress is reported here as each entry completes
+  const size_t firstExecCount = g_execCount.fetch_add(nEntries);
+  for (size_t entry = 0; entry < nEntries; ++entry) {
+    algorithms[entry]->removeObserver(this->progressObserver());
+    algorithms[entry]->m_reservedExecCount = firstExecCount + entry + 1;
+  }
+
+  std::vector<std::string> errors(nEntries);
+  size_t completed = 0;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int entry = 0; entry < static_cast<int>(nEntries); ++entry) {
+    try {
+      executeGroupMember(*algorithms[entry], static_cast<size_t>(entry));
+    } catch (std::exception &ex) {
+      errors[entry] = ex.what();
+    } catch (...) {
+      errors[entry] = "Execution of " + this->name() + " for group entry " +
+                      Strings::toString(entry + 1) + " failed.";
+    }
+    PARALLEL_CRITICAL(Algorithm_GroupMemberCompleted) {
+      ++completed;
+      progress(progress_proportion * static_cast<double>(completed));
+    }
+  }
+
+  // Report the first entry that failed
+  for (const auto &error : errors) {
+    if (!error.empty())
+      throw std::runtime_error(error);
+  }
+}
+
+/** Execute the algorithm for one entry of the input group(s)
+ *
+ * @param alg :: The configured algorithm
+ * @param entry :: The index of the entry in the group(s)
+ * @throw std::runtime_error if the execution fails
+ */
+void Algorithm::executeGroupMember(Algorithm &alg, const size_t entry) {
+  std::ostringstream msg;
+  msg << "Execution of " << this->name() << " for group entry " << (entry + 1)
+      << " failed";
+  try {
+    if (alg.execute())
+      return;
+  } catch (std::exception &e) {
+    msg << ": " << e.what(); // Add original message
+    throw std::runtime_error(msg.str());
+  }
+  msg << ".";
+  throw std::runtime_error(msg.str());
+}
+
 //--------------------------------------------------------------------------------------------
 /** Copy all the non-workspace properties from this to alg
  *
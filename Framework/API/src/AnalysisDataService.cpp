@@ -1,9 +1,77 @@
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Memory.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/Process.h>
+
+#include <set>
 #include <sstream>
 
 namespace Mantid {
 namespace API {
+namespace {
+/// Logger for spilling workspaces
+Kernel::Logger g_spillLog("AnalysisDataService");
+/// Algorithms that save and reload spilled workspaces
+const std::string SPILL_SAVER("SaveNexusProcessed");
+const std::string SPILL_LOADER("LoadNexusProcessed");
+/// Faster algorithms for the workspace types they support
+const std::string SNAPSHOT_SAVER("SaveWorkspaceSnapshot");
+const std::string SNAPSHOT_LOADER("LoadWorkspaceSnapshot");
+
+/** Stands in the service for a workspace that was saved to disk to free its
+ * memory. The file is deleted with the placeholder.
+ */
+class SpilledWorkspace : public Workspace {
+public:
+  SpilledWorkspace(const std::string &filename, const std::string &loader,
+                   const size_t size)
+      : Workspace(), m_filename(filename), m_loader(loader), m_size(size) {}
+  ~SpilledWorkspace() override {
+    try {
+      Poco::File(m_filename).remove();
+    } catch (Poco::Exception &) {
+      // The file may already be gone
+    }
+  }
+  const std::string id() const override { return "SpilledWorkspace"; }
+  const std::string toString() const override {
+    return "Saved to " + m_filename +
+           " to free memory. It is reloaded when it is retrieved.\n";
+  }
+  size_t getMemorySize() const override { return 0; }
+  /// The file holding the workspace
+  const std::string &filename() const { return m_filename; }
+  /// The algorithm that reloads the file
+  const std::string &loader() const { return m_loader; }
+  /// The memory used by the workspace before it was spilled
+  size_t spilledSize() const { return m_size; }
+
+private:
+  Workspace *doClone() const override {
+    throw std::runtime_error("A spilled workspace cannot be cloned");
+  }
+  Workspace *doCloneEmpty() const override {
+    throw std::runtime_error("A spilled workspace cannot be cloned");
+  }
+
+  const std::string m_filename;
+  const std::string m_loader;
+  const size_t m_size;
+};
+
+/// @returns the given number of bytes in sensible units
+std::string bytesToString(const size_t bytes) {
+  return Kernel::memToString(bytes / 1024);
+}
+} // namespace
 
 //-------------------------------------------------------------------------
 // Nested class methods
@@ -62,15 +130,18 @@ AnalysisDataServiceImpl::isValid(const std::string &name) const {
  * members which are not in the ADS yet.
  * @param name The name of the object
  * @param workspace The shared pointer to the workspace to store
+ * @throw std::runtime_error if the workspace does not fit in the memory limit
  */
 void AnalysisDataServiceImpl::add(
     const std::string &name,
     const boost::shared_ptr<API::Workspace> &workspace) {
   verifyName(name);
+  reserveMemory(name, workspace);
   // Attach the name to the workspace
   if (workspace)
     workspace->setName(name);
   Kernel::DataService<API::Workspace>::add(name, workspace);
+  markUsed(name);
 
   // if a group is added add its members as well
   auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(workspace);
@@ -100,16 +171,19 @@ void AnalysisDataServiceImpl::add(
  * replaces its members.
   * @param name The name of the object
   * @param workspace The shared pointer to the workspace to store
+  * @throw std::runtime_error if the workspace does not fit in the memory limit
   */
 void AnalysisDataServiceImpl::addOrReplace(
     const std::string &name,
     const boost::shared_ptr<API::Workspace> &workspace) {
   verifyName(name);
+  reserveMemory(name, workspace);
 
   // Attach the name to the workspace
   if (workspace)
     workspace->setName(name);
   Kernel::DataService<API::Workspace>::addOrReplace(name, workspace);
+  markUsed(name);
 
   // if a group is added add its members as well
   auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(workspace);
@@ -142,8 +216,9 @@ void AnalysisDataServiceImpl::rename(const std::string &oldName,
                                      const std::string &newName) {
   Kernel::DataService<API::Workspace>::rename(oldName, newName);
   // Attach the new name to the workspace
-  auto ws = retrieve(newName);
+  auto ws = Kernel::DataService<API::Workspace>::retrieve(newName);
   ws->setName(newName);
+  markUsed(newName);
 }
 
 /**
@@ -154,7 +229,8 @@ void AnalysisDataServiceImpl::rename(const std::string &oldName,
 void AnalysisDataServiceImpl::remove(const std::string &name) {
   Workspace_sptr ws;
   try {
-    ws = retrieve(name);
+    // A spilled workspace is not reloaded just to be removed
+    ws = Kernel::DataService<API::Workspace>::retrieve(name);
   } catch (const Kernel::Exception::NotFoundError &) {
     // do nothing - remove will do what's needed
   }
@@ -162,6 +238,25 @@ void AnalysisDataServiceImpl::remove(const std::string &name) {
   if (ws) {
     ws->setName("");
   }
+  std::lock_guard<std::mutex> lock(m_usageMutex);
+  m_lastUse.erase(name);
+}
+
+/**
+ * Retrieve a workspace. A workspace that was spilled to disk is reloaded and
+ * stored again.
+ * @param name :: The name of the workspace
+ * @return The workspace
+ * @throw NotFoundError if the workspace does not exist, or if it was spilled
+ * to disk and cannot be reloaded. A workspace that cannot be reloaded stays
+ * spilled.
+ */
+Workspace_sptr AnalysisDataServiceImpl::retrieve(const std::string &name) {
+  auto workspace = Kernel::DataService<API::Workspace>::retrieve(name);
+  if (boost::dynamic_pointer_cast<SpilledWorkspace>(workspace))
+    workspace = restore(name);
+  markUsed(name);
+  return workspace;
 }
 
 /**
@@ -254,7 +349,8 @@ AnalysisDataServiceImpl::topLevelItems() const {
   for (const auto &topLevelName : topLevelNames) {
     try {
       const std::string &name = topLevelName;
-      auto ws = this->retrieve(topLevelName);
+      // Spilled workspaces are listed without reloading them
+      auto ws = Kernel::DataService<API::Workspace>::retrieve(topLevelName);
       topLevel.emplace(name, ws);
       if (auto group = boost::dynamic_pointer_cast<WorkspaceGroup>(ws)) {
         group->reportMembers(groupMembers);
@@ -278,6 +374,71 @@ AnalysisDataServiceImpl::topLevelItems() const {
 
 void AnalysisDataServiceImpl::shutdown() { clear(); }
 
+/**
+ * The memory used by the stored workspaces. Workspaces stored under several
+ * names and the members of groups are counted once.
+ * @return The memory used in bytes
+ */
+size_t AnalysisDataServiceImpl::memoryUsage() const {
+  std::set<const Workspace *> counted;
+  size_t usage(0);
+  for (const auto &name : getObjectNames(Kernel::DataServiceSort::Unsorted,
+                                         Kernel::DataServiceHidden::Include)) {
+    Workspace_sptr ws;
+    try {
+      ws = Kernel::DataService<API::Workspace>::retrieve(name);
+    } catch (Kernel::Exception::NotFoundError &) {
+      continue;
+    }
+    // The members of a group are stored separately
+    if (boost::dynamic_pointer_cast<WorkspaceGroup>(ws))
+      continue;
+    if (counted.insert(ws.get()).second)
+      usage += ws->getMemorySize();
+  }
+  return usage;
+}
+
+/**
+ * Set the memory the stored workspaces may use. Workspaces are spilled to
+ * disk if they use more.
+ * @param bytes :: The limit in bytes, 0 for no limit
+ */
+void AnalysisDataServiceImpl::setMemoryLimit(const size_t bytes) {
+  m_memoryLimit = bytes;
+  if (bytes > 0)
+    spillUntil(bytes, "");
+}
+
+/// @returns the directory for spilled workspaces, empty if disabled
+std::string AnalysisDataServiceImpl::spillDirectory() const {
+  std::lock_guard<std::recursive_mutex> lock(m_spillMutex);
+  return m_spillDirectory;
+}
+
+/**
+ * Set the directory that workspaces are spilled to when the memory limit is
+ * exceeded
+ * @param directory :: The directory, empty to disable spilling
+ */
+void AnalysisDataServiceImpl::setSpillDirectory(const std::string &directory) {
+  std::lock_guard<std::recursive_mutex> lock(m_spillMutex);
+  m_spillDirectory = directory;
+}
+
+/**
+ * @param name :: The name of a workspace
+ * @return true if the workspace is stored and currently spilled to disk
+ */
+bool AnalysisDataServiceImpl::isSpilled(const std::string &name) const {
+  try {
+    return static_cast<bool>(boost::dynamic_pointer_cast<SpilledWorkspace>(
+        Kernel::DataService<API::Workspace>::retrieve(name)));
+  } catch (Kernel::Exception::NotFoundError &) {
+    return false;
+  }
+}
+
 //-------------------------------------------------------------------------
 // Private methods
 //-------------------------------------------------------------------------
@@ -288,7 +449,14 @@ void AnalysisDataServiceImpl::shutdown() { clear(); }
 AnalysisDataServiceImpl::AnalysisDataServiceImpl()
     : Mantid::Kernel::DataService<Mantid::API::Workspace>(
           "AnalysisDataService"),
-      m_illegalChars() {}
+      m_illegalChars(), m_memoryLimit(0), m_useCount(0) {
+  auto &config = Kernel::ConfigService::Instance();
+  double limitInMB(0.0);
+  if (config.getValue("memory.workspaces.limit", limitInMB) == 1 &&
+      limitInMB > 0.0)
+    m_memoryLimit = static_cast<size_t>(limitInMB * 1024. * 1024.);
+  m_spillDirectory = config.getString("memory.workspaces.spilldirectory");
+}
 
 // The following is commented using /// rather than /** to stop the compiler
 // complaining
@@ -324,5 +492,241 @@ void AnalysisDataServiceImpl::verifyName(const std::string &name) {
   }
 }
 
+/**
+ * Record a use of a workspace to find the least recently used ones. Nothing
+ * is recorded if there is no memory limit.
+ * @param name :: The name of the workspace
+ */
+void AnalysisDataServiceImpl::markUsed(const std::string &name) const {
+  if (m_memoryLimit.load() == 0)
+    return;
+  std::lock_guard<std::mutex> lock(m_usageMutex);
+  m_lastUse[name] = ++m_useCount;
+}
+
+/**
+ * Make room for a workspace that is about to be stored by spilling the least
+ * recently used workspaces to disk. Does nothing if there is no memory limit.
+ * @param name :: The name the workspace will be stored under
+ * @param workspace :: The workspace to store
+ * @throw std::runtime_error if the stored workspaces would exceed the memory
+ * limit
+ */
+void AnalysisDataServiceImpl::reserveMemory(const std::string &name,
+                                            const Workspace_sptr &workspace) {
+  const size_t limit = m_memoryLimit.load();
+  // The members of a group are stored and checked separately
+  if (limit == 0 || !workspace ||
+      boost::dynamic_pointer_cast<WorkspaceGroup>(workspace))
+    return;
+  std::lock_guard<std::recursive_mutex> lock(m_spillMutex);
+  // A workspace that is already stored uses no more memory, and the
+  // workspace it replaces is freed
+  size_t replaced(0);
+  for (const auto &storedName :
+       getObjectNames(Kernel::DataServiceSort::Unsorted,
+                      Kernel::DataServiceHidden::Include)) {
+    Workspace_sptr stored;
+    try {
+      stored = Kernel::DataService<API::Workspace>::retrieve(storedName);
+    } catch (Kernel::Exception::NotFoundError &) {
+      continue;
+    }
+    if (stored == workspace)
+      return;
+    if (boost::iequals(storedName, name))
+      replaced = stored->getMemorySize();
+  }
+
+  const size_t bytes = workspace->getMemorySize();
+  const size_t available = limit + replaced;
+  const size_t usage =
+      spillUntil(bytes < available ? available - bytes : 0, name);
+  if (usage + bytes > available) {
+    std::ostringstream error;
+    error << "Storing " << name << " of " << bytesToString(bytes)
+          << " would exceed the workspace memory limit of "
+          << bytesToString(limit) << ". Stored workspaces use "
+          << bytesToString(usage - replaced)
+          << " that cannot be spilled to disk. Remove some workspaces or "
+             "raise memory.workspaces.limit.";
+    throw std::runtime_error(error.str());
+  }
+}
+
+/**
+ * Spill the least recently used workspaces to disk until the stored
+ * workspaces use no more than the given memory. Only workspaces that nothing
+ * outside the service holds or has a live weak handle to are spilled, and groups
+ * are never spilled.
+ * @param target :: The memory the workspaces may use in bytes
+ * @param keep :: The name of a workspace that must not be spilled
+ * @return The memory used by the workspaces afterwards
+ */
+size_t AnalysisDataServiceImpl::spillUntil(const size_t target,
+                                           const std::string &keep) {
+  std::lock_guard<std::recursive_mutex> lock(m_spillMutex);
+  size_t usage = memoryUsage();
+  if (usage <= target || m_spillDirectory.empty())
+    return usage;
+
+  std::vector<std::pair<size_t, std::string>> candidates;
+  {
+    std::lock_guard<std::mutex> usageLock(m_usageMutex);
+    for (auto &name : getObjectNames(Kernel::DataServiceSort::Unsorted,
+                                     Kernel::DataServiceHidden::Include)) {
+      if (boost::iequals(name, keep))
+        continue;
+      const auto lastUse = m_lastUse.find(name);
+      candidates.emplace_back(
+          lastUse != m_lastUse.end() ? lastUse->second : 0, std::move(name));
+    }
+  }
+  // Least recently used first
+  std::sort(candidates.begin(), candidates.end());
+
+  for (const auto &candidate : candidates) {
+    if (usage <= target)
+      break;
+    Workspace_sptr ws;
+    try {
+      ws = Kernel::DataService<API::Workspace>::retrieve(candidate.second);
+    } catch (Kernel::Exception::NotFoundError &) {
+      continue;
+    }
+    // Live weak handles, e.g. Python variables from mtd['name'], would be
+    // invalidated when the workspace is freed
+    if (boost::dynamic_pointer_cast<SpilledWorkspace>(ws) ||
+        boost::dynamic_pointer_cast<WorkspaceGroup>(ws) ||
+        ws->hasWeakHandles())
+      continue;
+    const size_t size = ws->getMemorySize();
+    if (spill(candidate.second, ws))
+      usage -= std::min(usage, size);
+  }
+  return usage;
+}
+
+/**
+ * Save a workspace to the spill directory and store a placeholder instead.
+ * The memory is freed when the caller releases the workspace.
+ * @param name :: The name of the workspace
+ * @param workspace :: The stored workspace
+ * @return true if the workspace was spilled
+ */
+bool AnalysisDataServiceImpl::spill(const std::string &name,
+                                    const Workspace_sptr &workspace) {
+  static std::atomic<size_t> spillCount{0};
+  // Histogram workspaces are written as snapshots, which are much quicker to
+  // save and reload than NeXus. The snapshot saver fails for workspaces with
+  // parts it cannot hold, such as a sample shape, and NeXus is used instead.
+  bool snapshot = workspace->id() == "Workspace2D";
+  Poco::Path path(m_spillDirectory);
+  path.makeDirectory();
+  const std::string stem = "mantid_spill_" +
+                           std::to_string(Poco::Process::id()) + "_" +
+                           std::to_string(++spillCount);
+  std::string filename;
+  while (true) {
+    path.setFileName(stem + (snapshot ? ".snapshot" : ".nxs"));
+    filename = path.toString();
+    try {
+      Poco::File(m_spillDirectory).createDirectories();
+      auto saver = AlgorithmManager::Instance().createUnmanaged(
+          snapshot ? SNAPSHOT_SAVER : SPILL_SAVER);
+      saver->initialize();
+      saver->setChild(true);
+      saver->setLogging(false);
+      saver->setProperty("InputWorkspace", workspace);
+      saver->setPropertyValue("Filename", filename);
+      if (snapshot)
+        saver->setProperty("SkipUnsupported", false);
+      saver->execute();
+      break;
+    } catch (std::exception &ex) {
+      try {
+        Poco::File(filename).remove();
+      } catch (Poco::Exception &) {
+      }
+      if (snapshot) {
+        snapshot = false;
+        continue;
+      }
+      g_spillLog.warning() << "Unable to spill " << name
+                           << " to disk: " << ex.what() << '\n';
+      return false;
+    }
+  }
+
+  // The placeholder deletes the file if it is not stored
+  auto placeholder = boost::make_shared<SpilledWorkspace>(
+      filename, snapshot ? SNAPSHOT_LOADER : SPILL_LOADER,
+      workspace->getMemorySize());
+  placeholder->setTitle(workspace->getTitle());
+  placeholder->setName(name);
+  if (!replaceQuietly(name, workspace, placeholder, true))
+    return false;
+  g_spillLog.information() << "Spilled " << name << " to " << filename
+                           << " to free "
+                           << bytesToString(placeholder->spilledSize())
+                           << ".\n";
+  return true;
+}
+
+/**
+ * Reload a spilled workspace and store it instead of its placeholder. Other
+ * workspaces are spilled first to make room for it if the memory limit
+ * requires it.
+ * @param name :: The name of the workspace
+ * @return The reloaded workspace
+ * @throw NotFoundError if the workspace cannot be reloaded. The placeholder
+ * and its file are kept.
+ */
+Workspace_sptr AnalysisDataServiceImpl::restore(const std::string &name) {
+  std::lock_guard<std::recursive_mutex> lock(m_spillMutex);
+  // Another thread may have reloaded it already
+  auto current = Kernel::DataService<API::Workspace>::retrieve(name);
+  auto spilled = boost::dynamic_pointer_cast<SpilledWorkspace>(current);
+  if (!spilled)
+    return current;
+
+  // Unlike a new workspace, a reloaded one is never refused
+  const size_t limit = m_memoryLimit.load();
+  const size_t size = spilled->spilledSize();
+  if (limit > 0) {
+    const size_t usage = spillUntil(size < limit ? limit - size : 0, name);
+    if (usage + size > limit)
+      g_spillLog.warning() << "Reloading " << name
+                           << " takes the workspaces over the limit of "
+                           << bytesToString(limit) << ".\n";
+  }
+
+  Workspace_sptr workspace;
+  try {
+    auto loader =
+        AlgorithmManager::Instance().createUnmanaged(spilled->loader());
+    loader->initialize();
+    loader->setChild(true);
+    loader->setLogging(false);
+    loader->setPropertyValue("Filename", spilled->filename());
+    loader->setPropertyValue("OutputWorkspace", name);
+    if (loader->execute())
+      workspace = loader->getProperty("OutputWorkspace");
+    if (!workspace)
+      throw std::runtime_error(spilled->loader() + " did not succeed");
+  } catch (std::exception &ex) {
+    g_spillLog.error() << "Unable to reload " << name << " from "
+                       << spilled->filename() << ": " << ex.what() << '\n';
+    throw Kernel::Exception::NotFoundError(
+        "Spilled workspace could not be reloaded from " + spilled->filename(),
+        name);
+  }
+  workspace->setName(name);
+  replaceQuietly(name, current, workspace, false);
+  g_spillLog.information() << "Reloaded " << name << " from "
+                           << spilled->filename() << ".\n";
+  return workspace;
+}
+
 } // Namespace API
 } // Namespace Mantid
@@ -0,0 +1,369 @@
+#include "MantidAPI/CompiledExpression.h"
+#include "MantidAPI/Expression.h"
+#include "MantidAPI/MuParserUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+
+namespace {
+/// The number of points each instruction is applied to at a time
+const size_t CHUNK_SIZE = 256;
+
+typedef double (*Function)(double);
+
+double sign(double x) { return x < 0.0 ? -1.0 : (x > 0.0 ? 1.0 : 0.0); }
+double rint(double x) { return std::floor(x + 0.5); }
+
+/// Find what log means to muParser: versions differ between log10 and ln.
+Function muParserLog() {
+  mu::Parser parser;
+  parser.SetExpr("log(10)");
+  if (parser.Eval() == 1.0)
+    return [](double x) { return std::log10(x); };
+  return [](double x) { return std::log(x); };
+}
+
+/// The functions of one argument known to muParser and MuParserUtils
+Function findFunction(const std::string &name) {
+  static const std::map<std::string, Function> functions{
+      {"sin", [](double x) { return std::sin(x); }},
+      {"cos", [](double x) { return std::cos(x); }},
+      {"tan", [](double x) { return std::tan(x); }},
+      {"asin", [](double x) { return std::asin(x); }},
+      {"acos", [](double x) { return std::acos(x); }},
+      {"atan", [](double x) { return std::atan(x); }},
+      {"sinh", [](double x) { return std::sinh(x); }},
+      {"cosh", [](double x) { return std::cosh(x); }},
+      {"tanh", [](double x) { return std::tanh(x); }},
+      {"asinh", [](double x) { return std::asinh(x); }},
+      {"acosh", [](double x) { return std::acosh(x); }},
+      {"atanh", [](double x) { return std::atanh(x); }},
+      {"log2", [](double x) { return std::log2(x); }},
+      {"log10", [](double x) { return std::log10(x); }},
+      {"log", muParserLog()},
+      {"ln", [](double x) { return std::log(x); }},
+      {"exp", [](double x) { return std::exp(x); }},
+      {"sqrt", [](double x) { return std::sqrt(x); }},
+      {"sign", sign},
+      {"rint", rint},
+      {"abs", [](double x) { return std::fabs(x); }},
+      {"erf", [](double x) { return std::erf(x); }},
+      {"erfc", [](double x) { return std::erfc(x); }}};
+  const auto function = functions.find(name);
+  return function == functions.end() ? nullptr : function->second;
+}
+
+/// Check if a string is a number and return its value
+bool isNumber(const std::string &str, double &number) {
+  char *end = nullptr;
+  number = std::strtod(str.c_str(), &end);
+  return !str.empty() && end == str.c_str() + str.size();
+}
+
+bool isUnary(const Expression &expr) {
+  return expr.size() == 1 && (expr.name() == "-" || expr.name() == "+");
+}
+
+[[noreturn]] void unsupported(const Expression &expr) {
+  throw std::invalid_argument("Cannot compile " + expr.str());
+}
+} // namespace
+
+/** Constructor
+ * @param formula :: An expression in the muParser syntax
+ * @param arguments :: The names that take a value per point
+ * @param variables :: The names that take a value per call and the addresses
+ * of the values. They are read at every call to evaluate().
+ * @throw std::invalid_argument if the formula cannot be compiled
+ */
+CompiledExpression::CompiledExpression(
+    const std::string &formula, const std::vector<std::string> &arguments,
+    const std::map<std::string, const double *> &variables)
+    : m_arguments(arguments), m_nRegisters(arguments.size()),
+      m_result{false, 0} {
+  Expression expr;
+  try {
+    expr.parse(formula);
+  } catch (Expression::ParsingError &e) {
+    throw std::invalid_argument(e.what());
+  }
+  m_result = compile(expr, variables);
+}
+
+/** Evaluate the expression with every argument taking the same values.
+ * @param values :: The values of the arguments, n of them
+ * @param out :: The results, n of them. Can be the same array as values.
+ * @param n :: The number of points
+ */
+void CompiledExpression::evaluate(const double *values, double *out,
+                                  const size_t n) const {
+  evaluate(std::vector<const double *>(m_arguments.size(), values), out, n);
+}
+
+/** Evaluate the expression. Safe to call concurrently.
+ * @param values :: An array of n values for each argument
+ * @param out :: The results, n of them. Can be one of the arrays of values.
+ * @param n :: The number of points
+ */
+void CompiledExpression::evaluate(const std::vector<const double *> &values,
+                                  double *out, const size_t n) const {
+  if (values.size() != m_arguments.size())
+    throw std::invalid_argument("CompiledExpression: expected values for " +
+                                std::to_string(m_arguments.size()) +
+                                " arguments.");
+  auto scalars = m_scalars;
+  for (const auto &load : m_loads)
+    scalars[load.first] = *load.second;
+  for (const auto &instruction : m_scalarProgram)
+    scalars[instruction.result.index] =
+        apply(instruction, scalars[instruction.lhs.index],
+              scalars[instruction.rhs.index]);
+  if (!m_result.isVector) {
+    std::fill_n(out, n, scalars[m_result.index]);
+    return;
+  }
+
+  const size_t nArguments = m_arguments.size();
+  const size_t chunk = std::min(n, CHUNK_SIZE);
+  std::vector<double> buffer((m_nRegisters - nArguments) * chunk);
+  std::vector<const double *> registers(m_nRegisters);
+  for (size_t i = nArguments; i < m_nRegisters; ++i)
+    registers[i] = &buffer[(i - nArguments) * chunk];
+  for (size_t start = 0; start < n; start += chunk) {
+    const size_t size = std::min(chunk, n - start);
+    for (size_t i = 0; i < nArguments; ++i)
+      registers[i] = values[i] + start;
+    for (const auto &instruction : m_vectorProgram) {
+      auto result = &buffer[(instruction.result.index - nArguments) * chunk];
+      execute(instruction, registers, result, scalars, size);
+    }
+    std::copy_n(registers[m_result.index], size, out + start);
+  }
+}
+
+/// Compile an expression and return the operand holding its value
+CompiledExpression::Operand CompiledExpression::compile(
+    const Expression &term,
+    const std::map<std::string, const double *> &variables) {
+  const auto &expr = term.bracketsRemoved();
+  const auto &name = expr.name();
+  if (!expr.isFunct()) {
+    double number;
+    if (isNumber(name, number))
+      return addConstant(number);
+    const auto argument =
+        std::find(m_arguments.begin(), m_arguments.end(), name);
+    if (argument != m_arguments.end())
+      return Operand{true, static_cast<size_t>(
+                               std::distance(m_arguments.begin(), argument))};
+    const auto variable = variables.find(name);
+    if (variable != variables.end()) {
+      m_scalars.push_back(0.0);
+      m_isConstant.push_back(false);
+      m_loads.emplace_back(m_scalars.size() - 1, variable->second);
+      return Operand{false, m_scalars.size() - 1};
+    }
+    if (name == "_pi")
+      return addConstant(M_PI);
+    if (name == "_e")
+      return addConstant(M_E);
+    throw std::invalid_argument("Unknown name " + name + " in expression.");
+  }
+
+  if (isUnary(expr)) {
+    // muParser and Expression may disagree on whether -x^2 is -(x^2) or
+    // (-x)^2, so such formulas are not compiled.
+    if (expr[0].bracketsRemoved().name() == "^")
+      unsupported(expr);
+    const auto operand = compile(expr[0], variables);
+    return name == "-" ? emit(OpCode::Negate, operand, operand) : operand;
+  }
+
+  if (name == "+" || name == "*") {
+    auto result = compile(expr[0], variables);
+    for (size_t i = 1; i < expr.size(); ++i) {
+      const auto &op = expr[i].operator_name();
+      const auto code = op == "+" ? OpCode::Add
+                                  : op == "-" ? OpCode::Subtract
+                                              : op == "*" ? OpCode::Multiply
+                                                          : OpCode::Divide;
+      result = emit(code, result, compile(expr[i], variables));
+    }
+    return result;
+  }
+
+  if (name == "^") {
+    if (expr.size() != 2 || isUnary(expr[0].bracketsRemoved()))
+      unsupported(expr);
+    const auto base = compile(expr[0], variables);
+    double exponent;
+    if (isNumber(expr[1].bracketsRemoved().name(), exponent)) {
+      if (exponent == 1.0)
+        return base;
+      if (exponent == 2.0)
+        return emit(OpCode::Square, base, base);
+      if (exponent == 0.5)
+        return emit(OpCode::Call, base, base, findFunction("sqrt"));
+    }
+    return emit(OpCode::Power, base, compile(expr[1], variables));
+  }
+
+  if (name == "min" || name == "max") {
+    const auto code = name == "min" ? OpCode::Minimum : OpCode::Maximum;
+    auto result = compile(expr[0], variables);
+    for (size_t i = 1; i < expr.size(); ++i)
+      result = emit(code, result, compile(expr[i], variables));
+    return result;
+  }
+
+  const auto function = findFunction(name);
+  if (expr.size() != 1 || !function)
+    unsupported(expr);
+  const auto argument = compile(expr[0], variables);
+  return emit(OpCode::Call, argument, argument, function);
+}
+
+/** Add an instruction. Operations on constants are done straight away and
+ * operations on scalars go into the scalar program.
+ */
+CompiledExpression::Operand
+CompiledExpression::emit(const OpCode code, const Operand &lhs,
+                         const Operand &rhs, double (*function)(double)) {
+  Instruction instruction{code, Operand{false, 0}, lhs, rhs, function};
+  if (lhs.isVector || rhs.isVector) {
+    instruction.result = Operand{true, m_nRegisters++};
+    m_vectorProgram.push_back(instruction);
+  } else if (m_isConstant[lhs.index] && m_isConstant[rhs.index]) {
+    return addConstant(
+        apply(instruction, m_scalars[lhs.index], m_scalars[rhs.index]));
+  } else {
+    m_scalars.push_back(0.0);
+    m_isConstant.push_back(false);
+    instruction.result = Operand{false, m_scalars.size() - 1};
+    m_scalarProgram.push_back(instruction);
+  }
+  return instruction.result;
+}
+
+CompiledExpression::Operand
+CompiledExpression::addConstant(const double value) {
+  m_scalars.push_back(value);
+  m_isConstant.push_back(true);
+  return Operand{false, m_scalars.size() - 1};
+}
+
+/// Apply an instruction to scalars
+double CompiledExpression::apply(const Instruction &instruction,
+                                 const double lhs, const double rhs) {
+  switch (instruction.code) {
+  case OpCode::Add:
+    return lhs + rhs;
+  case OpCode::Subtract:
+    return lhs - rhs;
+  case OpCode::Multiply:
+    return lhs * rhs;
+  case OpCode::Divide:
+    return lhs / rhs;
+  case OpCode::Power:
+    return std::pow(lhs, rhs);
+  case OpCode::Square:
+    return lhs * lhs;
+  case OpCode::Negate:
+    return -lhs;
+  case OpCode::Minimum:
+    return std::min(lhs, rhs);
+  case OpCode::Maximum:
+    return std::max(lhs, rhs);
+  case OpCode::Call:
+    return instruction.function(lhs);
+  }
+  throw std::logic_error("CompiledExpression: unknown instruction.");
+}
+
+namespace {
+/// Apply a binary operation to a chunk, with either operand possibly a scalar
+template <class Op>
+void applyBinary(double *result, const double *lhs, const double *rhs,
+                 const bool lhsIsVector, const bool rhsIsVector,
+                 const size_t n, Op op) {
+  if (lhsIsVector && rhsIsVector) {
+    for (size_t i = 0; i < n; ++i)
+      result[i] = op(lhs[i], rhs[i]);
+  } else if (lhsIsVector) {
+    const double b = *rhs;
+    for (size_t i = 0; i < n; ++i)
+      result[i] = op(lhs[i], b);
+  } else {
+    const double a = *lhs;
+    for (size_t i = 0; i < n; ++i)
+      result[i] = op(a, rhs[i]);
+  }
+}
+} // namespace
+
+/// Apply an instruction to a chunk of n points
+void CompiledExpression::execute(const Instruction &instruction,
+                                 const std::vector<const double *> &registers,
+                                 double *result,
+                                 const std::vector<double> &scalars,
+                                 const size_t n) const {
+  const auto &lhsOperand = instruction.lhs;
+  const auto &rhsOperand = instruction.rhs;
+  const double *lhs = lhsOperand.isVector ? registers[lhsOperand.index]
+                                          : &scalars[lhsOperand.index];
+  const double *rhs = rhsOperand.isVector ? registers[rhsOperand.index]
+                                          : &scalars[rhsOperand.index];
+  const bool lv = lhsOperand.isVector;
+  const bool rv = rhsOperand.isVector;
+  switch (instruction.code) {
+  case OpCode::Add:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return a + b; });
+    return;
+  case OpCode::Subtract:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return a - b; });
+    return;
+  case OpCode::Multiply:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return a * b; });
+    return;
+  case OpCode::Divide:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return a / b; });
+    return;
+  case OpCode::Power:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return std::pow(a, b); });
+    return;
+  case OpCode::Minimum:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return std::min(a, b); });
+    return;
+  case OpCode::Maximum:
+    applyBinary(result, lhs, rhs, lv, rv, n,
+                [](double a, double b) { return std::max(a, b); });
+    return;
+  // The unary instructions only get here with a vector operand
+  case OpCode::Square:
+    for (size_t i = 0; i < n; ++i)
+      result[i] = lhs[i] * lhs[i];
+    return;
+  case OpCode::Negate:
+    for (size_t i = 0; i < n; ++i)
+      result[i] = -lhs[i];
+    return;
+  case OpCode::Call:
+    for (size_t i = 0; i < n; ++i)
+      result[i] = instruction.function(lhs[i]);
+    return;
+  }
+}
+
+} // namespace API
+} // namespace Mantid
@@ -9,6 +9,7 @@
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/TraceService.h"
 #include "MantidKernel/UsageService.h"
 
 #include <nexus/NeXusFile.hpp>
@@ -270,6 +271,7 @@ void FrameworkManagerImpl::clear() {
 
 void FrameworkManagerImpl::shutdown() {
   Kernel::UsageService::Instance().shutdown();
+  Kernel::TraceService::Instance().shutdown();
   clear();
 }
 
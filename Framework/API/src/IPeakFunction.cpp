@@ -10,8 +10,10 @@
 
 #include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <utility>
 
 namespace Mantid {
 namespace API {
@@ -85,6 +87,43 @@ const double PEAK_TOLERANCE = 1e-14;
 /// "Infinite" value for the peak radius
 const int MAX_PEAK_RADIUS = std::numeric_limits<int>::max();
 
+/**
+ * Find the points closer than a distance to the centre of a peak. The points
+ * are assumed to be ordered so that they form a contiguous range. If they
+ * are ascending its ends are found by bisection.
+ * @param xValues :: The x values
+ * @param nData :: The number of the x values
+ * @param centre :: The centre of the peak
+ * @param dx :: The distance
+ * @return :: The index of the first point in the range and the number of
+ * points
+ */
+std::pair<size_t, size_t> findPeakRange(const double *xValues,
+                                        const size_t nData,
+                                        const double centre, const double dx) {
+  if (nData > 0 && xValues[0] <= xValues[nData - 1] && dx >= 0.0) {
+    // Use the same comparisons as the scan below to get the same points
+    auto begin = std::partition_point(
+        xValues, xValues + nData,
+        [centre, dx](double x) { return x - centre <= -dx; });
+    auto end = std::partition_point(
+        begin, xValues + nData,
+        [centre, dx](double x) { return x - centre < dx; });
+    return std::make_pair(static_cast<size_t>(begin - xValues),
+                          static_cast<size_t>(end - begin));
+  }
+  size_t i0 = 0;
+  size_t n = 0;
+  for (size_t i = 0; i < nData; ++i) {
+    if (fabs(xValues[i] - centre) < dx) {
+      if (n == 0)
+        i0 = i;
+      ++n;
+    }
+  }
+  return std::make_pair(i0, n);
+}
+
 } // namespace
 
 /**
@@ -114,18 +153,12 @@ void IPeakFunction::function1D(double *out, const double *xValues,
                                const size_t nData) const {
   double c = this->centre();
   double dx = fabs(m_peakRadius * this->fwhm());
-  int i0 = -1;
-  int n = 0;
-  for (size_t i = 0; i < nData; ++i) {
-    if (fabs(xValues[i] - c) < dx) {
-      if (i0 < 0)
-        i0 = static_cast<int>(i);
-      ++n;
-    } else {
-      out[i] = 0.0;
-    }
-  }
-  if (i0 < 0 || n == 0)
+  const auto range = findPeakRange(xValues, nData, c, dx);
+  const size_t i0 = range.first;
+  const size_t n = range.second;
+  std::fill(out, out + i0, 0.0);
+  std::fill(out + i0 + n, out + nData, 0.0);
+  if (n == 0)
     return;
   this->functionLocal(out + i0, xValues + i0, n);
 }
@@ -145,22 +178,19 @@ void IPeakFunction::functionDeriv1D(Jacobian *out, const double *xValues,
                                     const size_t nData) {
   double c = this->centre();
   double dx = fabs(m_peakRadius * this->fwhm());
-  int i0 = -1;
-  int n = 0;
+  const auto range = findPeakRange(xValues, nData, c, dx);
+  const size_t i0 = range.first;
+  const size_t n = range.second;
   for (size_t i = 0; i < nData; ++i) {
-    if (fabs(xValues[i] - c) < dx) {
-      if (i0 < 0)
-        i0 = static_cast<int>(i);
-      ++n;
-    } else {
+    if (i < i0 || i >= i0 + n) {
       for (size_t ip = 0; ip < this->nParams(); ++ip) {
         out->set(i, ip, 0.0);
       }
     }
   }
-  if (i0 < 0 || n == 0)
+  if (n == 0)
     return;
-  PartialJacobian1 J(out, i0);
+  PartialJacobian1 J(out, static_cast<int>(i0));
   this->functionDerivLocal(&J, xValues + i0, n);
 }
 
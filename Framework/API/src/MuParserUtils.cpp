@@ -1,9 +1,17 @@
 #include "MantidAPI/MuParserUtils.h"
+#include "MantidAPI/Expression.h"
 
 #include "MantidKernel/make_unique.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include <gsl/gsl_sf.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
 using namespace Mantid::PhysicalConstants;
 
 namespace Mantid {
@@ -51,6 +59,245 @@ void DLLExport extraOneVarFunctions(mu::Parser &parser) {
   }
 }
 
+namespace {
+// The derivatives are built as strings. Every subexpression is bracketed so
+// that the result does not depend on operator precedence, and the trivial
+// derivatives "0" and "1" are folded away to keep the formulas short.
+const std::string ZERO = "0";
+const std::string ONE = "1";
+
+std::string bracket(const std::string &expr) { return "(" + expr + ")"; }
+
+std::string negate(const std::string &expr) {
+  return expr == ZERO ? ZERO : "(-" + bracket(expr) + ")";
+}
+
+std::string add(const std::string &lhs, const std::string &rhs) {
+  if (lhs == ZERO)
+    return rhs;
+  if (rhs == ZERO)
+    return lhs;
+  return bracket(lhs + "+" + rhs);
+}
+
+std::string multiply(const std::string &lhs, const std::string &rhs) {
+  if (lhs == ZERO || rhs == ZERO)
+    return ZERO;
+  if (lhs == ONE)
+    return rhs;
+  if (rhs == ONE)
+    return lhs;
+  return bracket(bracket(lhs) + "*" + bracket(rhs));
+}
+
+std::string divide(const std::string &lhs, const std::string &rhs) {
+  if (lhs == ZERO)
+    return ZERO;
+  return bracket(bracket(lhs) + "/" + bracket(rhs));
+}
+
+std::string power(const std::string &base, const std::string &exponent) {
+  return bracket(bracket(base) + "^" + bracket(exponent));
+}
+
+std::string toString(const double number) {
+  std::ostringstream ostr;
+  ostr << std::setprecision(17) << number;
+  return ostr.str();
+}
+
+/// Check if a string is a number and return its value
+bool isNumber(const std::string &str, double &number) {
+  char *end = nullptr;
+  number = std::strtod(str.c_str(), &end);
+  return !str.empty() && end == str.c_str() + str.size();
+}
+
+bool isName(const std::string &str) {
+  if (str.empty() || std::isdigit(static_cast<unsigned char>(str[0])))
+    return false;
+  return std::all_of(str.begin(), str.end(), [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+  });
+}
+
+bool isUnary(const Expression &expr) {
+  return expr.size() == 1 && (expr.name() == "-" || expr.name() == "+");
+}
+
+[[noreturn]] void unsupported(const Expression &expr) {
+  throw std::invalid_argument("Cannot differentiate " + expr.str());
+}
+
+/// Write an expression back into a fully bracketed muParser string.
+std::string print(const Expression &term) {
+  const auto &expr = term.bracketsRemoved();
+  if (!expr.isFunct())
+    return expr.name();
+  if (isUnary(expr))
+    return expr.name() == "-" ? "(-" + print(expr[0]) + ")" : print(expr[0]);
+  const auto &name = expr.name();
+  if (name == "+" || name == "*" || name == "^") {
+    std::string result;
+    for (const auto &operand : expr)
+      result += operand.operator_name() + print(operand);
+    return bracket(result);
+  }
+  if (expr.size() != 1 || !isName(name))
+    unsupported(expr);
+  return name + bracket(print(expr[0]));
+}
+
+/// The derivative of a function of one argument with respect to the argument
+std::string outerDerivative(const std::string &name, const std::string &u) {
+  const std::string u2 = power(u, "2");
+  if (name == "sin")
+    return "cos" + bracket(u);
+  if (name == "cos")
+    return negate("sin" + bracket(u));
+  if (name == "tan")
+    return bracket("1+" + power("tan" + bracket(u), "2"));
+  if (name == "asin")
+    return divide(ONE, "sqrt" + bracket("1-" + u2));
+  if (name == "acos")
+    return negate(divide(ONE, "sqrt" + bracket("1-" + u2)));
+  if (name == "atan")
+    return divide(ONE, "1+" + u2);
+  if (name == "sinh")
+    return "cosh" + bracket(u);
+  if (name == "cosh")
+    return "sinh" + bracket(u);
+  if (name == "tanh")
+    return bracket("1-" + power("tanh" + bracket(u), "2"));
+  if (name == "asinh")
+    return divide(ONE, "sqrt" + bracket(u2 + "+1"));
+  if (name == "acosh")
+    return divide(ONE, "sqrt" + bracket(u2 + "-1"));
+  if (name == "atanh")
+    return divide(ONE, "1-" + u2);
+  if (name == "exp")
+    return "exp" + bracket(u);
+  if (name == "sqrt")
+    return divide(ONE, "2*sqrt" + bracket(u));
+  if (name == "ln")
+    return divide(ONE, u);
+  // d/du log_b(u) = log_b(e) / u, whatever base b the function uses
+  if (name == "log" || name == "log10" || name == "log2")
+    return divide(name + "(_e)", u);
+  if (name == "abs")
+    return "sign" + bracket(u);
+  if (name == "sign" || name == "rint")
+    return ZERO;
+  if (name == "erf")
+    return multiply("2/sqrt(_pi)", "exp" + bracket(negate(u2)));
+  if (name == "erfc")
+    return multiply("-2/sqrt(_pi)", "exp" + bracket(negate(u2)));
+  throw std::invalid_argument("Cannot differentiate function " + name);
+}
+
+std::string derivative(const Expression &term, const std::string &variable) {
+  const auto &expr = term.bracketsRemoved();
+  const auto &name = expr.name();
+  if (!expr.isFunct()) {
+    double number;
+    if (isNumber(name, number))
+      return ZERO;
+    if (!isName(name))
+      unsupported(expr);
+    return name == variable ? ONE : ZERO;
+  }
+
+  if (isUnary(expr)) {
+    // muParser and Expression may disagree on whether -x^2 is -(x^2) or
+    // (-x)^2, so such formulas are not differentiated.
+    if (expr[0].bracketsRemoved().name() == "^")
+      unsupported(expr);
+    const auto result = derivative(expr[0], variable);
+    return name == "-" ? negate(result) : result;
+  }
+
+  if (name == "+") {
+    std::string result = ZERO;
+    for (const auto &operand : expr) {
+      const auto d = derivative(operand, variable);
+      result = add(result, operand.operator_name() == "-" ? negate(d) : d);
+    }
+    return result;
+  }
+
+  if (name == "*") {
+    // Product rule: differentiate one factor at a time
+    std::string result = ZERO;
+    for (size_t i = 0; i < expr.size(); ++i) {
+      const auto d = derivative(expr[i], variable);
+      if (d == ZERO)
+        continue;
+      std::string others;
+      for (size_t j = 0; j < expr.size(); ++j) {
+        if (j == i)
+          continue;
+        const bool isDivisor = expr[j].operator_name() == "/";
+        if (others.empty())
+          others = isDivisor ? "1/" + print(expr[j]) : print(expr[j]);
+        else
+          others += (isDivisor ? "/" : "*") + print(expr[j]);
+      }
+      const auto factor =
+          expr[i].operator_name() == "/"
+              ? negate(divide(d, power(print(expr[i]), "2")))
+              : d;
+      result = add(result, multiply(bracket(others), factor));
+    }
+    return result;
+  }
+
+  if (name == "^") {
+    if (expr.size() != 2 || isUnary(expr[0].bracketsRemoved()))
+      unsupported(expr);
+    const auto u = print(expr[0]);
+    const auto v = print(expr[1]);
+    const auto du = derivative(expr[0], variable);
+    const auto dv = derivative(expr[1], variable);
+    std::string result = ZERO;
+    if (du != ZERO) {
+      double exponent;
+      const auto reduced = isNumber(expr[1].bracketsRemoved().name(), exponent)
+                               ? toString(exponent - 1.0)
+                               : v + "-1";
+      const auto outer =
+          reduced == ONE ? multiply(v, u) : multiply(v, power(u, reduced));
+      result = multiply(outer, du);
+    }
+    if (dv != ZERO)
+      result = add(result,
+                   multiply(multiply(power(u, v), "ln" + bracket(u)), dv));
+    return result;
+  }
+
+  if (expr.size() == 1 && isName(name)) {
+    const auto du = derivative(expr[0], variable);
+    if (du == ZERO)
+      return ZERO;
+    return multiply(outerDerivative(name, print(expr[0])), du);
+  }
+  unsupported(expr);
+}
+} // namespace
+
+/** Differentiate a muParser expression symbolically.
+ *  @param formula :: An expression in the muParser syntax.
+ *  @param variable :: The name of the variable to differentiate by.
+ *  @return A muParser expression of the derivative.
+ *  @throw std::invalid_argument if the formula uses operators or functions
+ *  that cannot be differentiated, e.g. comparisons or min and max.
+ */
+std::string DLLExport differentiate(const std::string &formula,
+                                    const std::string &variable) {
+  Expression expr;
+  expr.parse(formula);
+  return derivative(expr, variable);
+}
+
 } // namespace MuParserUtils
 } // namespace API
 } // namespace Mantid
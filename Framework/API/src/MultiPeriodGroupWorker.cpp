@@ -186,7 +186,7 @@ void MultiPeriodGroupWorker::copyInputWorkspaceProperties(
  *
  * This should be called after checkGroups(), which sets up required members.
  * It goes through each member of the group(s), creates and sets an algorithm
- * for each and executes them one by one.
+ * for each and executes them with Algorithm::executeGroupMembers.
  *
  * If there are several group input workspaces, then the member of each group
  * is executed pair-wise.
@@ -210,6 +210,10 @@ bool MultiPeriodGroupWorker::processGroups(
   AnalysisDataService::Instance().addOrReplace(outName, outputWS);
 
   double progress_proportion = 1.0 / static_cast<double>(nPeriods);
+  std::vector<Algorithm_sptr> algorithms;
+  algorithms.reserve(nPeriods);
+  std::vector<std::string> outputNames;
+  outputNames.reserve(nPeriods);
   // Loop through all the periods. Create spawned algorithms of the same type as
   // this to process pairs from the input groups.
   for (size_t i = 0; i < nPeriods; ++i) {
@@ -242,14 +246,15 @@ bool MultiPeriodGroupWorker::processGroups(
     }
     const std::string outName_i = outName + "_" + Strings::toString(i + 1);
     alg->setPropertyValue("OutputWorkspace", outName_i);
-    // Run the spawned algorithm.
-    if (!alg->execute()) {
-      throw std::runtime_error("Execution of " + sourceAlg->name() +
-                               " for group entry " + Strings::toString(i + 1) +
-                               " failed.");
-    }
-    // Add the output workpace from the spawned algorithm to the group.
-    outputWS->add(outName_i);
+    algorithms.push_back(alg_sptr);
+    outputNames.push_back(outName_i);
+  }
+
+  // Run the spawned algorithms.
+  sourceAlg->executeGroupMembers(algorithms);
+  // Add the output workpaces from the spawned algorithms to the group.
+  for (const auto &outputName : outputNames) {
+    outputWS->add(outputName);
   }
 
   sourceAlg->setProperty("OutputWorkspace", outputWS);
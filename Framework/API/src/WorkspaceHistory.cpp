@@ -12,6 +12,8 @@
 #include "Poco/DateTime.h"
 #include <Poco/DateTimeParser.h>
 
+#include <unordered_set>
+
 using Mantid::Kernel::EnvironmentHistory;
 using boost::algorithm::split;
 
@@ -20,8 +22,26 @@ namespace API {
 namespace {
 /// static logger object
 Kernel::Logger g_log("WorkspaceHistory");
+/// The depth of the history graph above which it is merged into one node
+const size_t MAX_GRAPH_DEPTH = 64;
 }
 
+/** A node of the history graph. A merged node holds all the histories up to
+ * that point and has no parents. Any other node adds an algorithm to the
+ * histories of its parent, or joins the histories of two parents. Nodes which
+ * are shared with other histories are never modified.
+ */
+struct WorkspaceHistory::Node {
+  /// All the histories up to this node, only used by a merged node
+  AlgorithmHistories histories;
+  /// The algorithm added by this node, may be null
+  AlgorithmHistory_sptr algorithm;
+  /// The nodes this one extends
+  std::vector<Node_sptr> parents;
+  /// The length of the longest path to a merged node
+  size_t depth = 0;
+};
+
 /// Default Constructor
 WorkspaceHistory::WorkspaceHistory() : m_environment() {}
 
@@ -33,14 +53,13 @@ WorkspaceHistory::~WorkspaceHistory() = default;
   @param A :: WorkspaceHistory Item to copy
  */
 WorkspaceHistory::WorkspaceHistory(const WorkspaceHistory &A)
-    : m_environment(A.m_environment) {
-  m_algorithms = A.m_algorithms;
-}
+    : m_environment(A.m_environment), m_head(A.head()) {}
 
-/// Returns a const reference to the algorithmHistory
-const Mantid::API::AlgorithmHistories &
+/// Returns a copy of the algorithm histories
+Mantid::API::AlgorithmHistories
 WorkspaceHistory::getAlgorithmHistories() const {
-  return m_algorithms;
+  const auto merged = mergedHead();
+  return merged ? merged->histories : AlgorithmHistories();
 }
 /// Returns a const reference to the EnvironmentHistory
 const Kernel::EnvironmentHistory &
@@ -55,32 +74,148 @@ void WorkspaceHistory::addHistory(const WorkspaceHistory &otherHistory) {
     return;
   }
 
-  // Merge the histories
-  const AlgorithmHistories &otherAlgorithms =
-      otherHistory.getAlgorithmHistories();
-  m_algorithms.insert(otherAlgorithms.begin(), otherAlgorithms.end());
+  // Merge the histories. This is common for the output of an algorithm,
+  // which often starts with a copy of the history of its input.
+  auto other = otherHistory.head();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!other || other == m_head) {
+    return;
+  }
+  if (!m_head) {
+    setHead(std::move(other));
+    return;
+  }
+  extend(nullptr, {currentNode(), std::move(other)});
 }
 
 /// Append an AlgorithmHistory to this WorkspaceHistory
 void WorkspaceHistory::addHistory(AlgorithmHistory_sptr algHistory) {
-  m_algorithms.insert(std::move(algHistory));
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // Copies and readers take their reference under the lock, so a node only
+  // referred to by m_head cannot be in use elsewhere
+  if (m_head && m_head->parents.empty() && m_head.use_count() == 1) {
+    m_head->histories.insert(std::move(algHistory));
+  } else if (!m_head) {
+    auto node = boost::make_shared<Node>();
+    node->histories.insert(std::move(algHistory));
+    setHead(std::move(node));
+  } else {
+    extend(std::move(algHistory), {currentNode()});
+  }
 }
 
 /*
  Return the history length
  */
-size_t WorkspaceHistory::size() const { return m_algorithms.size(); }
+size_t WorkspaceHistory::size() const {
+  const auto merged = mergedHead();
+  return merged ? merged->histories.size() : 0;
+}
 
 /**
  * Query if the history is empty or not
  * @returns True if the list is empty, false otherwise
  */
-bool WorkspaceHistory::empty() const { return m_algorithms.empty(); }
+bool WorkspaceHistory::empty() const { return !head(); }
 
 /**
  * Empty the list of algorithm history objects.
  */
-void WorkspaceHistory::clearHistory() { m_algorithms.clear(); }
+void WorkspaceHistory::clearHistory() {
+  Node_sptr cleared;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  cleared.swap(m_head);
+  m_merged.reset();
+}
+
+/// @returns The head of the history graph
+WorkspaceHistory::Node_sptr WorkspaceHistory::head() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_head;
+}
+
+/**
+ * The histories are merged once per head and the merged node is kept for
+ * later reads. The head itself is left alone.
+ * @returns A node holding all the histories, null if there are none
+ */
+WorkspaceHistory::Node_sptr WorkspaceHistory::mergedHead() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_head || m_head->parents.empty()) {
+    return m_head;
+  }
+  if (!m_merged) {
+    m_merged = merge(m_head);
+  }
+  return m_merged;
+}
+
+/**
+ * The node to extend when the history changes: the merged graph if it has
+ * been built, which keeps the graph shallow. Must be called with the lock
+ * held.
+ * @returns The merged node or the head
+ */
+WorkspaceHistory::Node_sptr WorkspaceHistory::currentNode() const {
+  return m_merged ? m_merged : m_head;
+}
+
+/**
+ * Replace the head of the graph. Must be called with the lock held.
+ * @param node :: The new head
+ */
+void WorkspaceHistory::setHead(Node_sptr node) {
+  m_head = std::move(node);
+  m_merged.reset();
+}
+
+/**
+ * Make a new node the head of the history graph. Must be called with the lock
+ * held.
+ * @param algorithm :: The algorithm added by the node, may be null
+ * @param parents :: The nodes the new node extends
+ */
+void WorkspaceHistory::extend(AlgorithmHistory_sptr algorithm,
+                              std::vector<Node_sptr> parents) {
+  auto node = boost::make_shared<Node>();
+  node->algorithm = std::move(algorithm);
+  for (const auto &parent : parents) {
+    node->depth = std::max(node->depth, parent->depth + 1);
+  }
+  node->parents = std::move(parents);
+  // Bounding the depth bounds the cost of reading the history, and the
+  // recursion when the nodes are destroyed
+  setHead(node->depth > MAX_GRAPH_DEPTH ? merge(node) : node);
+}
+
+/**
+ * Collect the histories of a graph into a single node.
+ * @param head :: The last node of the graph
+ * @returns head if it is already merged, otherwise a new node
+ */
+WorkspaceHistory::Node_sptr WorkspaceHistory::merge(const Node_sptr &head) {
+  if (head->parents.empty()) {
+    return head;
+  }
+  auto merged = boost::make_shared<Node>();
+  std::unordered_set<const Node *> visited;
+  std::vector<const Node *> stack{head.get()};
+  while (!stack.empty()) {
+    const Node *node = stack.back();
+    stack.pop_back();
+    if (!visited.insert(node).second) {
+      continue;
+    }
+    merged->histories.insert(node->histories.begin(), node->histories.end());
+    if (node->algorithm) {
+      merged->histories.insert(node->algorithm);
+    }
+    for (const auto &parent : node->parents) {
+      stack.push_back(parent.get());
+    }
+  }
+  return merged;
+}
 
 /**
  * Retrieve an algorithm history by index
@@ -90,11 +225,18 @@ void WorkspaceHistory::clearHistory() { m_algorithms.clear(); }
  */
 AlgorithmHistory_const_sptr
 WorkspaceHistory::getAlgorithmHistory(const size_t index) const {
-  if (index >= this->size()) {
+  // The node is held so that it outlives the iteration
+  const auto merged = mergedHead();
+  if (!merged || index >= merged->histories.size()) {
     throw std::out_of_range(
         "WorkspaceHistory::getAlgorithmHistory() - Index out of range");
   }
-  return *std::next(m_algorithms.cbegin(), index);
+  const auto &algorithms = merged->histories;
+  // Recent entries are the ones usually asked for
+  if (index >= algorithms.size() / 2) {
+    return *std::prev(algorithms.cend(), algorithms.size() - index);
+  }
+  return *std::next(algorithms.cbegin(), index);
 }
 
 /**
@@ -123,7 +265,7 @@ WorkspaceHistory::getAlgorithm(const size_t index) const {
  * @returns A shared pointer to the algorithm
  */
 boost::shared_ptr<IAlgorithm> WorkspaceHistory::lastAlgorithm() const {
-  if (m_algorithms.empty()) {
+  if (empty()) {
     throw std::out_of_range(
         "WorkspaceHistory::lastAlgorithm() - History contains no algorithms.");
   }
@@ -142,7 +284,11 @@ void WorkspaceHistory::printSelf(std::ostream &os, const int indent) const {
   AlgorithmHistories::const_iterator it;
   os << std::string(indent, ' ') << "Histories:\n";
 
-  for (const auto &algorithm : m_algorithms) {
+  const auto merged = mergedHead();
+  if (!merged) {
+    return;
+  }
+  for (const auto &algorithm : merged->histories) {
     os << '\n';
     algorithm->printSelf(os, indent + 2);
   }
@@ -177,8 +323,10 @@ void WorkspaceHistory::saveNexus(::NeXus::File *file) const {
 
   // Algorithm History
   int algCount = 0;
-  for (const auto &algorithm : m_algorithms) {
-    algorithm->saveNexus(file, algCount);
+  if (const auto merged = mergedHead()) {
+    for (const auto &algorithm : merged->histories) {
+      algorithm->saveNexus(file, algCount);
+    }
   }
 
   // close process group
@@ -2,6 +2,9 @@
 #include "MantidAPI/WorkspaceNearestNeighbours.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorNeighbourIndex.h"
 #include "MantidKernel/make_unique.h"
 
 namespace Mantid {
@@ -22,9 +25,14 @@ WorkspaceNearestNeighbourInfo::WorkspaceNearestNeighbourInfo(
   for (size_t i = 0; i < m_workspace.getNumberHistograms(); ++i)
     spectrumNumbers.push_back(m_workspace.getSpectrum(i).getSpectrumNo());
 
+  // The detector index is shared by all workspaces with the same instrument
+  boost::shared_ptr<const Geometry::DetectorNeighbourIndex> detectorIndex;
+  if (!workspace.detectorInfo().isScanning())
+    detectorIndex = workspace.componentInfo().neighbourIndex();
+
   m_nearestNeighbours = Kernel::make_unique<WorkspaceNearestNeighbours>(
       nNeighbours, workspace.spectrumInfo(), std::move(spectrumNumbers),
-      ignoreMaskedDetectors);
+      ignoreMaskedDetectors, std::move(detectorIndex));
 }
 
 // Defined as default in source for forward declaration with std::unique_ptr.
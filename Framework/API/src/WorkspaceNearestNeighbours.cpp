@@ -2,11 +2,15 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
+#include "MantidGeometry/Instrument/DetectorNeighbourIndex.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 // Nearest neighbours library
 #include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <algorithm>
 
 namespace Mantid {
 using namespace Geometry;
@@ -23,14 +27,18 @@ using Kernel::V3D;
  * of spectra
  * @param ignoreMaskedDetectors :: flag indicating that masked detectors should
  * be ignored.
+ * @param detectorIndex :: Optional spatial index over the detectors of the
+ * instrument, used instead of building an ANN tree when possible
  */
 WorkspaceNearestNeighbours::WorkspaceNearestNeighbours(
     int nNeighbours, const SpectrumInfo &spectrumInfo,
-    std::vector<specnum_t> spectrumNumbers, bool ignoreMaskedDetectors)
+    std::vector<specnum_t> spectrumNumbers, bool ignoreMaskedDetectors,
+    boost::shared_ptr<const Geometry::DetectorNeighbourIndex> detectorIndex)
     : m_spectrumInfo(spectrumInfo),
       m_spectrumNumbers(std::move(spectrumNumbers)),
       m_noNeighbours(nNeighbours), m_cutoff(-DBL_MAX), m_radius(0),
-      m_bIgnoreMaskedDetectors(ignoreMaskedDetectors) {
+      m_bIgnoreMaskedDetectors(ignoreMaskedDetectors),
+      m_detectorIndex(std::move(detectorIndex)), m_useDetectorIndex(false) {
   this->build(m_noNeighbours);
 }
 
@@ -73,6 +81,20 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
       const_cast<WorkspaceNearestNeighbours *>(this)->build(eightNearest);
     }
     result = defaultNeighbours(spectrum);
+  } else if (m_useDetectorIndex) {
+    // The index answers radius queries directly, no need to grow the graph
+    const auto detector = m_spectrumToDetector.find(spectrum);
+    if (detector == m_spectrumToDetector.end()) {
+      throw Mantid::Kernel::Exception::NotFoundError(
+          "NearestNeighbours: Unable to find spectrum in vertex map", spectrum);
+    }
+    const V3D centre = m_detectorIndex->position(detector->second);
+    for (const auto neighbour : m_detectorIndex->withinRadius(
+             detector->second, radius, &m_excludedDetectors)) {
+      result[m_detectorToSpectrum.at(neighbour)] =
+          m_detectorIndex->position(neighbour) - centre;
+    }
+    return result;
   } else if (radius > m_cutoff && m_radius != radius) {
     // We might have to see how efficient this ends up being.
     int neighbours = m_noNeighbours + 1;
@@ -132,6 +154,15 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
   m_scale = V3D(bbox.width());
+
+  m_useDetectorIndex = mapToDetectorIndex(indices);
+  if (m_useDetectorIndex) {
+    buildFromDetectorIndex();
+    m_vertexID = get(boost::vertex_name, m_graph);
+    m_edgeLength = get(boost::edge_name, m_graph);
+    return;
+  }
+
   ANNpointArray dataPoints = annAllocPts(nspectra, 3);
   MapIV pointNoToVertex;
 
@@ -192,6 +223,69 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   m_edgeLength = get(boost::edge_name, m_graph);
 }
 
+/**
+ * Map each of the given spectra to a detector of m_detectorIndex. This is only
+ * possible if every spectrum has exactly one detector and no detector is
+ * shared between spectra, otherwise the ANN tree over spectrum positions must
+ * be used.
+ * @param indices :: Workspace indices of the spectra to include in the graph
+ * @return True if the mapping succeeded and the index can be used
+ */
+bool WorkspaceNearestNeighbours::mapToDetectorIndex(
+    const std::vector<size_t> &indices) {
+  m_indexedDetectors.clear();
+  m_detectorToSpectrum.clear();
+  m_spectrumToDetector.clear();
+  m_excludedDetectors.clear();
+  if (!m_detectorIndex || m_scale.X() <= 0.0 || m_scale.Y() <= 0.0 ||
+      m_scale.Z() <= 0.0)
+    return false;
+
+  m_excludedDetectors.assign(m_detectorIndex->size(), true);
+  for (const auto i : indices) {
+    if (!m_spectrumInfo.hasUniqueDetector(i))
+      return false;
+    // Scanning detectors are not in the index
+    const auto &definition = m_spectrumInfo.spectrumDefinition(i)[0];
+    const size_t detector = definition.first;
+    if (definition.second != 0 || detector >= m_detectorIndex->size() ||
+        !m_excludedDetectors[detector])
+      return false;
+    m_excludedDetectors[detector] = false;
+    m_indexedDetectors.push_back(detector);
+    m_detectorToSpectrum[detector] = m_spectrumNumbers[i];
+    m_spectrumToDetector[m_spectrumNumbers[i]] = detector;
+  }
+  return true;
+}
+
+/**
+ * Fill the graph with the m_noNeighbours nearest neighbours of each detector
+ * in m_indexedDetectors, using the same scaled metric as the ANN search.
+ */
+void WorkspaceNearestNeighbours::buildFromDetectorIndex() {
+  for (const auto detector : m_indexedDetectors) {
+    const specnum_t spectrum = m_detectorToSpectrum[detector];
+    m_specToVertex[spectrum] = boost::add_vertex(spectrum, m_graph);
+  }
+
+  const auto nearest =
+      m_detectorIndex->nearest(m_indexedDetectors,
+                               static_cast<size_t>(m_noNeighbours),
+                               &m_excludedDetectors, m_scale);
+  for (size_t i = 0; i < m_indexedDetectors.size(); ++i) {
+    const V3D centre = m_detectorIndex->position(m_indexedDetectors[i]);
+    const Vertex from =
+        m_specToVertex[m_detectorToSpectrum[m_indexedDetectors[i]]];
+    for (const auto neighbour : nearest[i]) {
+      const V3D distance = m_detectorIndex->position(neighbour) - centre;
+      boost::add_edge(from, m_specToVertex[m_detectorToSpectrum[neighbour]],
+                      distance, m_graph);
+      m_cutoff = std::max(m_cutoff, distance.norm());
+    }
+  }
+}
+
 /**
  * Returns a map of the spectrum numbers to the nearest detectors and their
  * distance from the detector specified in the argument.
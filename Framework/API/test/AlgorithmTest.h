@@ -6,9 +6,11 @@
 #include "FakeAlgorithms.h"
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/AlgorithmFactory.h"
+#include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
 #include "MantidAPI/WorkspaceProperty.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/Property.h"
@@ -70,6 +72,17 @@ public:
 };
 DECLARE_ALGORITHM(StubbedWorkspaceAlgorithm)
 
+class StubbedParallelGroupAlgorithm : public StubbedWorkspaceAlgorithm {
+public:
+  const std::string name() const override {
+    return "StubbedParallelGroupAlgorithm";
+  }
+
+protected:
+  bool canProcessGroupsInParallel() const override { return true; }
+};
+DECLARE_ALGORITHM(StubbedParallelGroupAlgorithm)
+
 class StubbedWorkspaceAlgorithm2 : public Algorithm {
 public:
   StubbedWorkspaceAlgorithm2() : Algorithm() {}
@@ -777,6 +790,44 @@ public:
     TS_ASSERT_EQUALS(ws3->getTitle(), "A3+D3+D3");
   }
 
+  /// Enough members to be processed in parallel
+  void test_processGroups_inParallel() {
+    Mantid::API::AnalysisDataService::Instance().clear();
+    const int nMembers = 2 * PARALLEL_GET_MAX_THREADS + 1;
+    std::string members = "P_1";
+    for (int i = 2; i <= nMembers; ++i)
+      members += ",P_" + Strings::toString(i);
+    makeWorkspaceGroup("P", members);
+
+    StubbedParallelGroupAlgorithm alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace1", "P");
+    alg.setPropertyValue("Number", "234");
+    alg.setPropertyValue("OutputWorkspace1", "Q");
+    alg.setPropertyValue("OutputWorkspace2", "R");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto group =
+        AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>("Q");
+    TS_ASSERT_EQUALS(group->getNumberOfEntries(), nMembers);
+    size_t firstExecCount = 0;
+    for (int i = 0; i < group->getNumberOfEntries(); ++i) {
+      auto ws = boost::dynamic_pointer_cast<MatrixWorkspace>(group->getItem(i));
+      const std::string number = Strings::toString(i + 1);
+      TS_ASSERT_EQUALS(ws->getName(), "Q_" + number);
+      TS_ASSERT_EQUALS(ws->getTitle(), "P_" + number + "++");
+      TS_ASSERT_EQUALS(ws->readY(0)[0], 234);
+      // The histories are numbered in the order of the members
+      const auto &history = ws->getHistory();
+      const size_t execCount =
+          history.getAlgorithmHistory(history.size() - 1)->execCount();
+      if (i == 0)
+        firstExecCount = execCount;
+      TS_ASSERT_EQUALS(execCount, firstExecCount + static_cast<size_t>(i));
+    }
+  }
+
   /**
    * Test declaring an algorithm property and retrieving as const
    * and non-const
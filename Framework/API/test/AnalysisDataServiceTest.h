@@ -3,19 +3,30 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceProperty.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <fstream>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 
 namespace {
 class MockWorkspace : public Workspace {
+public:
+  explicit MockWorkspace(const size_t size = 1) : m_size(size) {}
   const std::string id() const override { return "MockWorkspace"; }
   const std::string toString() const override { return ""; }
-  size_t getMemorySize() const override { return 1; }
+  size_t getMemorySize() const override { return m_size; }
 
 private:
+  size_t m_size;
   MockWorkspace *doClone() const override {
     throw std::runtime_error("Cloning of MockWorkspace is not implemented.");
   }
@@ -24,6 +35,52 @@ private:
   }
 };
 typedef boost::shared_ptr<MockWorkspace> MockWorkspace_sptr;
+
+/// Stands in for SaveNexusProcessed when workspaces are spilled
+class FakeSpillSaver : public Algorithm {
+public:
+  const std::string name() const override { return "SaveNexusProcessed"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Test"; }
+  const std::string summary() const override { return "Test"; }
+
+private:
+  void init() override {
+    declareProperty(Mantid::Kernel::make_unique<WorkspaceProperty<>>(
+        "InputWorkspace", "", Direction::Input));
+    declareProperty("Filename", "");
+  }
+  void exec() override {
+    Workspace_sptr ws = getProperty("InputWorkspace");
+    std::ofstream file(getPropertyValue("Filename"));
+    file << ws->getMemorySize();
+  }
+};
+
+/// Stands in for LoadNexusProcessed when workspaces are reloaded
+class FakeSpillLoader : public Algorithm {
+public:
+  const std::string name() const override { return "LoadNexusProcessed"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Test"; }
+  const std::string summary() const override { return "Test"; }
+
+private:
+  void init() override {
+    declareProperty("Filename", "");
+    declareProperty(Mantid::Kernel::make_unique<WorkspaceProperty<>>(
+        "OutputWorkspace", "", Direction::Output));
+  }
+  void exec() override {
+    std::ifstream file(getPropertyValue("Filename"));
+    if (!file)
+      throw std::runtime_error("Unable to open the spilled workspace");
+    size_t size(0);
+    file >> size;
+    setProperty("OutputWorkspace",
+                Workspace_sptr(boost::make_shared<MockWorkspace>(size)));
+  }
+};
 }
 
 class AnalysisDataServiceTest : public CxxTest::TestSuite {
@@ -40,6 +97,11 @@ public:
 
   void setUp() override { ads.clear(); }
 
+  void tearDown() override {
+    ads.setMemoryLimit(0);
+    ads.setSpillDirectory("");
+  }
+
   void
   test_IsValid_Returns_An_Empty_String_For_A_Valid_Name_When_All_CharsAre_Allowed() {
     TS_ASSERT_EQUALS(ads.isValid("CamelCase"), "");
@@ -438,7 +500,147 @@ public:
     TS_ASSERT(!ads.doesExist("null_workspace"));
   }
 
+  void test_memoryUsage_counts_each_workspace_once() {
+    auto ws = boost::make_shared<MockWorkspace>(10);
+    ads.add("first", ws);
+    ads.add("second", ws);
+    ads.add("third", boost::make_shared<MockWorkspace>(5));
+    addGroupToADS("group");
+    TS_ASSERT_EQUALS(ads.memoryUsage(), 17);
+  }
+
+  void test_storing_without_limit_does_not_throw() {
+    TS_ASSERT_EQUALS(ads.memoryLimit(), 0);
+    ads.add("workspace", boost::make_shared<MockWorkspace>(100));
+    TS_ASSERT_THROWS_NOTHING(
+        ads.add("large", boost::make_shared<MockWorkspace>(1000)));
+  }
+
+  void test_storing_throws_if_nothing_can_be_spilled() {
+    ads.setMemoryLimit(100);
+    ads.add("workspace", boost::make_shared<MockWorkspace>(60));
+    TS_ASSERT_THROWS_NOTHING(
+        ads.add("fits", boost::make_shared<MockWorkspace>(40)));
+    TS_ASSERT_THROWS(ads.add("too_large", boost::make_shared<MockWorkspace>(50)),
+                     std::runtime_error);
+    TS_ASSERT(!ads.doesExist("too_large"));
+    TS_ASSERT(!ads.isSpilled("workspace"));
+    // The replaced workspace and one that is already stored need no room
+    TS_ASSERT_THROWS_NOTHING(
+        ads.addOrReplace("fits", boost::make_shared<MockWorkspace>(40)));
+    TS_ASSERT_THROWS_NOTHING(ads.add("alias", ads.retrieve("workspace")));
+    TS_ASSERT_EQUALS(ads.memoryUsage(), 100);
+  }
+
+  void test_least_recently_used_workspaces_are_spilled_and_reloaded() {
+    SpillAlgorithms algorithms;
+    const auto directory = spillDirectory();
+    ads.setSpillDirectory(directory);
+    ads.setMemoryLimit(100);
+
+    ads.add("a", boost::make_shared<MockWorkspace>(40));
+    ads.add("b", boost::make_shared<MockWorkspace>(40));
+    ads.retrieve("a");
+    ads.add("c", boost::make_shared<MockWorkspace>(40));
+    TS_ASSERT(!ads.isSpilled("a"));
+    TS_ASSERT(ads.isSpilled("b"));
+    TS_ASSERT(!ads.isSpilled("c"));
+    TS_ASSERT(ads.doesExist("b"));
+    TS_ASSERT_EQUALS(ads.memoryUsage(), 80);
+
+    // Retrieving reloads it and spills the least recently used instead
+    auto b = ads.retrieve("b");
+    TS_ASSERT_EQUALS(b->id(), "MockWorkspace");
+    TS_ASSERT_EQUALS(b->getMemorySize(), 40);
+    TS_ASSERT_EQUALS(b->getName(), "b");
+    TS_ASSERT(ads.isSpilled("a"));
+    TS_ASSERT(!ads.isSpilled("b"));
+
+    // The files are deleted with the workspaces
+    ads.clear();
+    std::vector<std::string> files;
+    Poco::File(directory).list(files);
+    TS_ASSERT(files.empty());
+    Poco::File(directory).remove(true);
+  }
+
+  void test_workspaces_held_elsewhere_are_not_spilled() {
+    SpillAlgorithms algorithms;
+    const auto directory = spillDirectory();
+    ads.setSpillDirectory(directory);
+
+    auto held = boost::make_shared<MockWorkspace>(60);
+    ads.add("held", held);
+    ads.add("group", boost::make_shared<WorkspaceGroup>());
+    ads.setMemoryLimit(100);
+    TS_ASSERT_THROWS(ads.add("new", boost::make_shared<MockWorkspace>(50)),
+                     std::runtime_error);
+    TS_ASSERT(!ads.isSpilled("held"));
+    TS_ASSERT(!ads.isSpilled("group"));
+    ads.clear();
+    Poco::File(directory).remove(true);
+  }
+
+  void test_workspaces_with_weak_handles_are_not_spilled() {
+    SpillAlgorithms algorithms;
+    const auto directory = spillDirectory();
+    ads.setSpillDirectory(directory);
+
+    auto weak = boost::make_shared<MockWorkspace>(60);
+    weak->addWeakHandle();
+    ads.add("weak", weak);
+    ads.add("free", boost::make_shared<MockWorkspace>(30));
+    ads.setMemoryLimit(100);
+    TS_ASSERT_THROWS(ads.add("new", boost::make_shared<MockWorkspace>(50)),
+                     std::runtime_error);
+    TS_ASSERT(!ads.isSpilled("weak"));
+    TS_ASSERT(ads.isSpilled("free"));
+
+    // The workspace may be spilled once its last weak handle is gone
+    weak->removeWeakHandle();
+    weak.reset();
+    TS_ASSERT_THROWS_NOTHING(
+        ads.add("new", boost::make_shared<MockWorkspace>(50)));
+    TS_ASSERT(ads.isSpilled("weak"));
+    ads.clear();
+    Poco::File(directory).remove(true);
+  }
+
+  void test_retrieve_throws_NotFoundError_if_reloading_fails() {
+    SpillAlgorithms algorithms;
+    const auto directory = spillDirectory();
+    ads.setSpillDirectory(directory);
+
+    ads.add("spilled", boost::make_shared<MockWorkspace>(60));
+    ads.setMemoryLimit(50);
+    TS_ASSERT(ads.isSpilled("spilled"));
+    Poco::File(directory).remove(true);
+
+    TS_ASSERT_THROWS(ads.retrieve("spilled"),
+                     Mantid::Kernel::Exception::NotFoundError);
+    TS_ASSERT(ads.isSpilled("spilled"));
+    ads.clear();
+  }
+
 private:
+  /// Registers the stand-ins for the spilling algorithms while in scope
+  struct SpillAlgorithms {
+    SpillAlgorithms() {
+      AlgorithmFactory::Instance().subscribe<FakeSpillSaver>();
+      AlgorithmFactory::Instance().subscribe<FakeSpillLoader>();
+    }
+    ~SpillAlgorithms() {
+      AlgorithmFactory::Instance().unsubscribe("SaveNexusProcessed", 1);
+      AlgorithmFactory::Instance().unsubscribe("LoadNexusProcessed", 1);
+    }
+  };
+
+  std::string spillDirectory() {
+    Poco::Path path(Poco::Path::temp());
+    path.pushDirectory("AnalysisDataServiceTest_spill");
+    return path.toString();
+  }
+
   /// If replace=true then usea addOrReplace
   void doAddingOnInvalidNameTests(bool replace) {
     const std::string illegalChars = " +-/*\\%<>&|^~=!@()[]{},:.`$'\"?";
@@ -0,0 +1,92 @@
+#ifndef MANTID_API_AUTODIFFFUNCTION1DTEST_H_
+#define MANTID_API_AUTODIFFFUNCTION1DTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AutoDiffFunction1D.h"
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
+
+using namespace Mantid::API;
+
+namespace {
+/// f(x) = a * exp(-b * x) + c * x^2
+class AutoDiffFunction1DTest_Function
+    : public AutoDiffFunction1D<AutoDiffFunction1DTest_Function, 3> {
+public:
+  std::string name() const override {
+    return "AutoDiffFunction1DTest_Function";
+  }
+  template <typename T>
+  T evaluate(const double x, const std::array<T, 3> &p) const {
+    using std::exp;
+    return p[0] * exp(-p[1] * x) + p[2] * x * x;
+  }
+  void declareExtraParameter() { declareParameter("d"); }
+
+protected:
+  void init() override {
+    declareParameter("a", 1.1);
+    declareParameter("b", 0.5);
+    declareParameter("c", -0.3);
+  }
+};
+
+class AutoDiffFunction1DTest_Jacobian : public Jacobian {
+public:
+  AutoDiffFunction1DTest_Jacobian(size_t ny, size_t np) : m_np(np) {
+    m_data.resize(ny * np);
+  }
+  void set(size_t iY, size_t iP, double value) override {
+    m_data[iY * m_np + iP] = value;
+  }
+  double get(size_t iY, size_t iP) override { return m_data[iY * m_np + iP]; }
+  void zero() override { m_data.assign(m_data.size(), 0.0); }
+
+private:
+  size_t m_np;
+  std::vector<double> m_data;
+};
+}
+
+class AutoDiffFunction1DTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AutoDiffFunction1DTest *createSuite() {
+    return new AutoDiffFunction1DTest();
+  }
+  static void destroySuite(AutoDiffFunction1DTest *suite) { delete suite; }
+
+  void test_values_and_derivatives() {
+    AutoDiffFunction1DTest_Function function;
+    function.initialize();
+    FunctionDomain1DVector domain(0.0, 2.0, 11);
+    FunctionValues values(domain);
+    function.function(domain, values);
+    AutoDiffFunction1DTest_Jacobian jacobian(domain.size(), 3);
+    function.functionDeriv(domain, jacobian);
+
+    for (size_t i = 0; i < domain.size(); ++i) {
+      const double x = domain[i];
+      TS_ASSERT_DELTA(values.getCalculated(i),
+                      1.1 * std::exp(-0.5 * x) - 0.3 * x * x, 1e-14);
+      TS_ASSERT_DELTA(jacobian.get(i, 0), std::exp(-0.5 * x), 1e-14);
+      TS_ASSERT_DELTA(jacobian.get(i, 1), -1.1 * x * std::exp(-0.5 * x),
+                      1e-14);
+      TS_ASSERT_DELTA(jacobian.get(i, 2), x * x, 1e-14);
+    }
+  }
+
+  void test_wrong_number_of_parameters_throws() {
+    AutoDiffFunction1DTest_Function function;
+    function.initialize();
+    function.declareExtraParameter();
+    FunctionDomain1DVector domain(0.0, 2.0, 11);
+    AutoDiffFunction1DTest_Jacobian jacobian(domain.size(), 4);
+    TS_ASSERT_THROWS(function.functionDeriv(domain, jacobian),
+                     std::logic_error);
+  }
+};
+
+#endif /* MANTID_API_AUTODIFFFUNCTION1DTEST_H_ */
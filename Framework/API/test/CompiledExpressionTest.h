@@ -0,0 +1,123 @@
+#ifndef MANTID_API_COMPILEDEXPRESSIONTEST_H_
+#define MANTID_API_COMPILEDEXPRESSIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/CompiledExpression.h"
+
+#include <cmath>
+#include <stdexcept>
+
+using Mantid::API::CompiledExpression;
+
+class CompiledExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompiledExpressionTest *createSuite() {
+    return new CompiledExpressionTest();
+  }
+  static void destroySuite(CompiledExpressionTest *suite) { delete suite; }
+
+  void test_arithmetic() {
+    double a = 1.5;
+    double b = -0.5;
+    CompiledExpression expr("a*x^2 - b/x + (x-a)*(x+b) + 2^a - -x", {"x"},
+                            {{"a", &a}, {"b", &b}});
+    TS_ASSERT(expr.dependsOnArguments());
+    const auto x = points(1000);
+    std::vector<double> out(x.size());
+    expr.evaluate(x.data(), out.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      const double xi = x[i];
+      TS_ASSERT_DELTA(out[i], a * xi * xi - b / xi + (xi - a) * (xi + b) +
+                                  std::pow(2.0, a) + xi,
+                      1e-12);
+    }
+  }
+
+  void test_variables_are_read_at_every_call() {
+    double a = 1.0;
+    CompiledExpression expr("a*x", {"x"}, {{"a", &a}});
+    const std::vector<double> x{1.0, 2.0};
+    std::vector<double> out(2);
+    expr.evaluate(x.data(), out.data(), 2);
+    TS_ASSERT_EQUALS(out[1], 2.0);
+    a = 3.0;
+    expr.evaluate(x.data(), out.data(), 2);
+    TS_ASSERT_EQUALS(out[1], 6.0);
+  }
+
+  void test_functions() {
+    CompiledExpression expr(
+        "sin(x)+cos(x)*exp(-x)+sqrt(x)+ln(x)+erf(x)+abs(-x)+min(x,1,2)", {"x"},
+        {});
+    const auto x = points(300);
+    std::vector<double> out(x.size());
+    expr.evaluate(x.data(), out.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      const double xi = x[i];
+      TS_ASSERT_DELTA(out[i], std::sin(xi) + std::cos(xi) * std::exp(-xi) +
+                                  std::sqrt(xi) + std::log(xi) + std::erf(xi) +
+                                  xi + std::min(xi, 1.0),
+                      1e-12);
+    }
+  }
+
+  void test_expression_without_arguments_fills_the_output() {
+    double a = 2.0;
+    CompiledExpression expr("a^2 + _pi", {"x"}, {{"a", &a}});
+    TS_ASSERT(!expr.dependsOnArguments());
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> out(3);
+    expr.evaluate(x.data(), out.data(), 3);
+    for (auto value : out)
+      TS_ASSERT_DELTA(value, 4.0 + M_PI, 1e-15);
+  }
+
+  void test_several_arguments() {
+    CompiledExpression expr("x*y - z", {"x", "y", "z"}, {});
+    const std::vector<double> x{1.0, 2.0};
+    const std::vector<double> y{3.0, 4.0};
+    const std::vector<double> z{0.5, 1.5};
+    std::vector<double> out(2);
+    expr.evaluate({x.data(), y.data(), z.data()}, out.data(), 2);
+    TS_ASSERT_EQUALS(out[0], 2.5);
+    TS_ASSERT_EQUALS(out[1], 6.5);
+    const std::vector<const double *> tooFew{x.data()};
+    TS_ASSERT_THROWS(expr.evaluate(tooFew, out.data(), 2),
+                     std::invalid_argument);
+  }
+
+  void test_output_can_overwrite_the_input() {
+    CompiledExpression expr("2*x+1", {"x"}, {});
+    auto x = points(700);
+    const auto expected = x;
+    expr.evaluate(x.data(), x.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+      TS_ASSERT_EQUALS(x[i], 2.0 * expected[i] + 1.0);
+  }
+
+  void test_unsupported_formulas_throw() {
+    TS_ASSERT_THROWS(CompiledExpression("x > 1", {"x"}, {}),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(CompiledExpression("y*x", {"x"}, {}),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(CompiledExpression("unknown(x)", {"x"}, {}),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(CompiledExpression("-x^2", {"x"}, {}),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(CompiledExpression("x^2^3", {"x"}, {}),
+                     std::invalid_argument);
+  }
+
+private:
+  std::vector<double> points(const size_t n) {
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; ++i)
+      x[i] = 0.1 + 0.01 * static_cast<double>(i);
+    return x;
+  }
+};
+
+#endif /* MANTID_API_COMPILEDEXPRESSIONTEST_H_ */
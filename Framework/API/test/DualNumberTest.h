@@ -0,0 +1,105 @@
+#ifndef MANTID_API_DUALNUMBERTEST_H_
+#define MANTID_API_DUALNUMBERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/DualNumber.h"
+
+using Mantid::API::DualNumber;
+
+class DualNumberTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DualNumberTest *createSuite() { return new DualNumberTest(); }
+  static void destroySuite(DualNumberTest *suite) { delete suite; }
+
+  void test_constant_has_zero_derivatives() {
+    DualNumber<2> c(3.5);
+    TS_ASSERT_EQUALS(c.value(), 3.5);
+    TS_ASSERT_EQUALS(c.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(c.derivative(1), 0.0);
+  }
+
+  void test_variable() {
+    auto a = DualNumber<2>::variable(3.5, 1);
+    TS_ASSERT_EQUALS(a.value(), 3.5);
+    TS_ASSERT_EQUALS(a.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(a.derivative(1), 1.0);
+  }
+
+  void test_arithmetic() {
+    const double av = 1.5, bv = -0.7;
+    const auto a = DualNumber<2>::variable(av, 0);
+    const auto b = DualNumber<2>::variable(bv, 1);
+
+    auto f = (2.0 * a + b - 1.0) * a / b - 3.0 / a + (a - 4.0) / 2.0;
+    TS_ASSERT_DELTA(f.value(), (2 * av + bv - 1) * av / bv - 3 / av +
+                                   (av - 4) / 2,
+                    1e-14);
+    TS_ASSERT_DELTA(f.derivative(0),
+                    (4 * av + bv - 1) / bv + 3 / (av * av) + 0.5, 1e-14);
+    TS_ASSERT_DELTA(f.derivative(1),
+                    av / bv - (2 * av + bv - 1) * av / (bv * bv), 1e-14);
+
+    auto g = -a;
+    g += b;
+    g *= b;
+    g -= 1.0 - a;
+    TS_ASSERT_DELTA(g.value(), (bv - av) * bv - 1 + av, 1e-14);
+    TS_ASSERT_DELTA(g.derivative(0), 1 - bv, 1e-14);
+    TS_ASSERT_DELTA(g.derivative(1), 2 * bv - av, 1e-14);
+  }
+
+  void test_comparisons_use_the_values() {
+    const auto a = DualNumber<1>::variable(1.0, 0);
+    const DualNumber<1> b(2.0);
+    TS_ASSERT(a < b);
+    TS_ASSERT(b > a);
+    TS_ASSERT(a < 1.5);
+    TS_ASSERT(0.5 < a);
+    TS_ASSERT(!(a > 1.0));
+  }
+
+  void test_functions() {
+    const double x = 0.3;
+    const auto a = DualNumber<1>::variable(x, 0);
+    checkFunction(exp(a), std::exp(x), std::exp(x));
+    checkFunction(log(a), std::log(x), 1 / x);
+    checkFunction(sqrt(a), std::sqrt(x), 0.5 / std::sqrt(x));
+    checkFunction(sin(a), std::sin(x), std::cos(x));
+    checkFunction(cos(a), std::cos(x), -std::sin(x));
+    checkFunction(tan(a), std::tan(x), 1 / std::pow(std::cos(x), 2));
+    checkFunction(atan(a), std::atan(x), 1 / (1 + x * x));
+    checkFunction(fabs(-a), x, 1.0);
+    checkFunction(erf(a), std::erf(x), 2 / std::sqrt(M_PI) * std::exp(-x * x));
+    checkFunction(erfc(a), std::erfc(x),
+                  -2 / std::sqrt(M_PI) * std::exp(-x * x));
+    checkFunction(pow(a, 2.0), x * x, 2 * x);
+    checkFunction(pow(a, 2.5), std::pow(x, 2.5), 2.5 * std::pow(x, 1.5));
+    checkFunction(pow(2.0, a), std::pow(2.0, x),
+                  std::pow(2.0, x) * std::log(2.0));
+    checkFunction(pow(a, a), std::pow(x, x),
+                  std::pow(x, x) * (std::log(x) + 1));
+  }
+
+  void test_pow_with_zero_base() {
+    const auto base = DualNumber<2>::variable(0.0, 0) * 0.0;
+    const auto exponent = DualNumber<2>::variable(0.5, 1);
+    const auto result = pow(base, exponent);
+    TS_ASSERT_EQUALS(result.value(), 0.0);
+    TS_ASSERT_EQUALS(result.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(result.derivative(1), 0.0);
+    const auto constantBase = pow(0.0, exponent);
+    TS_ASSERT_EQUALS(constantBase.derivative(1), 0.0);
+  }
+
+private:
+  void checkFunction(const DualNumber<1> &result, const double value,
+                     const double derivative) {
+    TS_ASSERT_DELTA(result.value(), value, 1e-14);
+    TS_ASSERT_DELTA(result.derivative(0), derivative, 1e-13);
+  }
+};
+
+#endif /* MANTID_API_DUALNUMBERTEST_H_ */
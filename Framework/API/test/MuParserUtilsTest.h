@@ -4,6 +4,11 @@
 #include "MantidAPI/MuParserUtils.h"
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
 using namespace Mantid::API;
 
 class MuParserUtilsTest : public CxxTest::TestSuite {
@@ -20,7 +25,74 @@ public:
     TS_ASSERT(noVariablesDefined(parser));
   }
 
+  void test_differentiate() {
+    std::map<std::string, double> variables{
+        {"x", 0.7}, {"a", 1.3}, {"b", 0.4}, {"c", 2.1}};
+    const std::vector<std::string> formulas{
+        "a*x+b",
+        "h*sin(a*x-c)",
+        "a*exp(-b*x)/c",
+        "a/x/b",
+        "x^a+a^x+b^a",
+        "sqrt(a*x)+log(b)+ln(c)+log10(a)",
+        "erf(a*x)*erfc(b)",
+        "a*x^2-b/x^-2",
+        "(a+b)*(b-c)/(a*c)",
+        "tanh(a)+atan(b*x)+asinh(c)+acosh(c)+atanh(b)+asin(b)+acos(b)",
+        "tan(a)+cosh(b)+sinh(c)+abs(a-c)",
+        "a*-b-(a+c)",
+        "1/(1+exp(-(x-a)/b))"};
+    variables["h"] = 2.2;
+    for (const auto &formula : formulas) {
+      for (const std::string name : {"a", "b", "c", "h"}) {
+        checkDerivative(formula, name, variables);
+      }
+    }
+  }
+
+  void test_differentiate_squares() {
+    std::map<std::string, double> variables{{"x", 0.7}, {"a", 1.3}, {"b", 0.4}};
+    checkDerivative("(x-a)^2", "a", variables);
+    checkDerivative("b^2", "b", variables);
+    checkDerivative("a*(x-b)^2+b^3", "b", variables);
+  }
+
+  void test_differentiate_throws_for_unsupported_formulas() {
+    for (const auto &formula : {"x>a", "max(a,x)", "a*(x>0)", "a^b^x"}) {
+      TS_ASSERT_THROWS(MuParserUtils::differentiate(formula, "a"),
+                       std::invalid_argument);
+    }
+  }
+
 private:
+  static void checkDerivative(const std::string &formula,
+                              const std::string &name,
+                              std::map<std::string, double> &variables) {
+    std::string derivative;
+    TS_ASSERT_THROWS_NOTHING(
+        derivative = MuParserUtils::differentiate(formula, name));
+    const double step = 1e-6;
+    const double value = variables[name];
+    variables[name] = value + step;
+    const double plus = evaluate(formula, variables);
+    variables[name] = value - step;
+    const double minus = evaluate(formula, variables);
+    variables[name] = value;
+    TSM_ASSERT_DELTA(formula + " by " + name, evaluate(derivative, variables),
+                     (plus - minus) / (2 * step), 1e-6);
+  }
+
+  static double evaluate(const std::string &formula,
+                         std::map<std::string, double> &variables) {
+    mu::Parser parser;
+    MuParserUtils::extraOneVarFunctions(parser);
+    for (auto &variable : variables) {
+      parser.DefineVar(variable.first, &variable.second);
+    }
+    parser.SetExpr(formula);
+    return parser.Eval();
+  }
+
   static bool extraOneVarFunctionsDefined(const mu::Parser &parser) {
     const auto functionMap = parser.GetFunDef();
     for (const auto pair : MuParserUtils::MUPARSER_ONEVAR_FUNCTIONS) {
@@ -7,6 +7,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/FileFinder.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Property.h"
 #include "MantidTestHelpers/NexusTestHelper.h"
 #include "Poco/File.h"
@@ -129,6 +130,87 @@ public:
     TS_ASSERT_THROWS(emptyHistory.lastAlgorithm(), std::out_of_range);
     TS_ASSERT_THROWS(emptyHistory.getAlgorithm(1), std::out_of_range);
   }
+
+  void test_copies_are_independent() {
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("First", 1));
+    history.addHistory(makeHistory("Second", 2));
+    WorkspaceHistory copy(history);
+    copy.addHistory(makeHistory("Third", 3));
+    history.addHistory(makeHistory("Fourth", 4));
+
+    TS_ASSERT_EQUALS(history.size(), 3);
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(2)->name(), "Fourth");
+    TS_ASSERT_EQUALS(copy.size(), 3);
+    TS_ASSERT_EQUALS(copy.getAlgorithmHistory(1)->name(), "Second");
+    TS_ASSERT_EQUALS(copy.getAlgorithmHistory(2)->name(), "Third");
+  }
+
+  void test_adding_histories_merges_them_in_execution_order() {
+    WorkspaceHistory first;
+    first.addHistory(makeHistory("First", 1));
+    WorkspaceHistory second(first);
+    second.addHistory(makeHistory("Second", 2));
+    first.addHistory(makeHistory("Third", 3));
+
+    first.addHistory(second);
+    first.addHistory(second);
+    TS_ASSERT_EQUALS(first.size(), 3);
+    TS_ASSERT_EQUALS(first.getAlgorithmHistory(0)->name(), "First");
+    TS_ASSERT_EQUALS(first.getAlgorithmHistory(1)->name(), "Second");
+    TS_ASSERT_EQUALS(first.getAlgorithmHistory(2)->name(), "Third");
+    TS_ASSERT_EQUALS(second.size(), 2);
+  }
+
+  void test_long_chains_of_copies() {
+    // Every step copies the history like an algorithm with a new output
+    auto history = Mantid::Kernel::make_unique<WorkspaceHistory>();
+    for (size_t i = 0; i < 1000; ++i) {
+      auto output = Mantid::Kernel::make_unique<WorkspaceHistory>(*history);
+      output->addHistory(*history);
+      output->addHistory(makeHistory("Step", i));
+      history = std::move(output);
+    }
+    TS_ASSERT_EQUALS(history->size(), 1000);
+    TS_ASSERT_EQUALS(history->getAlgorithmHistory(999)->execCount(), 999);
+  }
+
+  void test_histories_read_before_changes_are_unaffected() {
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("First", 1));
+    WorkspaceHistory copy(history);
+    copy.addHistory(makeHistory("Second", 2));
+    const auto before = copy.getAlgorithmHistories();
+    copy.addHistory(makeHistory("Third", 3));
+    copy.clearHistory();
+    TS_ASSERT_EQUALS(before.size(), 2);
+    TS_ASSERT_EQUALS((*before.rbegin())->name(), "Second");
+  }
+
+  void test_concurrent_copies_and_appends() {
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("First", 0));
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 1; i < 200; ++i) {
+      if (i % 2 == 0) {
+        history.addHistory(makeHistory("Step", i));
+      } else {
+        WorkspaceHistory copy(history);
+        copy.addHistory(makeHistory("Copy", i));
+        TS_ASSERT_LESS_THAN_EQUALS(2, copy.size());
+        TS_ASSERT_EQUALS(copy.getAlgorithmHistory(0)->name(), "First");
+      }
+    }
+    TS_ASSERT_EQUALS(history.size(), 100);
+  }
+
+private:
+  AlgorithmHistory_sptr makeHistory(const std::string &name,
+                                    const size_t execCount) {
+    return boost::make_shared<AlgorithmHistory>(
+        name, 1, Mantid::Types::Core::DateAndTime::defaultTime(), 1.0,
+        execCount);
+  }
 };
 
 class WorkspaceHistoryTestPerformance : public CxxTest::TestSuite {
@@ -6,12 +6,14 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidTestHelpers/FakeObjects.h"
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <map>
 
 using namespace Mantid;
@@ -133,6 +135,38 @@ public:
     TS_ASSERT_EQUALS(distances.size(), 17);
   }
 
+  void testNeighbourFindingWithDetectorIndexMatchesANN() {
+    const auto ws = makeWorkspace(1, 18);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentCylindrical(2));
+
+    WorkspaceNearestNeighbours ann(8, ws->spectrumInfo(),
+                                   getSpectrumNumbers(*ws));
+    WorkspaceNearestNeighbours indexed(
+        8, ws->spectrumInfo(), getSpectrumNumbers(*ws), false,
+        ws->componentInfo().neighbourIndex());
+
+    for (specnum_t spectrum = 1; spectrum <= 18; ++spectrum) {
+      const auto expected = ann.neighbours(spectrum);
+      const auto actual = indexed.neighbours(spectrum);
+      TS_ASSERT_EQUALS(actual.size(), expected.size());
+      std::vector<double> expectedNorms, actualNorms;
+      for (const auto &neighbour : expected)
+        expectedNorms.push_back(neighbour.second.norm());
+      for (const auto &neighbour : actual)
+        actualNorms.push_back(neighbour.second.norm());
+      std::sort(expectedNorms.begin(), expectedNorms.end());
+      std::sort(actualNorms.begin(), actualNorms.end());
+      const size_t n = std::min(expectedNorms.size(), actualNorms.size());
+      for (size_t i = 0; i < n; ++i)
+        TS_ASSERT_DELTA(actualNorms[i], expectedNorms[i], 1e-12);
+    }
+
+    TS_ASSERT(indexed.neighboursInRadius(14, 0.003).empty());
+    TS_ASSERT_EQUALS(indexed.neighboursInRadius(14, 0.008).size(), 4);
+    TS_ASSERT_EQUALS(indexed.neighboursInRadius(14, 6.0).size(), 17);
+  }
+
   void testNeighbourFindingWithNeighbourNumberSpecified() {
     doTestWithNeighbourNumbers(1, 1);
     doTestWithNeighbourNumbers(2, 2);
@@ -115,6 +115,8 @@ protected:
 
   API::MatrixWorkspace_sptr m_inputWS;    ///< A pointer to the input workspace
   const Geometry::Object *m_sampleObject; ///< Local cache of sample object.
+  /// Meshed copy of the sample shape used only for tracing the paths
+  boost::shared_ptr<const Geometry::Object> m_meshedSampleObject;
   Kernel::V3D m_beamDirection;            ///< The direction of the beam.
   std::vector<double> m_L1s,              ///< Cached L1 distances
       m_elementVolumes;                   ///< Cached element volumes
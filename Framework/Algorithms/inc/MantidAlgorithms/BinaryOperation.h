@@ -1,6 +1,7 @@
 #ifndef MANTID_ALGORITHMS_BINARYOPERATION_H_
 #define MANTID_ALGORITHMS_BINARYOPERATION_H_
 
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
@@ -10,6 +11,8 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/System.h"
 
+#include <boost/optional.hpp>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -153,6 +156,17 @@ protected:
                                       const double rhsE, MantidVec &YOut,
                                       MantidVec &EOut) = 0;
 
+  /** Overridden by operations that BinaryOperationKernels implements. When
+   * the output is a histogram the kernel then runs over the whole workspace
+   * and performBinaryOperation is not called.
+   *  @return The kernel operation, or none to call performBinaryOperation for
+   * each spectrum
+   */
+  virtual boost::optional<BinaryOperationKernels::Operation>
+  kernelOperation() const {
+    return boost::none;
+  }
+
   // ===================================== EVENT LIST BINARY OPERATIONS
   // ==========================================
 
@@ -277,6 +291,10 @@ private:
   void doSingleSpectrum();
   void doSingleColumn();
   void do2D(bool mismatchedSpectra);
+  void applyKernel(const BinaryOperationKernels::Operation operation,
+                   const BinaryOperationKernels::Broadcast broadcast,
+                   const std::vector<int64_t> &rhsIndices =
+                       std::vector<int64_t>());
 
   void propagateBinMasks(const API::MatrixWorkspace_const_sptr rhs,
                          API::MatrixWorkspace_sptr out);
@@ -0,0 +1,110 @@
+#ifndef MANTID_ALGORITHMS_BINARYOPERATIONKERNELS_H_
+#define MANTID_ALGORITHMS_BINARYOPERATIONKERNELS_H_
+
+#include "MantidAlgorithms/DllConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class MatrixWorkspace;
+}
+namespace Algorithms {
+/**
+  The arithmetic of Plus, Minus, Multiply and Divide on arrays of values and
+  errors, with the errors of the operands added in quadrature.
+
+  Each function has a form for an array on the right hand side and a form
+  for a single value. The loops have no branches and no calls to pow() so
+  that they vectorize. The output arrays may be the same as either input.
+
+  apply() runs an operation over every spectrum of a workspace in one
+  parallel loop, with the right hand side broadcast as a single value, a
+  single bin per spectrum or a single spectrum. The operation is chosen once
+  per spectrum, not once per bin, and there is no virtual call.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace BinaryOperationKernels {
+
+/// The operations the kernels implement
+enum class Operation { Plus, Minus, Multiply, Divide };
+
+/// How the right hand side is spread over the spectra of the left hand side
+enum class Broadcast {
+  None,          ///< One right hand spectrum of the same size per spectrum
+  SingleValue,   ///< The first value of the right hand side for every bin
+  SingleBin,     ///< One value per spectrum for every bin of the spectrum
+  SingleSpectrum ///< The first right hand spectrum for every spectrum
+};
+
+MANTID_ALGORITHMS_DLL void plus(const double *lhsY, const double *lhsE,
+                                const double *rhsY, const double *rhsE,
+                                double *outY, double *outE, const size_t n);
+MANTID_ALGORITHMS_DLL void plus(const double *lhsY, const double *lhsE,
+                                const double rhsY, const double rhsE,
+                                double *outY, double *outE, const size_t n);
+
+MANTID_ALGORITHMS_DLL void minus(const double *lhsY, const double *lhsE,
+                                 const double *rhsY, const double *rhsE,
+                                 double *outY, double *outE, const size_t n);
+MANTID_ALGORITHMS_DLL void minus(const double *lhsY, const double *lhsE,
+                                 const double rhsY, const double rhsE,
+                                 double *outY, double *outE, const size_t n);
+
+MANTID_ALGORITHMS_DLL void multiply(const double *lhsY, const double *lhsE,
+                                    const double *rhsY, const double *rhsE,
+                                    double *outY, double *outE,
+                                    const size_t n);
+MANTID_ALGORITHMS_DLL void multiply(const double *lhsY, const double *lhsE,
+                                    const double rhsY, const double rhsE,
+                                    double *outY, double *outE,
+                                    const size_t n);
+
+MANTID_ALGORITHMS_DLL void divide(const double *lhsY, const double *lhsE,
+                                  const double *rhsY, const double *rhsE,
+                                  double *outY, double *outE, const size_t n);
+MANTID_ALGORITHMS_DLL void divide(const double *lhsY, const double *lhsE,
+                                  const double rhsY, const double rhsE,
+                                  double *outY, double *outE, const size_t n);
+
+MANTID_ALGORITHMS_DLL void apply(const Operation operation,
+                                 const double *lhsY, const double *lhsE,
+                                 const double *rhsY, const double *rhsE,
+                                 double *outY, double *outE, const size_t n);
+MANTID_ALGORITHMS_DLL void apply(const Operation operation,
+                                 const double *lhsY, const double *lhsE,
+                                 const double rhsY, const double rhsE,
+                                 double *outY, double *outE, const size_t n);
+
+MANTID_ALGORITHMS_DLL void
+apply(const Operation operation, const Broadcast broadcast,
+      const API::MatrixWorkspace &lhs, const API::MatrixWorkspace &rhs,
+      API::MatrixWorkspace &out,
+      const std::vector<int64_t> &rhsIndices = std::vector<int64_t>());
+
+} // namespace BinaryOperationKernels
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_BINARYOPERATIONKERNELS_H_ */
@@ -56,6 +56,9 @@ public:
   /// Algorithm's Alternate Name
   const std::string alias() const override { return "OffsetX"; }
 
+  HistogramOperation
+  deferredOperation(const API::MatrixWorkspace &workspace) override;
+
 private:
   /// Initialisation method. Declares properties to be used in algorithm.
   void init() override;
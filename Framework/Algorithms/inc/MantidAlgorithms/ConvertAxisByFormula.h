@@ -13,6 +13,7 @@ class Parser;
 namespace Mantid {
 
 namespace API {
+class CompiledExpression;
 class SpectrumInfo;
 }
 
@@ -75,7 +76,8 @@ private:
   typedef boost::shared_ptr<Variable> Variable_ptr;
 
   void setAxisValue(const double &value, std::vector<Variable_ptr> &variables);
-  void calculateValues(mu::Parser &p, std::vector<double> &vec,
+  void calculateValues(mu::Parser &p, const API::CompiledExpression *compiled,
+                       std::vector<double> &vec,
                        std::vector<Variable_ptr> variables);
   void setGeometryValues(const API::SpectrumInfo &specInfo, const size_t index,
                          std::vector<Variable_ptr> &variables);
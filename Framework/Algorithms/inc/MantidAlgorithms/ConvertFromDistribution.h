@@ -4,7 +4,7 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
-#include "MantidAPI/Algorithm.h"
+#include "MantidAlgorithms/SpectrumAlgorithm.h"
 
 namespace Mantid {
 namespace Algorithms {
@@ -40,7 +40,7 @@ namespace Algorithms {
     File change history is stored at: <https://github.com/mantidproject/mantid>
     Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
-class DLLExport ConvertFromDistribution : public API::Algorithm {
+class DLLExport ConvertFromDistribution : public SpectrumAlgorithm {
 public:
   /// Algorithm's name
   const std::string name() const override { return "ConvertFromDistribution"; }
@@ -56,6 +56,9 @@ public:
     return "Transforms\\Distribution";
   }
 
+  HistogramOperation
+  deferredOperation(const API::MatrixWorkspace &workspace) override;
+
 private:
   /// Initialisation code
   void init() override;
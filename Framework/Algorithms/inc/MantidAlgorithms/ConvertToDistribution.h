@@ -4,7 +4,7 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
-#include "MantidAPI/Algorithm.h"
+#include "MantidAlgorithms/SpectrumAlgorithm.h"
 
 namespace Mantid {
 namespace Algorithms {
@@ -39,7 +39,7 @@ namespace Algorithms {
     File change history is stored at: <https://github.com/mantidproject/mantid>
     Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
-class DLLExport ConvertToDistribution : public API::Algorithm {
+class DLLExport ConvertToDistribution : public SpectrumAlgorithm {
 public:
   /// Algorithm's name
   const std::string name() const override { return "ConvertToDistribution"; }
@@ -55,6 +55,9 @@ public:
     return "Transforms\\Distribution";
   }
 
+  HistogramOperation
+  deferredOperation(const API::MatrixWorkspace &workspace) override;
+
 protected:
   /// Validate inputs
   std::map<std::string, std::string> validateInputs() override;
@@ -99,6 +99,7 @@ protected:
   // Overridden Algorithm methods
   void init() override;
   void exec() override;
+  bool canProcessGroupsInParallel() const override { return true; }
 
   void setupMemberVariables(const API::MatrixWorkspace_const_sptr inputWS);
   virtual void storeEModeOnWorkspace(API::MatrixWorkspace_sptr outputWS);
@@ -88,6 +88,7 @@ private:
   void init() override;
   /// Execution code
   void exec() override;
+  bool canProcessGroupsInParallel() const override { return true; }
 };
 
 } // namespace Algorithms
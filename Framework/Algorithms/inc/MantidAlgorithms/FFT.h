@@ -8,8 +8,9 @@
 #include "MantidAPI/Workspace_fwd.h"
 #include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/Points.h"
+#include "MantidKernel/Math/FourierTransform.h"
 #include "MantidKernel/cow_ptr.h"
-#include <gsl/gsl_fft_complex.h>
+#include <memory>
 
 namespace boost {
 template <typename T> class shared_array;
@@ -96,8 +97,7 @@ private:
   Mantid::API::MatrixWorkspace_const_sptr m_inWS;
   Mantid::API::MatrixWorkspace_const_sptr m_inImagWS;
   Mantid::API::MatrixWorkspace_sptr m_outWS;
-  gsl_fft_complex_wavetable *m_wavetable;
-  gsl_fft_complex_workspace *m_workspace;
+  std::unique_ptr<Kernel::ComplexFourierTransform> m_transform;
   int m_iIm;
   int m_iRe;
   int m_iAbs;
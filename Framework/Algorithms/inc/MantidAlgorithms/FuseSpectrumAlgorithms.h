@@ -0,0 +1,58 @@
+#ifndef MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMS_H_
+#define MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMS_H_
+
+#include "MantidAlgorithms/DllConfig.h"
+#include "MantidAPI/Algorithm.h"
+
+namespace Mantid {
+namespace Algorithms {
+
+/** FuseSpectrumAlgorithms runs a chain of SpectrumAlgorithms deferred: the
+  algorithms are only configured, and their operations on single histograms
+  are then applied one after the other to each histogram in a single pass.
+  This creates one output workspace instead of one per step, and reads each
+  spectrum from memory once.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_ALGORITHMS_DLL FuseSpectrumAlgorithms : public API::Algorithm {
+public:
+  const std::string name() const override { return "FuseSpectrumAlgorithms"; }
+  int version() const override { return 1; }
+  const std::string category() const override {
+    return "Utility\\Workspaces";
+  }
+  const std::string summary() const override {
+    return "Runs a chain of algorithms that transform each spectrum on its "
+           "own in a single pass over the workspace.";
+  }
+
+private:
+  void init() override;
+  void exec() override;
+  std::map<std::string, std::string> validateInputs() override;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMS_H_ */
@@ -83,6 +83,8 @@ protected:
   /// workspaces
   void fillHistory() override;
 
+  bool canProcessGroupsInParallel() const override { return true; }
+
 private:
   // Overridden Algorithm methods
   void init() override;
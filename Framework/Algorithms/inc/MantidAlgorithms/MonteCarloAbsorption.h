@@ -70,6 +70,8 @@ private:
       const bool useSparseInstrument, const size_t maxScatterPtAttempts);
   API::MatrixWorkspace_uptr
   createOutputWorkspace(const API::MatrixWorkspace &inputWS) const;
+  std::unique_ptr<API::Sample>
+  createMeshedSample(const API::Sample &sample) const;
   std::unique_ptr<IBeamProfile>
   createBeamProfile(const Geometry::Instrument &instrument,
                     const API::Sample &sample) const;
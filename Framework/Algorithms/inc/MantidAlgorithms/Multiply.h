@@ -59,6 +59,10 @@ public:
 
 private:
   // Overridden BinaryOperation methods
+  boost::optional<BinaryOperationKernels::Operation>
+  kernelOperation() const override {
+    return BinaryOperationKernels::Operation::Multiply;
+  }
   void performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                               const MantidVec &lhsE, const MantidVec &rhsY,
                               const MantidVec &rhsE, MantidVec &YOut,
@@ -70,6 +70,7 @@ private:
   // Overridden Algorithm methods
   void init() override;
   void exec() override;
+  bool canProcessGroupsInParallel() const override { return true; }
   // Extract the charge value from the logs.
   double extractCharge(boost::shared_ptr<Mantid::API::MatrixWorkspace> inputWS,
                        const bool integratePCharge) const;
@@ -91,6 +91,8 @@ protected:
   void propagateMasks(API::MatrixWorkspace_const_sptr inputWS,
                       API::MatrixWorkspace_sptr outputWS, int hist);
 
+  bool canProcessGroupsInParallel() const override { return true; }
+
   Parallel::ExecutionMode getParallelExecutionMode(
       const std::map<std::string, Parallel::StorageMode> &storageModes)
       const override;
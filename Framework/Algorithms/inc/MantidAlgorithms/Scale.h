@@ -4,7 +4,7 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
-#include "MantidAPI/Algorithm.h"
+#include "MantidAlgorithms/SpectrumAlgorithm.h"
 
 namespace Mantid {
 namespace Algorithms {
@@ -46,7 +46,7 @@ namespace Algorithms {
     File change history is stored at: <https://github.com/mantidproject/mantid>
     Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
-class DLLExport Scale : public API::Algorithm {
+class DLLExport Scale : public SpectrumAlgorithm {
 public:
   /// Algorithm's name
   const std::string name() const override { return "Scale"; }
@@ -63,6 +63,9 @@ public:
     return "Arithmetic;CorrectionFunctions";
   }
 
+  HistogramOperation
+  deferredOperation(const API::MatrixWorkspace &workspace) override;
+
 private:
   /// Initialisation code
   void init() override;
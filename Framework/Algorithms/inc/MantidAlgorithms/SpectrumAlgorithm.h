@@ -1,12 +1,15 @@
 #ifndef MANTID_ALGORITHMS_SPECTRUMALGORITHM_H_
 #define MANTID_ALGORITHMS_SPECTRUMALGORITHM_H_
 
+#include <functional>
 #include <tuple>
+#include <vector>
 
 #include "MantidKernel/IndexSet.h"
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidAlgorithms/DllConfig.h"
+#include "MantidHistogramData/Histogram.h"
 
 namespace Mantid {
 
@@ -24,8 +27,13 @@ namespace Algorithms {
   provides:
   1. The method for_each() that can be used to implement loops/transformations
      of spectra or event lists in a workspace.
-  2. A way to define generic properties to allow user specified spectrum number
+  2. The method transformX() that transforms bin edges or points once per
+     distinct X array instead of once per spectrum.
+  3. A way to define generic properties to allow user specified spectrum number
      ranges and list.
+  4. The method deferredOperation() through which algorithms that only
+     transform each histogram on its own can be run deferred, fused with
+     others in a single pass by FuseSpectrumAlgorithms.
 
   @author Simon Heybrock, ESS
 
@@ -51,6 +59,14 @@ namespace Algorithms {
   Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
 class MANTID_ALGORITHMS_DLL SpectrumAlgorithm : public API::Algorithm {
+public:
+  /// The work of an algorithm on the histogram with a given workspace index
+  typedef std::function<void(const size_t, HistogramData::Histogram &)>
+      HistogramOperation;
+
+  virtual HistogramOperation
+  deferredOperation(const API::MatrixWorkspace &workspace);
+
 private:
   /** Helpers for for_each(), struct seq and gens with a specialization.
    *
@@ -108,6 +124,10 @@ private:
     UNUSED_ARG(workspace);
   }
 
+  void transformX(API::MatrixWorkspace &workspace,
+                  const Kernel::IndexSet &indexSet,
+                  const std::function<void(std::vector<double> &)> &operation);
+
   std::string m_indexMinPropertyName;
   std::string m_indexMaxPropertyName;
   std::string m_indexRangePropertyName;
@@ -156,6 +176,23 @@ protected:
                        typename gens<sizeof...(Args)>::type(), operation);
   }
 
+  /** Applies an operation to the X arrays of the spectra in a workspace.
+   *
+   * Spectra that share an X array are transformed together: the operation is
+   * applied once to a copy of the array, which the spectra then share. For
+   * the common case of identical bins this avoids allocating and transforming
+   * an array per spectrum.
+   * @tparam Flags Variable number of flags, see struct Indices.
+   * @param workspace Workspace to work with.
+   * @param operation Callable that modifies an X array in place. */
+  template <class... Flags, class WS, class OP>
+  void transformX(WS &workspace, const OP &operation) {
+    Kernel::IndexSet indexSet(workspace.getNumberHistograms());
+    if (contains<Indices::FromProperty, Flags...>())
+      indexSet = getWorkspaceIndexSet(workspace);
+    transformX(workspace, indexSet, operation);
+  }
+
   void declareWorkspaceIndexSetProperties(
       const std::string &indexMinPropertyName = "IndexMin",
       const std::string &indexMaxPropertyName = "IndexMax",
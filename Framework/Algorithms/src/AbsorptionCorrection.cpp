@@ -75,6 +75,10 @@ void AbsorptionCorrection::init() {
       boost::make_shared<StringListValidator>(exp_options),
       "Select the method to use to calculate exponentials, normal or a\n"
       "fast approximation (default: Normal)");
+  declareProperty("UseMeshAcceleration", false,
+                  "Trace the paths through a triangle mesh of the sample "
+                  "shape, which is faster but approximates curved surfaces "
+                  "by their triangulation.");
 
   std::vector<std::string> propOptions{"Elastic", "Direct", "Indirect"};
   declareProperty("EMode", "Elastic",
@@ -302,6 +306,19 @@ void AbsorptionCorrection::constructSample(API::Sample &sample) {
 
     g_log.information("Successfully constructed the sample object");
   }
+
+  const bool useMesh = getProperty("UseMeshAcceleration");
+  if (useMesh) {
+    auto meshed = boost::make_shared<Object>(*m_sampleObject);
+    if (meshed->setMeshAcceleration(true)) {
+      // The output sample keeps the exact shape
+      m_meshedSampleObject = meshed;
+      m_sampleObject = m_meshedSampleObject.get();
+    } else {
+      g_log.warning("The sample shape could not be triangulated. The paths "
+                    "are traced through the exact shape.\n");
+    }
+  }
 }
 
 /// Calculate the distances traversed by the neutrons within the sample
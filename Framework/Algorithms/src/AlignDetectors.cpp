@@ -44,12 +44,13 @@ public:
     this->generateDetidToRow(table);
   }
 
-  std::function<double(double)>
-  getConversionFunc(const std::set<detid_t> &detIds) const {
+  /// Average diffractometer constants of the given detectors
+  void getDiffConstants(const std::set<detid_t> &detIds, double &difc,
+                        double &difa, double &tzero) const {
     const std::set<size_t> rows = this->getRow(detIds);
-    double difc = 0.;
-    double difa = 0.;
-    double tzero = 0.;
+    difc = 0.;
+    difa = 0.;
+    tzero = 0.;
     for (auto row : rows) {
       difc += m_difcCol->toDouble(row);
       difa += m_difaCol->toDouble(row);
@@ -61,8 +62,6 @@ public:
       difa = norm * difa;
       tzero = norm * tzero;
     }
-
-    return Kernel::Diffraction::getTofToDConversionFunc(difc, difa, tzero);
   }
 
 private:
@@ -278,10 +277,21 @@ void AlignDetectors::align(const ConversionFactors &converter,
     try {
       // Get the input spectrum number at this workspace index
       auto &spec = outputWS.getSpectrum(size_t(i));
-      auto toDspacing = converter.getConversionFunc(spec.getDetectorIDs());
+      double difc, difa, tzero;
+      converter.getDiffConstants(spec.getDetectorIDs(), difc, difa, tzero);
 
       auto &x = outputWS.mutableX(i);
-      std::transform(x.begin(), x.end(), x.begin(), toDspacing);
+      if (difa == 0.) {
+        // d = (TOF - tzero) / difc is affine, so skip the function object
+        const double factor = 1. / difc;
+        const double offset = -tzero * factor;
+        for (auto &value : x)
+          value = value * factor + offset;
+      } else {
+        auto toDspacing =
+            Kernel::Diffraction::getTofToDConversionFunc(difc, difa, tzero);
+        std::transform(x.begin(), x.end(), x.begin(), toDspacing);
+      }
     } catch (Exception::NotFoundError &) {
       // Zero the data in this case
       outputWS.setHistogram(i, BinEdges(outputWS.x(i).size()),
@@ -299,9 +309,17 @@ void AlignDetectors::align(const ConversionFactors &converter,
   for (int64_t i = 0; i < m_numberOfSpectra; ++i) {
     PARALLEL_START_INTERUPT_REGION
 
-    auto toDspacing = converter.getConversionFunc(
-        outputWS.getSpectrum(size_t(i)).getDetectorIDs());
-    outputWS.getSpectrum(i).convertTof(toDspacing);
+    auto &spec = outputWS.getSpectrum(size_t(i));
+    double difc, difa, tzero;
+    converter.getDiffConstants(spec.getDetectorIDs(), difc, difa, tzero);
+    if (difa == 0.) {
+      // d = (TOF - tzero) / difc is affine and keeps the events sorted
+      const double factor = 1. / difc;
+      spec.convertTof(factor, -tzero * factor);
+    } else {
+      spec.convertTof(
+          Kernel::Diffraction::getTofToDConversionFunc(difc, difa, tzero));
+    }
 
     progress.report();
     PARALLEL_END_INTERUPT_REGION
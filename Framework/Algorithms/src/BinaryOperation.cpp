@@ -485,6 +485,8 @@ void BinaryOperation::doSingleValue() {
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+  } else if (const auto operation = kernelOperation()) {
+    applyKernel(*operation, BinaryOperationKernels::Broadcast::SingleValue);
   } else {
     // ---- Histogram Output -----
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
@@ -538,6 +540,17 @@ void BinaryOperation::doSingleColumn() {
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+  } else if (const auto operation = kernelOperation()) {
+    // Masked spectra are left out
+    std::vector<int64_t> rhsIndices(numHists);
+    for (int64_t i = 0; i < numHists; ++i) {
+      rhsIndices[i] = propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo, i,
+                                           *m_out, outSpectrumInfo)
+                          ? i
+                          : -1;
+    }
+    applyKernel(*operation, BinaryOperationKernels::Broadcast::SingleBin,
+                rhsIndices);
   } else {
     // ---- Histogram Output -----
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_lhs, *m_rhs, *m_out))
@@ -622,6 +635,8 @@ void BinaryOperation::doSingleSpectrum() {
       PARALLEL_CHECK_INTERUPT_REGION
     }
 
+  } else if (const auto operation = kernelOperation()) {
+    applyKernel(*operation, BinaryOperationKernels::Broadcast::SingleSpectrum);
   } else {
     // -------- The output is a histogram ----------
     // (inputs can be EventWorkspaces, but their histogram representation
@@ -747,6 +762,30 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
       PARALLEL_CHECK_INTERUPT_REGION
     }
 
+  } else if (const auto operation = kernelOperation()) {
+    // Spectra without a match on the rhs, or masked, are left out
+    const int64_t numHists = m_lhs->getNumberHistograms();
+    std::vector<int64_t> rhsIndices(numHists);
+    for (int64_t i = 0; i < numHists; ++i) {
+      if (mismatchedSpectra && table) {
+        rhsIndices[i] = (*table)[i];
+      } else {
+        rhsIndices[i] = propagateSpectraMask(lhsSpectrumInfo, rhsSpectrumInfo,
+                                             i, *m_out, outSpectrumInfo)
+                            ? i
+                            : -1;
+      }
+    }
+    applyKernel(*operation, BinaryOperationKernels::Broadcast::None,
+                rhsIndices);
+
+    // Free up memory on the RHS if that is possible
+    if (m_ClearRHSWorkspace) {
+      for (const auto rhsIndex : rhsIndices) {
+        if (rhsIndex >= 0)
+          const_cast<EventList &>(m_erhs->getSpectrum(rhsIndex)).clear();
+      }
+    }
   } else {
     // -------- The output is a histogram ----------
     // (inputs can be EventWorkspaces, but their histogram representation
@@ -795,6 +834,23 @@ void BinaryOperation::do2D(bool mismatchedSpectra) {
     m_erhs->clearMRU();
 }
 
+/**
+ * Runs the kernel of the operation over the whole histogram output, in place
+ * of the calls to performBinaryOperation for each spectrum.
+ * @param operation :: The operation of the kernel
+ * @param broadcast :: How the rhs is spread over the lhs
+ * @param rhsIndices :: The rhs spectrum for each lhs spectrum, -1 to leave it
+ * out. Empty if they are the same.
+ */
+void BinaryOperation::applyKernel(
+    const BinaryOperationKernels::Operation operation,
+    const BinaryOperationKernels::Broadcast broadcast,
+    const std::vector<int64_t> &rhsIndices) {
+  BinaryOperationKernels::apply(operation, broadcast, *m_lhs, *m_rhs, *m_out,
+                                rhsIndices);
+  m_progress->reportIncrement(m_lhs->getNumberHistograms(), this->name());
+}
+
 /** Copies any bin masking from the smaller/rhs input workspace to the output.
  *  Masks on the other input workspace are copied automatically by the workspace
  * factory.
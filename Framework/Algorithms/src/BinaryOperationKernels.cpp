@@ -0,0 +1,274 @@
+#include "MantidAlgorithms/BinaryOperationKernels.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Algorithms {
+namespace BinaryOperationKernels {
+
+namespace {
+/// Add two errors in quadrature
+inline double quadrature(const double a, const double b) {
+  return std::sqrt(a * a + b * b);
+}
+
+/// Errors of a sum or a difference with an array on the right hand side
+void sumErrors(const double *lhsE, const double *rhsE, double *outE,
+               const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    outE[i] = quadrature(lhsE[i], rhsE[i]);
+  }
+}
+
+/// Errors of a sum or a difference with a single value on the right hand side
+void sumErrors(const double *lhsE, const double rhsE, double *outE,
+               const size_t n) {
+  // A zero error leaves the errors unchanged
+  if (rhsE == 0.0) {
+    if (outE != lhsE)
+      std::copy(lhsE, lhsE + n, outE);
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    outE[i] = quadrature(lhsE[i], rhsE);
+  }
+}
+} // namespace
+
+/**
+ * out = lhs + rhs
+ * @param lhsY :: The values of the left hand side
+ * @param lhsE :: The errors of the left hand side
+ * @param rhsY :: The values of the right hand side
+ * @param rhsE :: The errors of the right hand side
+ * @param outY :: The values of the result
+ * @param outE :: The errors of the result
+ * @param n :: The size of the arrays
+ */
+void plus(const double *lhsY, const double *lhsE, const double *rhsY,
+          const double *rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    outY[i] = lhsY[i] + rhsY[i];
+  }
+  sumErrors(lhsE, rhsE, outE, n);
+}
+
+/// out = lhs + rhs with a single value on the right hand side
+void plus(const double *lhsY, const double *lhsE, const double rhsY,
+          const double rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    outY[i] = lhsY[i] + rhsY;
+  }
+  sumErrors(lhsE, rhsE, outE, n);
+}
+
+/// out = lhs - rhs
+void minus(const double *lhsY, const double *lhsE, const double *rhsY,
+           const double *rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    outY[i] = lhsY[i] - rhsY[i];
+  }
+  sumErrors(lhsE, rhsE, outE, n);
+}
+
+/// out = lhs - rhs with a single value on the right hand side
+void minus(const double *lhsY, const double *lhsE, const double rhsY,
+           const double rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    outY[i] = lhsY[i] - rhsY;
+  }
+  sumErrors(lhsE, rhsE, outE, n);
+}
+
+/**
+ * out = lhs * rhs. The relative errors add in quadrature, which is written
+ * as (Sc)^2 = (Sa b)^2 + (Sb a)^2 so that zero values give finite errors.
+ */
+void multiply(const double *lhsY, const double *lhsE, const double *rhsY,
+              const double *rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const double leftY = lhsY[i];
+    const double rightY = rhsY[i];
+    // Write the result last in case the output is also the input
+    outE[i] = quadrature(lhsE[i] * rightY, rhsE[i] * leftY);
+    outY[i] = leftY * rightY;
+  }
+}
+
+/// out = lhs * rhs with a single value on the right hand side
+void multiply(const double *lhsY, const double *lhsE, const double rhsY,
+              const double rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const double leftY = lhsY[i];
+    outE[i] = quadrature(lhsE[i] * rhsY, rhsE * leftY);
+    outY[i] = leftY * rhsY;
+  }
+}
+
+/**
+ * out = lhs / rhs. The error is written as (Sc)^2 = ((Sa)^2 + (Sb c)^2) / b^2
+ * so that it is finite when the left hand side is zero. A zero on the right
+ * hand side gives infinite or NaN values and errors.
+ */
+void divide(const double *lhsY, const double *lhsE, const double *rhsY,
+            const double *rhsE, double *outY, double *outE, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const double rightY = rhsY[i];
+    const double result = lhsY[i] / rightY;
+    outE[i] = quadrature(lhsE[i], result * rhsE[i]) / std::fabs(rightY);
+    outY[i] = result;
+  }
+}
+
+/// out = lhs / rhs with a single value on the right hand side
+void divide(const double *lhsY, const double *lhsE, const double rhsY,
+            const double rhsE, double *outY, double *outE, const size_t n) {
+  // Do the right hand part of the error calculation just once
+  const double relativeError = rhsE / rhsY;
+  const double absRhsY = std::fabs(rhsY);
+  for (size_t i = 0; i < n; ++i) {
+    const double leftY = lhsY[i];
+    outE[i] = quadrature(lhsE[i], leftY * relativeError) / absRhsY;
+    outY[i] = leftY / rhsY;
+  }
+}
+
+/**
+ * out = lhs (operation) rhs
+ * @param operation :: The operation to apply
+ * @param lhsY :: The values of the left hand side
+ * @param lhsE :: The errors of the left hand side
+ * @param rhsY :: The values of the right hand side
+ * @param rhsE :: The errors of the right hand side
+ * @param outY :: The values of the result
+ * @param outE :: The errors of the result
+ * @param n :: The size of the arrays
+ */
+void apply(const Operation operation, const double *lhsY, const double *lhsE,
+           const double *rhsY, const double *rhsE, double *outY, double *outE,
+           const size_t n) {
+  switch (operation) {
+  case Operation::Plus:
+    plus(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Minus:
+    minus(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Multiply:
+    multiply(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Divide:
+    divide(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  }
+}
+
+/// out = lhs (operation) rhs with a single value on the right hand side
+void apply(const Operation operation, const double *lhsY, const double *lhsE,
+           const double rhsY, const double rhsE, double *outY, double *outE,
+           const size_t n) {
+  switch (operation) {
+  case Operation::Plus:
+    plus(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Minus:
+    minus(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Multiply:
+    multiply(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  case Operation::Divide:
+    divide(lhsY, lhsE, rhsY, rhsE, outY, outE, n);
+    break;
+  }
+}
+
+/**
+ * Apply an operation to every spectrum of a workspace. The X values of each
+ * output spectrum are shared with the left hand side. Masking is left to the
+ * caller.
+ * @param operation :: The operation to apply
+ * @param broadcast :: How the right hand side is spread over the left hand
+ * side
+ * @param lhs :: The left hand side
+ * @param rhs :: The right hand side
+ * @param out :: The result, which may be either input. It must have as many
+ * spectra as the left hand side, of the same sizes. The sizes of the spectra
+ * are not checked: the right hand spectra must be as long as the left hand
+ * ones, or hold at least one value for a single bin.
+ * @param rhsIndices :: If not empty, the right hand spectrum to use for each
+ * spectrum of the left hand side. A negative index leaves the output spectrum
+ * untouched, whatever the broadcast. If empty, spectrum i of the right hand
+ * side is used for spectrum i of the left hand side.
+ * @throws std::invalid_argument if the numbers of spectra do not match
+ */
+void apply(const Operation operation, const Broadcast broadcast,
+           const API::MatrixWorkspace &lhs, const API::MatrixWorkspace &rhs,
+           API::MatrixWorkspace &out, const std::vector<int64_t> &rhsIndices) {
+  const size_t numHists = lhs.getNumberHistograms();
+  if (out.getNumberHistograms() != numHists)
+    throw std::invalid_argument("BinaryOperationKernels::apply: the output "
+                                "must have as many spectra as the left hand "
+                                "side.");
+  if (!rhsIndices.empty() && rhsIndices.size() != numHists)
+    throw std::invalid_argument("BinaryOperationKernels::apply: there must be "
+                                "one right hand side index per spectrum.");
+  // A broadcast uses the first right hand spectrum, the others pick theirs
+  const bool indexed =
+      broadcast == Broadcast::None || broadcast == Broadcast::SingleBin;
+  const auto rhsHists = static_cast<int64_t>(rhs.getNumberHistograms());
+  bool outOfRange = rhsHists == 0;
+  if (indexed) {
+    outOfRange = rhsIndices.empty()
+                     ? rhsHists < static_cast<int64_t>(numHists)
+                     : std::any_of(rhsIndices.cbegin(), rhsIndices.cend(),
+                                   [rhsHists](int64_t index) {
+                                     return index >= rhsHists;
+                                   });
+  }
+  if (outOfRange)
+    throw std::invalid_argument("BinaryOperationKernels::apply: a right hand "
+                                "side spectrum is out of range.");
+
+  const auto n = static_cast<int64_t>(numHists);
+  PARALLEL_FOR_IF(Kernel::threadSafe(lhs, rhs, out))
+  for (int64_t i = 0; i < n; ++i) {
+    const int64_t rhsIndex = rhsIndices.empty() ? i : rhsIndices[i];
+    out.setX(i, lhs.refX(i));
+    if (rhsIndex < 0)
+      continue;
+    // Get the output vectors first: if the output is one of the inputs this
+    // unshares the data before the inputs are read
+    MantidVec &outY = out.dataY(i);
+    MantidVec &outE = out.dataE(i);
+    const MantidVec &lhsY = lhs.readY(i);
+    const MantidVec &lhsE = lhs.readE(i);
+    const size_t size = lhsY.size();
+    switch (broadcast) {
+    case Broadcast::None:
+      apply(operation, lhsY.data(), lhsE.data(), rhs.readY(rhsIndex).data(),
+            rhs.readE(rhsIndex).data(), outY.data(), outE.data(), size);
+      break;
+    case Broadcast::SingleValue:
+      apply(operation, lhsY.data(), lhsE.data(), rhs.readY(0)[0],
+            rhs.readE(0)[0], outY.data(), outE.data(), size);
+      break;
+    case Broadcast::SingleBin:
+      apply(operation, lhsY.data(), lhsE.data(), rhs.readY(rhsIndex)[0],
+            rhs.readE(rhsIndex)[0], outY.data(), outE.data(), size);
+      break;
+    case Broadcast::SingleSpectrum:
+      apply(operation, lhsY.data(), lhsE.data(), rhs.readY(0).data(),
+            rhs.readE(0).data(), outY.data(), outE.data(), size);
+      break;
+    }
+  }
+}
+
+} // namespace BinaryOperationKernels
+} // namespace Algorithms
+} // namespace Mantid
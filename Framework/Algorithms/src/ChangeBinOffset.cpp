@@ -2,7 +2,6 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/BoundedValidator.h"
-#include "MantidAlgorithms/MatrixWorkspaceAccess.h"
 #include "MantidAlgorithms/EventWorkspaceAccess.h"
 
 namespace Mantid {
@@ -45,14 +44,28 @@ void ChangeBinOffset::exec() {
         *eventWS, std::make_tuple(EventWorkspaceAccess::eventList),
         [=](EventList &eventList) { eventList.addTof(offset); });
   } else {
-    this->for_each<Indices::FromProperty>(
-        *outputW, std::make_tuple(MatrixWorkspaceAccess::x),
-        [=](std::vector<double> &dataX) {
+    this->transformX<Indices::FromProperty>(
+        *outputW, [=](std::vector<double> &dataX) {
           for (auto &x : dataX)
             x += offset;
         });
   }
 }
 
+/// Shifts the X values of the histograms in the index set
+SpectrumAlgorithm::HistogramOperation
+ChangeBinOffset::deferredOperation(const MatrixWorkspace &workspace) {
+  const double offset = getProperty("Offset");
+  const auto indexSet = getWorkspaceIndexSet(workspace);
+  std::vector<bool> selected(workspace.getNumberHistograms(), false);
+  for (size_t i = 0; i < indexSet.size(); ++i)
+    selected[indexSet[i]] = true;
+  return [offset, selected](const size_t index,
+                            HistogramData::Histogram &histogram) {
+    if (selected[index])
+      histogram.mutableX() += offset;
+  };
+}
+
 } // namespace Algorithm
 } // namespace Mantid
@@ -1,5 +1,6 @@
 #include "MantidAlgorithms/ConvertAxisByFormula.h"
 #include "MantidAPI/CommonBinsValidator.h"
+#include "MantidAPI/CompiledExpression.h"
 #include "MantidAPI/RefAxis.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
@@ -7,6 +8,7 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/make_unique.h"
 
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
@@ -146,6 +148,17 @@ void ConvertAxisByFormula::exec() {
     }
   }
 
+  // set some constants
+  double pi = M_PI;
+  double h = PhysicalConstants::h;
+  double hBar = PhysicalConstants::h_bar;
+  double g = PhysicalConstants::g;
+  double mN = PhysicalConstants::NeutronMass;
+  double mNAMU = PhysicalConstants::NeutronMassAMU;
+  const std::map<std::string, double *> constants{
+      {"pi", &pi}, {"h", &h},   {"h_bar", &hBar},
+      {"g", &g},   {"mN", &mN}, {"mNAMU", &mNAMU}};
+
   // Create muparser
   mu::Parser p;
   try {
@@ -153,19 +166,9 @@ void ConvertAxisByFormula::exec() {
     for (const auto &variable : variables) {
       p.DefineVar(variable->name, &(variable->value));
     }
-    // set some constants
-    double pi = M_PI;
-    p.DefineVar("pi", &pi);
-    double h = PhysicalConstants::h;
-    p.DefineVar("h", &h);
-    double hBar = PhysicalConstants::h_bar;
-    p.DefineVar("h_bar", &hBar);
-    double g = PhysicalConstants::g;
-    p.DefineVar("g", &g);
-    double mN = PhysicalConstants::NeutronMass;
-    p.DefineVar("mN", &mN);
-    double mNAMU = PhysicalConstants::NeutronMassAMU;
-    p.DefineVar("mNAMU", &mNAMU);
+    for (const auto &constant : constants) {
+      p.DefineVar(constant.first, constant.second);
+    }
 
     p.SetExpr(formula);
   } catch (mu::Parser::exception_type &e) {
@@ -174,6 +177,28 @@ void ConvertAxisByFormula::exec() {
        << ". Muparser error message is: " << e.GetMsg();
     throw std::invalid_argument(ss.str());
   }
+
+  // Where possible evaluate the formula over whole arrays of axis values.
+  // Every axis value variable takes the same value; the geometry values and
+  // constants are read once per spectrum.
+  std::unique_ptr<CompiledExpression> compiled;
+  std::vector<std::string> arguments;
+  std::map<std::string, const double *> values(constants.begin(),
+                                               constants.end());
+  for (const auto &variable : variables) {
+    if (variable->isGeometric) {
+      values.emplace(variable->name, &(variable->value));
+    } else {
+      arguments.push_back(variable->name);
+    }
+  }
+  try {
+    compiled =
+        Kernel::make_unique<CompiledExpression>(formula, arguments, values);
+  } catch (std::invalid_argument &) {
+    g_log.debug("The formula cannot be compiled, using muParser.");
+  }
+
   if (isRefAxis) {
     if ((isRaggedBins) || (isGeometryRequired)) {
       // ragged bins or geometry used - we have to calculate for every spectra
@@ -186,7 +211,7 @@ void ConvertAxisByFormula::exec() {
         try {
           MantidVec &vec = outputWs->dataX(i);
           setGeometryValues(spectrumInfo, i, variables);
-          calculateValues(p, vec, variables);
+          calculateValues(p, compiled.get(), vec, variables);
         } catch (std::runtime_error &)
         // two possible exceptions runtime error and NotFoundError
         // both handled the same way
@@ -208,7 +233,7 @@ void ConvertAxisByFormula::exec() {
 
       // Calculate the new (common) X values
       MantidVec &vec = outputWs->dataX(0);
-      calculateValues(p, vec, variables);
+      calculateValues(p, compiled.get(), vec, variables);
 
       // copy xVals to every spectra
       int64_t numberOfSpectra_i = static_cast<int64_t>(
@@ -226,9 +251,20 @@ void ConvertAxisByFormula::exec() {
     }
   } else {
     size_t axisLength = axisPtr->length();
-    for (size_t i = 0; i < axisLength; ++i) {
-      setAxisValue(axisPtr->getValue(i), variables);
-      axisPtr->setValue(i, evaluateResult(p));
+    if (compiled) {
+      std::vector<double> values(axisLength);
+      for (size_t i = 0; i < axisLength; ++i) {
+        values[i] = axisPtr->getValue(i);
+      }
+      compiled->evaluate(values.data(), values.data(), axisLength);
+      for (size_t i = 0; i < axisLength; ++i) {
+        axisPtr->setValue(i, values[i]);
+      }
+    } else {
+      for (size_t i = 0; i < axisLength; ++i) {
+        setAxisValue(axisPtr->getValue(i), variables);
+        axisPtr->setValue(i, evaluateResult(p));
+      }
     }
   }
 
@@ -270,7 +306,12 @@ void ConvertAxisByFormula::setAxisValue(const double &value,
 }
 
 void ConvertAxisByFormula::calculateValues(
-    mu::Parser &p, MantidVec &vec, std::vector<Variable_ptr> variables) {
+    mu::Parser &p, const CompiledExpression *compiled, MantidVec &vec,
+    std::vector<Variable_ptr> variables) {
+  if (compiled) {
+    compiled->evaluate(vec.data(), vec.data(), vec.size());
+    return;
+  }
   MantidVec::iterator iter;
   for (iter = vec.begin(); iter != vec.end(); ++iter) {
     setAxisValue(*iter, variables);
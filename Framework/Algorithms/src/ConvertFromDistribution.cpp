@@ -3,6 +3,7 @@
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/ConvertFromDistribution.h"
 #include "MantidAPI/HistogramValidator.h"
+#include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/RawCountValidator.h"
 #include "MantidAPI/WorkspaceOpOverloads.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -30,5 +31,19 @@ void ConvertFromDistribution::exec() {
   WorkspaceHelpers::makeDistribution(workspace, false);
 }
 
+/// Multiplies each histogram by its bin widths
+SpectrumAlgorithm::HistogramOperation
+ConvertFromDistribution::deferredOperation(const MatrixWorkspace &workspace) {
+  if (!workspace.isHistogramData())
+    throw std::invalid_argument(
+        "ConvertFromDistribution: the workspace must contain histogram data.");
+  return [](const size_t, HistogramData::Histogram &histogram) {
+    if (histogram.yMode() != HistogramData::Histogram::YMode::Frequencies)
+      throw std::runtime_error("ConvertFromDistribution: the workspace is not "
+                               "a distribution.");
+    histogram.convertToCounts();
+  };
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -3,6 +3,7 @@
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/ConvertToDistribution.h"
 #include "MantidAPI/HistogramValidator.h"
+#include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/RawCountValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 
@@ -29,6 +30,20 @@ void ConvertToDistribution::exec() {
   WorkspaceHelpers::makeDistribution(workspace);
 }
 
+/// Divides each histogram by its bin widths
+SpectrumAlgorithm::HistogramOperation
+ConvertToDistribution::deferredOperation(const MatrixWorkspace &workspace) {
+  if (!workspace.isHistogramData())
+    throw std::invalid_argument(
+        "ConvertToDistribution: the workspace must contain histogram data.");
+  return [](const size_t, HistogramData::Histogram &histogram) {
+    if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies)
+      throw std::runtime_error("ConvertToDistribution: the workspace is "
+                               "already a distribution.");
+    histogram.convertToFrequencies();
+  };
+}
+
 std::map<std::string, std::string> ConvertToDistribution::validateInputs() {
   std::map<std::string, std::string> errors;
 
@@ -12,6 +12,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/UnitConversionPlan.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <numeric>
@@ -342,9 +343,11 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
     // Only do the full check if the quick one passes
     if (commonBoundaries) {
       // Calculate the new (common) X values
-      for (auto &x : outputWS->mutableX(0)) {
-        x = factor * std::pow(x, power);
-      }
+      auto &x = outputWS->mutableX(0);
+      UnitConversionPlan::applyPowerLaw(factor, power, x.begin(), x.end(),
+                                        [](double &v) -> double & {
+                                          return v;
+                                        });
 
       auto xVals = outputWS->sharedX(0);
 
@@ -372,9 +375,11 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
   for (int64_t k = 0; k < numberOfSpectra_i; ++k) {
     PARALLEL_START_INTERUPT_REGION
     if (!commonBoundaries) {
-      for (auto &x : outputWS->mutableX(k)) {
-        x = factor * std::pow(x, power);
-      }
+      auto &x = outputWS->mutableX(k);
+      UnitConversionPlan::applyPowerLaw(factor, power, x.begin(), x.end(),
+                                        [](double &v) -> double & {
+                                          return v;
+                                        });
     }
     // Convert the events themselves if necessary.
     if (m_inputEvents) {
@@ -542,7 +547,11 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
   auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
-  // Loop over the histograms (detector spectra)
+  // Gather the geometry of every spectrum once, so the conversion itself
+  // needs neither the instrument nor any virtual calls where the units are
+  // power laws of TOF
+  UnitConversionPlan plan(*localFromUnit, *localOutputUnit, m_numberOfSpectra);
+  std::vector<bool> hasGeometry(m_numberOfSpectra, false);
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
     double efixed = efixedProp;
 
@@ -551,22 +560,9 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     double twoTheta;
     if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
                           signedTheta, i, efixed, l2, twoTheta)) {
-
       /// @todo Don't yet consider hold-off (delta)
-      const double delta = 0.0;
-
-      // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                           emode, efixed, delta);
-      // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                               emode, efixed, delta);
-
-      // EventWorkspace part, modifying the EventLists.
-      if (m_inputEvents) {
-        eventWS->getSpectrum(i)
-            .convertUnitsViaTof(localFromUnit.get(), localOutputUnit.get());
-      }
+      plan.setSpectrum(i, l1, l2, twoTheta, emode, efixed);
+      hasGeometry[i] = true;
     } else {
       // Get to here if exception thrown when calculating distance to detector
       failedDetectorCount++;
@@ -578,9 +574,34 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
       if (outSpectrumInfo.hasDetectors(i))
         outSpectrumInfo.setMasked(i, true);
     }
+  }
+
+  // Loop over the histograms (detector spectra)
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
+  for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    if (hasGeometry[i]) {
+      auto &x = outputWS->mutableX(i);
+      plan.convert(i, x.begin(), x.end());
+
+      // EventWorkspace part, modifying the EventLists.
+      if (m_inputEvents) {
+        auto &eventList = eventWS->getSpectrum(i);
+        if (plan.isPowerLaw(i)) {
+          eventList.convertUnitsQuickly(plan.factor(i), plan.power(i));
+        } else {
+          auto fromUnit = std::unique_ptr<Unit>(localFromUnit->clone());
+          auto toUnit = std::unique_ptr<Unit>(localOutputUnit->clone());
+          plan.initialize(i, *fromUnit, *toUnit);
+          eventList.convertUnitsViaTof(fromUnit.get(), toUnit.get());
+        }
+      }
+    }
 
     prog.report("Convert to " + m_outputUnit->unitID());
+    PARALLEL_END_INTERUPT_REGION
   } // loop over spectra
+  PARALLEL_CHECK_INTERUPT_REGION
 
   if (failedDetectorCount != 0) {
     g_log.information() << "Unable to calculate sample-detector distance for "
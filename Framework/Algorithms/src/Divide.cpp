@@ -2,6 +2,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Divide.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 
 using namespace Mantid::API;
@@ -23,6 +24,21 @@ void Divide::init() {
 
 void Divide::exec() {
   m_warnOnZeroDivide = getProperty("WarnOnZeroDivide");
+  if (m_warnOnZeroDivide) {
+    // Single values are divided by the kernel for the whole workspace, so look
+    // for a zero before
+    MatrixWorkspace_const_sptr rhs = getProperty(inputPropName2());
+    if (rhs->size() == rhs->getNumberHistograms()) {
+      for (size_t i = 0; i < rhs->getNumberHistograms(); ++i) {
+        const auto &rhsY = rhs->readY(i);
+        if (!rhsY.empty() && rhsY[0] == 0) {
+          g_log.warning() << "Division by zero: the RHS is a single-valued "
+                             "vector with value zero.\n";
+          break;
+        }
+      }
+    }
+  }
   BinaryOperation::exec();
 }
 
@@ -33,29 +49,9 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                                     const MantidVec &rhsE, MantidVec &YOut,
                                     MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-
-  const int bins = static_cast<int>(lhsE.size());
-
-  for (int j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhsY[j];
-    const double rightY = rhsY[j];
-
-    //  error dividing two uncorrelated numbers, re-arrange so that you don't
-    //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
-    //  both be infinity)
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
-    // = (Sa 1/b)2 + (Sb (a/b2))2
-    // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] =
-        sqrt(pow(lhsE[j], 2) + pow(leftY * rhsE[j] / rightY, 2)) / fabs(rightY);
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rightY;
-    ;
-  }
+  BinaryOperationKernels::divide(lhsY.data(), lhsE.data(), rhsY.data(),
+                                 rhsE.data(), YOut.data(), EOut.data(),
+                                 lhsE.size());
 }
 
 void Divide::performBinaryOperation(const MantidVec &lhsX,
@@ -65,24 +61,8 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                                     MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
 
-  if (rhsY == 0 && m_warnOnZeroDivide)
-    g_log.warning() << "Division by zero: the RHS is a single-valued vector "
-                       "with value zero."
-                    << "\n";
-
-  // Do the right-hand part of the error calculation just once
-  const double rhsFactor = pow(rhsE / rhsY, 2);
-  const int bins = static_cast<int>(lhsE.size());
-  for (int j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhsY[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhsE[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rhsY;
-  }
+  BinaryOperationKernels::divide(lhsY.data(), lhsE.data(), rhsY, rhsE,
+                                 YOut.data(), EOut.data(), lhsE.size());
 }
 
 void Divide::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
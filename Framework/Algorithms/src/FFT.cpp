@@ -11,11 +11,10 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include "MantidKernel/make_unique.h"
 
 #include <boost/shared_array.hpp>
 
-#include <gsl/gsl_errno.h>
-
 #include <algorithm>
 #include <cmath>
 #include <functional>
@@ -118,8 +117,7 @@ void FFT::exec() {
 
   const int dys = nPoints % 2;
 
-  m_wavetable = gsl_fft_complex_wavetable_alloc(nPoints);
-  m_workspace = gsl_fft_complex_workspace_alloc(nPoints);
+  m_transform = Kernel::make_unique<Kernel::ComplexFourierTransform>(nPoints);
 
   // Hardcoded "centerShift == true" means that the zero on the x axis is
   // assumed to be in the centre, at point with index i = ySize/2.
@@ -142,8 +140,7 @@ void FFT::exec() {
     m_outWS->setSharedX(m_iAbs, m_outWS->sharedX(m_iRe));
   }
 
-  gsl_fft_complex_wavetable_free(m_wavetable);
-  gsl_fft_complex_workspace_free(m_workspace);
+  m_transform.reset();
 
   setProperty("OutputWorkspace", m_outWS);
 }
@@ -177,7 +174,7 @@ void FFT::transformForward(boost::shared_array<double> &data, const int xSize,
   double shift = getPhaseShift(
       m_inWS->points(iReal)); // extra phase to be applied to the transform
 
-  gsl_fft_complex_forward(data.get(), 1, ySize, m_wavetable, m_workspace);
+  m_transform->forward(data.get());
 
   /* The Fourier transform overwrites array 'data'. Recall that the Fourier
   * transform is
@@ -238,7 +235,7 @@ void FFT::transformBackward(boost::shared_array<double> &data, const int xSize,
     data[2 * i + 1] = isComplex ? m_inImagWS->y(iImag)[j] : 0.;
   }
 
-  gsl_fft_complex_inverse(data.get(), 1, ySize, m_wavetable, m_workspace);
+  m_transform->inverse(data.get());
 
   for (int i = 0; i < ySize; i++) {
     double x = df * i;
@@ -0,0 +1,122 @@
+#include "MantidAlgorithms/FuseSpectrumAlgorithms.h"
+#include "MantidAlgorithms/SpectrumAlgorithm.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/MandatoryValidator.h"
+
+#include <json/json.h>
+#include <unordered_set>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace API;
+using namespace Kernel;
+
+DECLARE_ALGORITHM(FuseSpectrumAlgorithms)
+
+namespace {
+/**
+ * Creates the steps of the chain from a JSON array of algorithms, in the form
+ * given by Algorithm::toString().
+ * @param algorithms :: The JSON array
+ * @returns The initialized algorithms with their properties set
+ * @throws std::invalid_argument if the string is not a JSON array of
+ * SpectrumAlgorithms
+ */
+std::vector<boost::shared_ptr<SpectrumAlgorithm>>
+createSteps(const std::string &algorithms) {
+  ::Json::Value root;
+  ::Json::Reader reader;
+  if (!reader.parse(algorithms, root) || !root.isArray())
+    throw std::invalid_argument("The algorithms must be a JSON array.");
+
+  std::vector<boost::shared_ptr<SpectrumAlgorithm>> steps;
+  for (const auto &entry : root) {
+    const std::string name = entry["name"].asString();
+    int version = entry["version"].asInt();
+    if (version == 0)
+      version = -1;
+    auto step = boost::dynamic_pointer_cast<SpectrumAlgorithm>(
+        AlgorithmManager::Instance().createUnmanaged(name, version));
+    if (!step)
+      throw std::invalid_argument(name + " is not a SpectrumAlgorithm and "
+                                         "cannot be fused.");
+    step->initialize();
+    // The workspaces of the steps are given by the chain
+    step->setProperties(entry["properties"],
+                        std::unordered_set<std::string>{
+                            "InputWorkspace", "OutputWorkspace", "Workspace"});
+    steps.push_back(step);
+  }
+  return steps;
+}
+} // namespace
+
+void FuseSpectrumAlgorithms::init() {
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "InputWorkspace", "", Direction::Input),
+                  "The workspace the first algorithm is applied to.");
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "OutputWorkspace", "", Direction::Output),
+                  "The result of the last algorithm.");
+  declareProperty("Algorithms", "",
+                  boost::make_shared<MandatoryValidator<std::string>>(),
+                  "A JSON array of the algorithms to run in order, each in the "
+                  "form given by Algorithm.toString(). Their workspace "
+                  "properties are ignored.");
+}
+
+std::map<std::string, std::string> FuseSpectrumAlgorithms::validateInputs() {
+  std::map<std::string, std::string> errors;
+  MatrixWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  if (boost::dynamic_pointer_cast<const DataObjects::EventWorkspace>(inputWS))
+    errors["InputWorkspace"] = "Event workspaces cannot be used in a fused "
+                               "chain. Run the algorithms one by one.";
+  try {
+    createSteps(getPropertyValue("Algorithms"));
+  } catch (std::exception &e) {
+    errors["Algorithms"] = e.what();
+  }
+  return errors;
+}
+
+void FuseSpectrumAlgorithms::exec() {
+  MatrixWorkspace_const_sptr inputWS = getProperty("InputWorkspace");
+  MatrixWorkspace_sptr outputWS = getProperty("OutputWorkspace");
+
+  // Record the chain: nothing is computed yet
+  std::vector<SpectrumAlgorithm::HistogramOperation> operations;
+  for (const auto &step : createSteps(getPropertyValue("Algorithms"))) {
+    auto operation = step->deferredOperation(*inputWS);
+    if (!operation)
+      throw std::invalid_argument(step->name() + " cannot be deferred.");
+    operations.push_back(std::move(operation));
+  }
+
+  // The copy shares the data of the input, so each spectrum is copied once,
+  // by the first step that changes it
+  if (outputWS != inputWS)
+    outputWS = inputWS->clone();
+
+  const auto numHists = static_cast<int64_t>(outputWS->getNumberHistograms());
+  Progress progress(this, 0.0, 1.0, numHists);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
+  for (int64_t i = 0; i < numHists; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    auto histogram = outputWS->histogram(i);
+    for (const auto &operation : operations)
+      operation(static_cast<size_t>(i), histogram);
+    outputWS->setHistogram(i, std::move(histogram));
+    progress.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  setProperty("OutputWorkspace", outputWS);
+}
+
+} // namespace Algorithms
+} // namespace Mantid
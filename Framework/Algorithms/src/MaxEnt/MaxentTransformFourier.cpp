@@ -1,6 +1,5 @@
 #include "MantidAlgorithms/MaxEnt/MaxentTransformFourier.h"
-#include <boost/shared_array.hpp>
-#include <gsl/gsl_fft_complex.h>
+#include "MantidKernel/Math/FourierTransform.h"
 
 namespace Mantid {
 namespace Algorithms {
@@ -29,25 +28,10 @@ MaxentTransformFourier::imageToData(const std::vector<double> &image) {
     throw std::invalid_argument("Cannot transform to data space");
   }
 
-  /* Prepare the data */
-  boost::shared_array<double> result(new double[n]);
-  for (size_t i = 0; i < n; i++) {
-    result[i] = complexImage[i];
-  }
-
   /* Backward FT */
-  gsl_fft_complex_wavetable *wavetable = gsl_fft_complex_wavetable_alloc(n / 2);
-  gsl_fft_complex_workspace *workspace = gsl_fft_complex_workspace_alloc(n / 2);
-  gsl_fft_complex_inverse(result.get(), 1, n / 2, wavetable, workspace);
-  gsl_fft_complex_wavetable_free(wavetable);
-  gsl_fft_complex_workspace_free(workspace);
-
-  std::vector<double> output(n);
-  for (size_t i = 0; i < n; i++) {
-    output[i] = result[i];
-  }
+  Kernel::ComplexFourierTransform(n / 2).inverse(complexImage.data());
 
-  return m_dataSpace->fromComplex(output);
+  return m_dataSpace->fromComplex(complexImage);
 }
 
 /**
@@ -69,26 +53,10 @@ MaxentTransformFourier::dataToImage(const std::vector<double> &data) {
     throw std::invalid_argument("Cannot transform to image space");
   }
 
-  /* Prepare the data */
-  boost::shared_array<double> result(new double[n]);
-  for (size_t i = 0; i < n; i++) {
-    result[i] = complexData[i];
-  }
-
   /*  Fourier transofrm */
-  gsl_fft_complex_wavetable *wavetable = gsl_fft_complex_wavetable_alloc(n / 2);
-  gsl_fft_complex_workspace *workspace = gsl_fft_complex_workspace_alloc(n / 2);
-  gsl_fft_complex_forward(result.get(), 1, n / 2, wavetable, workspace);
-  gsl_fft_complex_wavetable_free(wavetable);
-  gsl_fft_complex_workspace_free(workspace);
-
-  /* Get the data */
-  std::vector<double> output(n);
-  for (size_t i = 0; i < n; i++) {
-    output[i] = result[i];
-  }
+  Kernel::ComplexFourierTransform(n / 2).forward(complexData.data());
 
-  return m_imageSpace->fromComplex(output);
+  return m_imageSpace->fromComplex(complexData);
 }
 
 } // namespace Algorithms
@@ -2,7 +2,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Minus.h"
-#include "MantidKernel/VectorHelper.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -19,10 +19,9 @@ void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                    const MantidVec &rhsE, MantidVec &YOut,
                                    MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), rhsY.begin(), YOut.begin(),
-                 std::minus<double>());
-  std::transform(lhsE.begin(), lhsE.end(), rhsE.begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  BinaryOperationKernels::minus(lhsY.data(), lhsE.data(), rhsY.data(),
+                                rhsE.data(), YOut.data(), EOut.data(),
+                                lhsY.size());
 }
 
 void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
@@ -30,14 +29,8 @@ void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                    const double rhsE, MantidVec &YOut,
                                    MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), YOut.begin(),
-                 std::bind2nd(std::minus<double>(), rhsY));
-  // Only do E if non-zero, otherwise just copy
-  if (rhsE != 0)
-    std::transform(lhsE.begin(), lhsE.end(), EOut.begin(),
-                   std::bind2nd(VectorHelper::SumGaussError<double>(), rhsE));
-  else
-    EOut = lhsE;
+  BinaryOperationKernels::minus(lhsY.data(), lhsE.data(), rhsY, rhsE,
+                                YOut.data(), EOut.data(), lhsY.size());
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
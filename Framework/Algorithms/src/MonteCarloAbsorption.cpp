@@ -15,6 +15,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/Object.h"
 #include "MantidHistogramData/Histogram.h"
 #include "MantidHistogramData/Interpolate.h"
 #include "MantidKernel/BoundedValidator.h"
@@ -141,6 +142,10 @@ void MonteCarloAbsorption::init() {
                   "If a scattering point cannot be generated by increasing "
                   "this value then there is most likely a problem with "
                   "the sample geometry.");
+  declareProperty("UseMeshAcceleration", false,
+                  "Trace the paths through a triangle mesh of the sample "
+                  "shape, which is faster but approximates curved surfaces "
+                  "by their triangulation.");
 }
 
 /**
@@ -225,7 +230,11 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
   const int nbins = static_cast<int>(simulationWS.blocksize());
 
   EFixedProvider efixed(instrumentWS);
-  auto beamProfile = createBeamProfile(*instrument, inputWS.sample());
+  const bool useMesh = getProperty("UseMeshAcceleration");
+  const auto meshedSample = useMesh ? createMeshedSample(inputWS.sample())
+                                    : std::unique_ptr<Sample>();
+  const Sample &sample = meshedSample ? *meshedSample : inputWS.sample();
+  auto beamProfile = createBeamProfile(*instrument, sample);
 
   // Configure progress
   const int lambdaStepSize = nbins / nlambda;
@@ -234,7 +243,7 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
   const std::string reportMsg = "Computing corrections";
 
   // Configure strategy
-  MCAbsorptionStrategy strategy(*beamProfile, inputWS.sample(), nevents,
+  MCAbsorptionStrategy strategy(*beamProfile, sample, nevents,
                                 maxScatterPtAttempts);
 
   const auto &spectrumInfo = simulationWS.spectrumInfo();
@@ -314,6 +323,24 @@ MatrixWorkspace_uptr MonteCarloAbsorption::createOutputWorkspace(
   return outputWS;
 }
 
+/**
+ * Copy the sample with a triangle mesh compiled for its shape
+ * @param sample A reference to the sample object
+ * @return A copy of the sample, or nullptr if the shape cannot be meshed
+ */
+std::unique_ptr<Sample>
+MonteCarloAbsorption::createMeshedSample(const Sample &sample) const {
+  Object shape = sample.getShape();
+  if (!shape.setMeshAcceleration(true)) {
+    g_log.warning("The sample shape could not be triangulated. The paths are "
+                  "traced through the exact shape.\n");
+    return nullptr;
+  }
+  auto meshedSample = Mantid::Kernel::make_unique<Sample>(sample);
+  meshedSample->setShape(shape);
+  return meshedSample;
+}
+
 /**
  * Create the beam profile. Currently only supports Rectangular. The dimensions
  * are either specified by those provided by `SetBeam` algorithm or default
@@ -2,6 +2,7 @@
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Multiply.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 
 using namespace Mantid::API;
@@ -21,23 +22,9 @@ void Multiply::performBinaryOperation(const MantidVec &lhsX,
                                       const MantidVec &rhsE, MantidVec &YOut,
                                       MantidVec &EOut) {
   UNUSED_ARG(lhsX);
-  const size_t bins = lhsE.size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhsY[j];
-    const double rightY = rhsY[j];
-
-    // error multiplying two uncorrelated numbers, re-arrange so that you don't
-    // get infinity if leftY or rightY == 0
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
-    //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhsE[j] * rightY, 2) + pow(rhsE[j] * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rightY;
-  }
+  BinaryOperationKernels::multiply(lhsY.data(), lhsE.data(), rhsY.data(),
+                                   rhsE.data(), YOut.data(), EOut.data(),
+                                   lhsE.size());
 }
 
 void Multiply::performBinaryOperation(const MantidVec &lhsX,
@@ -46,18 +33,8 @@ void Multiply::performBinaryOperation(const MantidVec &lhsX,
                                       const double rhsE, MantidVec &YOut,
                                       MantidVec &EOut) {
   UNUSED_ARG(lhsX);
-  const size_t bins = lhsE.size();
-  for (size_t j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhsY[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhsE[j] * rhsY, 2) + pow(rhsE * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rhsY;
-  }
+  BinaryOperationKernels::multiply(lhsY.data(), lhsE.data(), rhsY, rhsE,
+                                   YOut.data(), EOut.data(), lhsE.size());
 }
 
 void Multiply::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
@@ -2,7 +2,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Plus.h"
-#include "MantidKernel/VectorHelper.h"
+#include "MantidAlgorithms/BinaryOperationKernels.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -21,10 +21,9 @@ void Plus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                   const MantidVec &rhsE, MantidVec &YOut,
                                   MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), rhsY.begin(), YOut.begin(),
-                 std::plus<double>());
-  std::transform(lhsE.begin(), lhsE.end(), rhsE.begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  BinaryOperationKernels::plus(lhsY.data(), lhsE.data(), rhsY.data(),
+                               rhsE.data(), YOut.data(), EOut.data(),
+                               lhsY.size());
 }
 
 //---------------------------------------------------------------------------------------------
@@ -33,14 +32,8 @@ void Plus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                   const double rhsE, MantidVec &YOut,
                                   MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), YOut.begin(),
-                 std::bind2nd(std::plus<double>(), rhsY));
-  // Only do E if non-zero, otherwise just copy
-  if (rhsE != 0)
-    std::transform(lhsE.begin(), lhsE.end(), EOut.begin(),
-                   std::bind2nd(VectorHelper::SumGaussError<double>(), rhsE));
-  else
-    EOut = lhsE;
+  BinaryOperationKernels::plus(lhsY.data(), lhsE.data(), rhsY, rhsE,
+                               YOut.data(), EOut.data(), lhsY.size());
 }
 
 // ===================================== EVENT LIST BINARY OPERATIONS
@@ -5,6 +5,8 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidKernel/ListValidator.h"
 
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -87,5 +89,22 @@ void Scale::exec() {
   setProperty("OutputWorkspace", outputWS);
 }
 
+/// Multiplies or adds the factor, with the errors of a single value without
+/// error
+SpectrumAlgorithm::HistogramOperation
+Scale::deferredOperation(const MatrixWorkspace &workspace) {
+  UNUSED_ARG(workspace);
+  const double factor = getProperty("Factor");
+  if (getPropertyValue("Operation") == "Multiply") {
+    return [factor](const size_t, HistogramData::Histogram &histogram) {
+      histogram.mutableY() *= factor;
+      histogram.mutableE() *= std::abs(factor);
+    };
+  }
+  return [factor](const size_t, HistogramData::Histogram &histogram) {
+    histogram.mutableY() += factor;
+  };
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -9,8 +9,12 @@
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Objects/Object.h"
 
+#include <boost/make_shared.hpp>
 #include <cfloat>
+#include <map>
 
 namespace Mantid {
 namespace Algorithms {
@@ -21,6 +25,61 @@ DECLARE_ALGORITHM(SolidAngle)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// Copies of the detector shapes with a compiled triangle mesh, keyed by the
+/// shape they were made from. Null if the shape could not be triangulated.
+using MeshedShapes =
+    std::map<const Geometry::Object *, boost::shared_ptr<Geometry::Object>>;
+
+/// Build a meshed copy of each distinct detector shape
+MeshedShapes meshDetectorShapes(const Geometry::ComponentInfo &componentInfo,
+                                const size_t numberOfDetectors) {
+  MeshedShapes meshes;
+  for (size_t i = 0; i < numberOfDetectors; ++i) {
+    if (!componentInfo.hasShape(i))
+      continue;
+    const auto &shape = componentInfo.shape(i);
+    if (meshes.count(&shape) == 1)
+      continue;
+    auto meshed = boost::make_shared<Geometry::Object>(shape);
+    if (!meshed->setMeshAcceleration(true))
+      meshed.reset();
+    meshes.emplace(&shape, meshed);
+  }
+  return meshes;
+}
+
+/**
+ * The solid angle of a detector using the meshed copy of its shape if there
+ * is one. Scaled shapes are not meshed and use the exact calculation.
+ * @param detectorInfo :: The detectors of the workspace
+ * @param componentInfo :: The components of the workspace
+ * @param meshes :: The meshed shapes
+ * @param index :: The detector index
+ * @param observer :: The point to measure the solid angle from
+ * @return The solid angle in steradians
+ */
+double detectorSolidAngle(const Geometry::DetectorInfo &detectorInfo,
+                          const Geometry::ComponentInfo &componentInfo,
+                          const MeshedShapes &meshes, const size_t index,
+                          const V3D &observer) {
+  if (!meshes.empty() && componentInfo.hasShape(index) &&
+      (componentInfo.scaleFactor(index) - V3D(1.0, 1.0, 1.0)).norm() <
+          1e-12) {
+    const auto mesh = meshes.find(&componentInfo.shape(index));
+    if (mesh != meshes.end() && mesh->second) {
+      // Put the observer into the frame of the shape
+      V3D relativeObserver = observer - componentInfo.position(index);
+      auto unrotate = componentInfo.rotation(index);
+      unrotate.inverse();
+      unrotate.rotate(relativeObserver);
+      return mesh->second->solidAngle(relativeObserver);
+    }
+  }
+  return detectorInfo.detector(index).solidAngle(observer);
+}
+} // namespace
+
 /// Initialisation method
 void SolidAngle::init() {
   declareProperty(make_unique<WorkspaceProperty<API::MatrixWorkspace>>(
@@ -49,6 +108,10 @@ void SolidAngle::init() {
                   "The index of the last spectrum whose solid angle is to be "
                   "found (default: the\n"
                   "last spectrum in the workspace)");
+  declareProperty("UseMeshAcceleration", false,
+                  "Calculate the solid angles on a triangle mesh of each "
+                  "detector shape, which is faster for large instruments "
+                  "but approximates curved surfaces by their triangulation");
 }
 
 /** Executes the algorithm
@@ -86,6 +149,13 @@ void SolidAngle::exec() {
   const Kernel::V3D samplePos = spectrumInfo.samplePosition();
   g_log.debug() << "Sample position is " << samplePos << '\n';
 
+  // The meshes are built before the loop as triangulating is not thread safe
+  const bool useMesh = getProperty("UseMeshAcceleration");
+  const auto &componentInfo = inputWS->componentInfo();
+  const auto meshes = useMesh ? meshDetectorShapes(componentInfo,
+                                                   detectorInfo.size())
+                              : MeshedShapes();
+
   const int loopIterations = m_MaxSpec - m_MinSpec;
   int failCount = 0;
   Progress prog(this, 0.0, 1.0, numberOfSpectra);
@@ -102,7 +172,8 @@ void SolidAngle::exec() {
       for (const auto detID : inputWS->getSpectrum(j).getDetectorIDs()) {
         const auto index = detectorInfo.indexOf(detID);
         if (!detectorInfo.isMasked(index))
-          solidAngle += detectorInfo.detector(index).solidAngle(samplePos);
+          solidAngle += detectorSolidAngle(detectorInfo, componentInfo,
+                                           meshes, index, samplePos);
       }
 
       outputWS->mutableX(j)[0] = inputWS->x(i).front();
@@ -5,9 +5,29 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidDataObjects/EventWorkspace.h"
 
+#include <unordered_map>
+
 using namespace Mantid;
 using namespace Algorithms;
 
+/** Returns the work of the algorithm on a single histogram, to run it deferred.
+ *
+ * The algorithm must be initialized and have its properties set, apart from
+ * the workspace properties, which are not used. The returned operation is then
+ * applied to every histogram of a workspace, after the operations of the
+ * algorithms before it, in place of exec(). It is called concurrently for
+ * different histograms.
+ * @param workspace :: The workspace the deferred chain starts from. Only its
+ *     shape and metadata may be used: its data does not hold the results of
+ *     the earlier steps.
+ * @returns The operation, or an empty function if the algorithm cannot be
+ *     deferred, which is the default. */
+SpectrumAlgorithm::HistogramOperation
+SpectrumAlgorithm::deferredOperation(const API::MatrixWorkspace &workspace) {
+  UNUSED_ARG(workspace);
+  return HistogramOperation();
+}
+
 /** Declare standard properties for defining ranges/lists of spectra. */
 void SpectrumAlgorithm::declareWorkspaceIndexSetProperties(
     const std::string &indexMinPropertyName,
@@ -72,6 +92,44 @@ Kernel::IndexSet SpectrumAlgorithm::getWorkspaceIndexSet(
   return {indices_list, numberOfSpectra};
 }
 
+/** Internal part of the transformX() implementation.
+ *
+ * Spectra are grouped by the X array they share. The first spectrum of each
+ * group is transformed, which detaches its X if it is shared, and the other
+ * spectra of the group are then pointed at the result. Spectra outside the
+ * index set keep their X even if they shared it with spectra in the set. */
+void SpectrumAlgorithm::transformX(
+    API::MatrixWorkspace &workspace, const Kernel::IndexSet &indexSet,
+    const std::function<void(std::vector<double> &)> &operation) {
+  std::unordered_map<const HistogramData::HistogramX *, size_t> groups;
+  std::vector<size_t> representatives;
+  std::vector<size_t> groupOfSpectrum(indexSet.size());
+  for (size_t i = 0; i < indexSet.size(); ++i) {
+    const auto group =
+        groups.emplace(&workspace.x(indexSet[i]), representatives.size());
+    if (group.second)
+      representatives.push_back(indexSet[i]);
+    groupOfSpectrum[i] = group.first->second;
+  }
+
+  const auto size = static_cast<int64_t>(representatives.size());
+  API::Progress progress(this, 0.0, 1.0, size);
+  PARALLEL_FOR_IF(Kernel::threadSafe(workspace))
+  for (int64_t i = 0; i < size; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    operation(workspace.dataX(representatives[i]));
+    progress.report(name());
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (size_t i = 0; i < indexSet.size(); ++i) {
+    const auto representative = representatives[groupOfSpectrum[i]];
+    if (indexSet[i] != representative)
+      workspace.setSharedX(indexSet[i], workspace.sharedX(representative));
+  }
+}
+
 /** Internal part of the for_each() implementation.
  *
  * This specialization is used to call clearMRU for EventWorkspace, overriding
@@ -0,0 +1,239 @@
+#ifndef MANTID_ALGORITHMS_BINARYOPERATIONKERNELSTEST_H_
+#define MANTID_ALGORITHMS_BINARYOPERATIONKERNELSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/BinaryOperationKernels.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace Mantid::Algorithms;
+using Mantid::API::MatrixWorkspace;
+using Mantid::DataObjects::Workspace2D_sptr;
+
+class BinaryOperationKernelsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BinaryOperationKernelsTest *createSuite() {
+    return new BinaryOperationKernelsTest();
+  }
+  static void destroySuite(BinaryOperationKernelsTest *suite) { delete suite; }
+
+  BinaryOperationKernelsTest()
+      : m_lhsY{2.0, 0.0, -3.0, 5.0}, m_lhsE{0.5, 1.0, 0.1, 0.0},
+        m_rhsY{4.0, 2.0, 0.5, -1.0}, m_rhsE{1.0, 0.3, 0.2, 0.7},
+        m_outY(4), m_outE(4) {}
+
+  void test_plus() {
+    BinaryOperationKernels::plus(m_lhsY.data(), m_lhsE.data(), m_rhsY.data(),
+                                 m_rhsE.data(), m_outY.data(), m_outE.data(),
+                                 4);
+    for (size_t i = 0; i < 4; ++i) {
+      TS_ASSERT_EQUALS(m_outY[i], m_lhsY[i] + m_rhsY[i]);
+      TS_ASSERT_DELTA(m_outE[i], std::hypot(m_lhsE[i], m_rhsE[i]), 1e-15);
+    }
+  }
+
+  void test_minus_single_value() {
+    BinaryOperationKernels::minus(m_lhsY.data(), m_lhsE.data(), 1.5, 2.0,
+                                  m_outY.data(), m_outE.data(), 4);
+    for (size_t i = 0; i < 4; ++i) {
+      TS_ASSERT_EQUALS(m_outY[i], m_lhsY[i] - 1.5);
+      TS_ASSERT_DELTA(m_outE[i], std::hypot(m_lhsE[i], 2.0), 1e-15);
+    }
+  }
+
+  void test_single_value_without_error_copies_the_errors() {
+    BinaryOperationKernels::plus(m_lhsY.data(), m_lhsE.data(), 1.0, 0.0,
+                                 m_outY.data(), m_outE.data(), 4);
+    TS_ASSERT_EQUALS(m_outE, m_lhsE);
+  }
+
+  void test_multiply() {
+    BinaryOperationKernels::multiply(m_lhsY.data(), m_lhsE.data(),
+                                     m_rhsY.data(), m_rhsE.data(),
+                                     m_outY.data(), m_outE.data(), 4);
+    for (size_t i = 0; i < 4; ++i) {
+      TS_ASSERT_EQUALS(m_outY[i], m_lhsY[i] * m_rhsY[i]);
+      TS_ASSERT_DELTA(m_outE[i], std::hypot(m_lhsE[i] * m_rhsY[i],
+                                            m_rhsE[i] * m_lhsY[i]),
+                      1e-15);
+    }
+  }
+
+  void test_divide() {
+    BinaryOperationKernels::divide(m_lhsY.data(), m_lhsE.data(),
+                                   m_rhsY.data(), m_rhsE.data(), m_outY.data(),
+                                   m_outE.data(), 4);
+    for (size_t i = 0; i < 4; ++i) {
+      const double y = m_lhsY[i] / m_rhsY[i];
+      TS_ASSERT_EQUALS(m_outY[i], y);
+      const double rhsSquared = m_rhsY[i] * m_rhsY[i];
+      TS_ASSERT_DELTA(m_outE[i],
+                      std::hypot(m_lhsE[i] / m_rhsY[i],
+                                 m_lhsY[i] * m_rhsE[i] / rhsSquared),
+                      1e-14);
+    }
+  }
+
+  void test_divide_by_single_value_in_place() {
+    auto y = m_lhsY;
+    auto e = m_lhsE;
+    BinaryOperationKernels::divide(y.data(), e.data(), -2.0, 0.5, y.data(),
+                                   e.data(), 4);
+    for (size_t i = 0; i < 4; ++i) {
+      TS_ASSERT_EQUALS(y[i], m_lhsY[i] / -2.0);
+      TS_ASSERT_DELTA(e[i], std::hypot(m_lhsE[i] / 2.0, m_lhsY[i] / 8.0),
+                      1e-15);
+    }
+  }
+
+  void test_divide_by_zero() {
+    const std::vector<double> rhsY{0.0, 0.0};
+    const std::vector<double> rhsE{1.0, 0.0};
+    BinaryOperationKernels::divide(m_lhsY.data(), m_lhsE.data(), rhsY.data(),
+                                   rhsE.data(), m_outY.data(), m_outE.data(),
+                                   2);
+    TS_ASSERT(std::isinf(m_outY[0]));
+    TS_ASSERT(std::isinf(m_outE[0]));
+    TS_ASSERT(std::isnan(m_outY[1]));
+    TS_ASSERT(std::isnan(m_outE[1]));
+  }
+
+  void test_apply_over_a_workspace() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(3, 4, -5.0);
+    auto out = createWorkspace(3, 4, 0.0);
+    BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Multiply,
+                                  BinaryOperationKernels::Broadcast::None,
+                                  *lhs, *rhs, *out);
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(out->readX(i), lhs->readX(i));
+      checkSpectrum(BinaryOperationKernels::Operation::Multiply, *lhs, i,
+                    rhs->readY(i), rhs->readE(i), *out);
+    }
+  }
+
+  void test_apply_broadcasts_a_single_value() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(1, 1, 2.5);
+    BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Divide,
+                                  BinaryOperationKernels::Broadcast::SingleValue,
+                                  *lhs, *rhs, *lhs);
+    auto expected = createWorkspace(3, 4, 1.0);
+    const std::vector<double> rhsY(4, rhs->readY(0)[0]);
+    const std::vector<double> rhsE(4, rhs->readE(0)[0]);
+    for (size_t i = 0; i < 3; ++i) {
+      checkSpectrum(BinaryOperationKernels::Operation::Divide, *expected, i,
+                    rhsY, rhsE, *lhs);
+    }
+  }
+
+  void test_apply_broadcasts_a_single_bin() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(3, 1, 7.0);
+    auto out = createWorkspace(3, 4, 0.0);
+    BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Minus,
+                                  BinaryOperationKernels::Broadcast::SingleBin,
+                                  *lhs, *rhs, *out);
+    for (size_t i = 0; i < 3; ++i) {
+      const std::vector<double> rhsY(4, rhs->readY(i)[0]);
+      const std::vector<double> rhsE(4, rhs->readE(i)[0]);
+      checkSpectrum(BinaryOperationKernels::Operation::Minus, *lhs, i, rhsY,
+                    rhsE, *out);
+    }
+  }
+
+  void test_apply_broadcasts_a_single_spectrum() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(1, 4, 3.0);
+    auto out = createWorkspace(3, 4, 0.0);
+    BinaryOperationKernels::apply(
+        BinaryOperationKernels::Operation::Plus,
+        BinaryOperationKernels::Broadcast::SingleSpectrum, *lhs, *rhs, *out);
+    for (size_t i = 0; i < 3; ++i) {
+      checkSpectrum(BinaryOperationKernels::Operation::Plus, *lhs, i,
+                    rhs->readY(0), rhs->readE(0), *out);
+    }
+  }
+
+  void test_apply_uses_the_rhs_indices_and_leaves_out_negative_ones() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(2, 4, 10.0);
+    auto out = createWorkspace(3, 4, 100.0);
+    auto untouched = createWorkspace(3, 4, 100.0);
+    BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Plus,
+                                  BinaryOperationKernels::Broadcast::None,
+                                  *lhs, *rhs, *out, {1, -1, 0});
+    checkSpectrum(BinaryOperationKernels::Operation::Plus, *lhs, 0,
+                  rhs->readY(1), rhs->readE(1), *out);
+    TS_ASSERT_EQUALS(out->readY(1), untouched->readY(1));
+    TS_ASSERT_EQUALS(out->readE(1), untouched->readE(1));
+    checkSpectrum(BinaryOperationKernels::Operation::Plus, *lhs, 2,
+                  rhs->readY(0), rhs->readE(0), *out);
+  }
+
+  void test_apply_throws_if_the_rhs_has_too_few_spectra() {
+    auto lhs = createWorkspace(3, 4, 1.0);
+    auto rhs = createWorkspace(2, 4, 10.0);
+    auto out = createWorkspace(3, 4, 0.0);
+    TS_ASSERT_THROWS(
+        BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Plus,
+                                      BinaryOperationKernels::Broadcast::None,
+                                      *lhs, *rhs, *out),
+        std::invalid_argument);
+    TS_ASSERT_THROWS(
+        BinaryOperationKernels::apply(BinaryOperationKernels::Operation::Plus,
+                                      BinaryOperationKernels::Broadcast::None,
+                                      *lhs, *rhs, *out, {0, 1, 2}),
+        std::invalid_argument);
+  }
+
+private:
+  /// A workspace with distinct values and errors in every bin
+  Workspace2D_sptr createWorkspace(const int nHist, const int nBins,
+                                   const double offset) {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(nHist, nBins);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      auto &y = ws->dataY(i);
+      auto &e = ws->dataE(i);
+      for (size_t j = 0; j < y.size(); ++j) {
+        y[j] = offset + static_cast<double>(i * y.size() + j);
+        e[j] = 0.1 + 0.05 * y[j] * y[j];
+      }
+    }
+    return ws;
+  }
+
+  /// Check spectrum i of out against the array kernel
+  void checkSpectrum(const BinaryOperationKernels::Operation operation,
+                     const MatrixWorkspace &lhs, const size_t i,
+                     const std::vector<double> &rhsY,
+                     const std::vector<double> &rhsE,
+                     const MatrixWorkspace &out) {
+    const auto &lhsY = lhs.readY(i);
+    std::vector<double> y(lhsY.size());
+    std::vector<double> e(lhsY.size());
+    BinaryOperationKernels::apply(operation, lhsY.data(), lhs.readE(i).data(),
+                                  rhsY.data(), rhsE.data(), y.data(), e.data(),
+                                  y.size());
+    // The single value forms may round differently
+    for (size_t j = 0; j < y.size(); ++j) {
+      TS_ASSERT_DELTA(out.readY(i)[j], y[j], 1e-9);
+      TS_ASSERT_DELTA(out.readE(i)[j], e[j], 1e-9);
+    }
+  }
+
+  const std::vector<double> m_lhsY;
+  const std::vector<double> m_lhsE;
+  const std::vector<double> m_rhsY;
+  const std::vector<double> m_rhsE;
+  std::vector<double> m_outY;
+  std::vector<double> m_outE;
+};
+
+#endif /* MANTID_ALGORITHMS_BINARYOPERATIONKERNELSTEST_H_ */
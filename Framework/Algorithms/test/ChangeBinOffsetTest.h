@@ -81,6 +81,32 @@ public:
     AnalysisDataService::Instance().remove("input2D");
   }
 
+  void test_shared_bins_stay_shared() {
+    auto input = boost::make_shared<Workspace2D>();
+    input->initialize(4, 3, 2);
+
+    ChangeBinOffset alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("Offset", 2.0);
+    alg.setProperty("IndexMin", 1);
+    alg.setProperty("IndexMax", 2);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+
+    // The spectra outside the range keep the original bins
+    TS_ASSERT_EQUALS(&output->x(0), &input->x(0));
+    TS_ASSERT_EQUALS(&output->x(3), &input->x(0));
+    TS_ASSERT_EQUALS(&output->x(2), &output->x(1));
+    TS_ASSERT_DIFFERS(&output->x(1), &input->x(1));
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(output->x(1)[i], input->x(1)[i] + 2.0);
+      TS_ASSERT_EQUALS(output->x(0)[i], input->x(0)[i]);
+    }
+  }
+
   Workspace2D_sptr makeDummyWorkspace2D() {
     Workspace2D_sptr testWorkspace(new Workspace2D);
 
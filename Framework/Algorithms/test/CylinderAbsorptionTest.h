@@ -5,6 +5,8 @@
 
 #include "MantidAlgorithms/CylinderAbsorption.h"
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/Sample.h"
+#include "MantidGeometry/Objects/Object.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
@@ -112,7 +114,46 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void testExecWithMeshAcceleration() {
+    MatrixWorkspace_sptr exact = runAbsorption(false);
+    MatrixWorkspace_sptr meshed = runAbsorption(true);
+    // The faceted cylinder gives slightly different paths to the exact one
+    const auto &exactY = exact->readY(0);
+    const auto &meshedY = meshed->readY(0);
+    TS_ASSERT_DIFFERS(meshedY.front(), exactY.front());
+    TS_ASSERT_DELTA(meshedY.front(), exactY.front(), 0.005);
+    TS_ASSERT_DIFFERS(meshedY.back(), exactY.back());
+    TS_ASSERT_DELTA(meshedY.back(), exactY.back(), 0.005);
+    // Only the paths are traced through the mesh
+    TS_ASSERT(!meshed->sample().getShape().hasMeshAcceleration());
+  }
+
 private:
+  MatrixWorkspace_sptr runAbsorption(bool useMesh) {
+    Mantid::Algorithms::CylinderAbsorption alg;
+    alg.initialize();
+    alg.setChild(true);
+    MatrixWorkspace_sptr testWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(1, 10);
+    testWS->getAxis(0)->unit() =
+        Mantid::Kernel::UnitFactory::Instance().create("Wavelength");
+    alg.setProperty<MatrixWorkspace_sptr>("InputWorkspace", testWS);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setPropertyValue("CylinderSampleHeight", "4");
+    alg.setPropertyValue("CylinderSampleRadius", "0.4");
+    alg.setPropertyValue("AttenuationXSection", "5.08");
+    alg.setPropertyValue("ScatteringXSection", "5.1");
+    alg.setPropertyValue("SampleNumberDensity", "0.07192");
+    alg.setPropertyValue("NumberOfSlices", "2");
+    alg.setPropertyValue("NumberOfAnnuli", "2");
+    alg.setPropertyValue("NumberOfWavelengthPoints", "5");
+    alg.setPropertyValue("ExpMethod", "Normal");
+    alg.setProperty("UseMeshAcceleration", useMesh);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
   Mantid::Algorithms::CylinderAbsorption atten;
 };
 
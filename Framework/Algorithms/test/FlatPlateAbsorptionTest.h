@@ -5,6 +5,8 @@
 
 #include "MantidAlgorithms/FlatPlateAbsorption.h"
 #include "MantidAPI/Axis.h"
+#include "MantidAPI/Sample.h"
+#include "MantidGeometry/Objects/Object.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
@@ -65,6 +67,37 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void testExecWithMeshAcceleration() {
+    // The triangulation of a flat plate is exact so the factors are the same
+    Mantid::Algorithms::FlatPlateAbsorption meshed;
+    meshed.initialize();
+    meshed.setChild(true);
+    MatrixWorkspace_sptr testWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(2, 10);
+    testWS->getAxis(0)->unit() =
+        Mantid::Kernel::UnitFactory::Instance().create("Wavelength");
+    meshed.setProperty<MatrixWorkspace_sptr>("InputWorkspace", testWS);
+    meshed.setPropertyValue("OutputWorkspace", "unused");
+    meshed.setPropertyValue("SampleHeight", "2.3");
+    meshed.setPropertyValue("SampleWidth", "1.8");
+    meshed.setPropertyValue("SampleThickness", "1.5");
+    meshed.setPropertyValue("AttenuationXSection", "6.52");
+    meshed.setPropertyValue("ScatteringXSection", "19.876");
+    meshed.setPropertyValue("SampleNumberDensity", "0.0093");
+    meshed.setPropertyValue("NumberOfWavelengthPoints", "3");
+    meshed.setProperty("UseMeshAcceleration", true);
+    TS_ASSERT_THROWS_NOTHING(meshed.execute());
+    TS_ASSERT(meshed.isExecuted());
+
+    MatrixWorkspace_sptr result = meshed.getProperty("OutputWorkspace");
+    TS_ASSERT_DELTA(result->readY(0).front(), 0.7389, 0.0001);
+    TS_ASSERT_DELTA(result->readY(0)[1], 0.7042, 0.0001);
+    TS_ASSERT_DELTA(result->readY(0).back(), 0.4686, 0.0001);
+    TS_ASSERT_DELTA(result->readY(1)[5], 0.5752, 0.0001);
+    // Only the paths are traced through the mesh
+    TS_ASSERT(!result->sample().getShape().hasMeshAcceleration());
+  }
+
 private:
   Mantid::Algorithms::FlatPlateAbsorption atten;
   std::string inputWS;
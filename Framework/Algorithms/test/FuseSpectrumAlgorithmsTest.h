@@ -0,0 +1,149 @@
+#ifndef MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMSTEST_H_
+#define MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/FuseSpectrumAlgorithms.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using Mantid::Algorithms::FuseSpectrumAlgorithms;
+using namespace Mantid::API;
+
+class FuseSpectrumAlgorithmsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FuseSpectrumAlgorithmsTest *createSuite() {
+    return new FuseSpectrumAlgorithmsTest();
+  }
+  static void destroySuite(FuseSpectrumAlgorithmsTest *suite) { delete suite; }
+
+  void test_init() {
+    FuseSpectrumAlgorithms alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_chain_matches_running_the_algorithms_one_by_one() {
+    auto input = createInput();
+    const std::string chain =
+        R"([{"name":"Scale","properties":{"Factor":"-2"}},)"
+        R"({"name":"ChangeBinOffset","properties":)"
+        R"({"Offset":"1.5","IndexMin":"1","IndexMax":"2"}},)"
+        R"({"name":"ConvertToDistribution","properties":{}},)"
+        R"({"name":"Scale","properties":{"Factor":"0.5","Operation":"Add"}}])";
+    auto fused = runChain(input, chain);
+
+    MatrixWorkspace_sptr expected = input->clone();
+    expected = runStep("Scale", expected, {{"Factor", "-2"}});
+    expected = runStep("ChangeBinOffset", expected,
+                       {{"Offset", "1.5"}, {"IndexMin", "1"}, {"IndexMax", "2"}});
+    runStep("ConvertToDistribution", expected, {});
+    expected =
+        runStep("Scale", expected, {{"Factor", "0.5"}, {"Operation", "Add"}});
+
+    TS_ASSERT(fused->isDistribution());
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(fused->x(i).rawData(), expected->x(i).rawData());
+      TS_ASSERT_EQUALS(fused->y(i).rawData(), expected->y(i).rawData());
+      TS_ASSERT_EQUALS(fused->e(i).rawData(), expected->e(i).rawData());
+    }
+    // The input is left alone
+    TS_ASSERT(!input->isDistribution());
+    TS_ASSERT_EQUALS(input->x(1)[0], 0.0);
+    TS_ASSERT_EQUALS(input->y(0)[0], 2.0);
+  }
+
+  void test_conversion_to_and_from_a_distribution_in_one_chain() {
+    auto input = createInput();
+    const std::string chain =
+        R"([{"name":"ConvertToDistribution","properties":{}},)"
+        R"({"name":"Scale","properties":{"Factor":"3"}},)"
+        R"({"name":"ConvertFromDistribution","properties":{}}])";
+    auto fused = runChain(input, chain);
+    TS_ASSERT(!fused->isDistribution());
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < input->y(i).size(); ++j) {
+        TS_ASSERT_DELTA(fused->y(i)[j], 3.0 * input->y(i)[j], 1e-12);
+        TS_ASSERT_DELTA(fused->e(i)[j], 3.0 * input->e(i)[j], 1e-12);
+      }
+    }
+  }
+
+  void test_algorithms_that_cannot_be_deferred_are_rejected() {
+    FuseSpectrumAlgorithms alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", createInput());
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("Algorithms",
+                    R"([{"name":"Rebin","properties":{"Params":"1"}}])");
+    TS_ASSERT_THROWS(alg.execute(), std::runtime_error);
+    TS_ASSERT(!alg.isExecuted());
+  }
+
+  void test_event_workspaces_are_rejected() {
+    FuseSpectrumAlgorithms alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace",
+                    boost::static_pointer_cast<MatrixWorkspace>(
+                        WorkspaceCreationHelper::createEventWorkspace()));
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("Algorithms",
+                    R"([{"name":"Scale","properties":{"Factor":"2"}}])");
+    TS_ASSERT_THROWS(alg.execute(), std::runtime_error);
+  }
+
+private:
+  /// Three spectra of varying bin widths and values
+  MatrixWorkspace_sptr createInput() {
+    const double xBoundaries[] = {0.0, 1.0, 3.0, 3.5, 6.0};
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(3, 5,
+                                                               xBoundaries);
+    for (size_t i = 1; i < ws->getNumberHistograms(); ++i) {
+      auto &y = ws->mutableY(i);
+      for (size_t j = 0; j < y.size(); ++j)
+        y[j] = static_cast<double>(i + j);
+    }
+    return ws;
+  }
+
+  MatrixWorkspace_sptr runChain(const MatrixWorkspace_sptr &input,
+                                const std::string &chain) {
+    FuseSpectrumAlgorithms alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    alg.setProperty("Algorithms", chain);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  MatrixWorkspace_sptr
+  runStep(const std::string &name, const MatrixWorkspace_sptr &ws,
+          const std::vector<std::pair<std::string, std::string>> &properties) {
+    auto alg = AlgorithmManager::Instance().createUnmanaged(name);
+    alg->initialize();
+    alg->setChild(true);
+    if (alg->existsProperty("Workspace")) {
+      alg->setProperty("Workspace", ws);
+    } else {
+      alg->setProperty("InputWorkspace", ws);
+      alg->setPropertyValue("OutputWorkspace", "unused");
+    }
+    for (const auto &property : properties)
+      alg->setPropertyValue(property.first, property.second);
+    alg->execute();
+    TS_ASSERT(alg->isExecuted());
+    return alg->existsProperty("Workspace")
+               ? ws
+               : alg->getProperty("OutputWorkspace");
+  }
+};
+
+#endif /* MANTID_ALGORITHMS_FUSESPECTRUMALGORITHMSTEST_H_ */
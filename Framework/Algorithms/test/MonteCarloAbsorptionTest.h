@@ -151,6 +151,24 @@ public:
     TS_ASSERT_DELTA(4.0118175e-05, outputWS->y(0).back(), delta);
   }
 
+  void test_Workspace_With_Mesh_Acceleration() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {5, 10, Environment::SampleOnly,
+                                       DeltaEMode::Elastic, -1, -1};
+    auto exactWS = runAlgorithm(wsProps);
+    auto meshedWS = runAlgorithm(wsProps, -1, "", false, 2, 2, true);
+
+    verifyDimensions(wsProps, meshedWS);
+    // The sphere is approximated by its triangulation
+    TS_ASSERT_DIFFERS(meshedWS->y(0).front(), exactWS->y(0).front());
+    for (size_t i = 0; i < meshedWS->getNumberHistograms(); ++i) {
+      TS_ASSERT_DELTA(meshedWS->y(i).front(), exactWS->y(i).front(),
+                      0.1 * exactWS->y(i).front());
+      TS_ASSERT_DELTA(meshedWS->y(i).back(), exactWS->y(i).back(),
+                      0.1 * exactWS->y(i).back());
+    }
+  }
+
   void test_Workspace_With_Sample_And_Container() {
     using Mantid::Kernel::DeltaEMode;
     TestWorkspaceDescriptor wsProps = {1, 10, Environment::SamplePlusContainer,
@@ -322,7 +340,7 @@ private:
   runAlgorithm(const TestWorkspaceDescriptor &wsProps, int nlambda = -1,
                const std::string &interpolate = "",
                const bool sparseInstrument = false, const int sparseRows = 2,
-               const int sparseColumns = 2) {
+               const int sparseColumns = 2, const bool useMesh = false) {
     auto inputWS = setUpWS(wsProps);
     auto mcabs = createAlgorithm();
     TS_ASSERT_THROWS_NOTHING(mcabs->setProperty("InputWorkspace", inputWS));
@@ -339,6 +357,9 @@ private:
       mcabs->setProperty("NumberOfDetectorRows", sparseRows);
       mcabs->setProperty("NumberOfDetectorColumns", sparseColumns);
     }
+    if (useMesh) {
+      mcabs->setProperty("UseMeshAcceleration", true);
+    }
     mcabs->execute();
     return getOutputWorkspace(mcabs);
   }
@@ -151,6 +151,33 @@ public:
     }
   }
 
+  void testExecWithMeshAcceleration() {
+    SolidAngle meshed;
+    meshed.initialize();
+    meshed.setChild(true);
+    meshed.setPropertyValue("InputWorkspace", inputSpace);
+    meshed.setPropertyValue("OutputWorkspace", "unused");
+    meshed.setProperty("UseMeshAcceleration", true);
+    TS_ASSERT_THROWS_NOTHING(meshed.execute());
+    TS_ASSERT(meshed.isExecuted());
+
+    SolidAngle exact;
+    exact.initialize();
+    exact.setChild(true);
+    exact.setPropertyValue("InputWorkspace", inputSpace);
+    exact.setPropertyValue("OutputWorkspace", "unused");
+    exact.execute();
+    MatrixWorkspace_sptr exactOutput = exact.getProperty("OutputWorkspace");
+
+    MatrixWorkspace_sptr output = meshed.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), Nhist);
+    // The curved detectors are approximated by their triangulation
+    TS_ASSERT_DIFFERS(output->y(5)[0], exactOutput->y(5)[0]);
+    TS_ASSERT_DELTA(output->y(5)[0], 0.00139822, 0.00003);
+    TS_ASSERT_DELTA(output->y(50)[0], 0.00139822, 0.00003);
+    TS_ASSERT_EQUALS(output->y(143).front(), 0);
+  }
+
 private:
   SolidAngle alg;
   std::string inputSpace;
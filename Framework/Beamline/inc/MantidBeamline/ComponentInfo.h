@@ -97,10 +97,15 @@ public:
                    const Eigen::Vector3d &newPosition);
   void setRotation(const size_t componentIndex,
                    const Eigen::Quaterniond &newRotation);
+  void
+  setPositionsAndRotations(const std::vector<size_t> &componentIndices,
+                           const std::vector<Eigen::Vector3d> &newPositions,
+                           const std::vector<Eigen::Quaterniond> &newRotations);
 
   size_t parent(const size_t componentIndex) const;
   bool hasParent(const size_t componentIndex) const;
   bool hasDetectorInfo() const;
+  uint64_t detectorPositionsVersion() const;
   void setDetectorInfo(DetectorInfo *detectorInfo);
   bool hasSource() const;
   bool hasSample() const;
@@ -6,6 +6,9 @@
 
 #include "Eigen/Geometry"
 
+#include <atomic>
+#include <cstdint>
+
 namespace Mantid {
 namespace Beamline {
 
@@ -89,6 +92,7 @@ public:
   void setRotation(const size_t index, const Eigen::Quaterniond &rotation);
   void setRotation(const std::pair<size_t, size_t> &index,
                    const Eigen::Quaterniond &rotation);
+  uint64_t positionsVersion() const;
 
   size_t scanCount(const size_t index) const;
   std::pair<int64_t, int64_t>
@@ -115,12 +119,27 @@ private:
   void checkSizes(const DetectorInfo &other) const;
   void checkIdenticalIntervals(const DetectorInfo &other, const size_t index1,
                                const size_t index2) const;
+  /// Version number that is copied with the DetectorInfo. It is assigned
+  /// lazily by const readers, so it is atomic.
+  struct PositionsVersion {
+    PositionsVersion() = default;
+    PositionsVersion(const PositionsVersion &other)
+        : value(other.value.load()) {}
+    PositionsVersion &operator=(const PositionsVersion &other) {
+      value = other.value.load();
+      return *this;
+    }
+    std::atomic<uint64_t> value{0};
+  };
+
   bool m_isSyncScan{true};
 
   Kernel::cow_ptr<std::vector<bool>> m_isMonitor{nullptr};
   Kernel::cow_ptr<std::vector<bool>> m_isMasked{nullptr};
   Kernel::cow_ptr<std::vector<Eigen::Vector3d>> m_positions{nullptr};
   Kernel::cow_ptr<std::vector<Eigen::Quaterniond>> m_rotations{nullptr};
+  /// Identifies the current positions, 0 until positionsVersion() is called
+  mutable PositionsVersion m_positionsVersion;
 
   Kernel::cow_ptr<std::vector<size_t>> m_scanCounts{nullptr};
   Kernel::cow_ptr<std::vector<std::pair<int64_t, int64_t>>> m_scanIntervals{
@@ -185,12 +204,14 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_positionsVersion.value = 0;
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
   m_positions.access()[linearIndex(index)] = position;
+  m_positionsVersion.value = 0;
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -1,7 +1,9 @@
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
 #include <boost/make_shared.hpp>
+#include <algorithm>
 #include <numeric>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -241,22 +243,109 @@ void ComponentInfo::setRotation(const size_t componentIndex,
   if (!range.empty())
     failIfScanning();
   for (const auto &index : range) {
-    auto newPos =
+    const Eigen::Vector3d newPos =
         transform * (m_detectorInfo->position({index, 0}) - compPos) + compPos;
-    auto newRot = rotDelta * m_detectorInfo->rotation({index, 0});
+    const Eigen::Quaterniond newRot =
+        rotDelta * m_detectorInfo->rotation({index, 0});
     m_detectorInfo->setPosition({index, 0}, newPos);
     m_detectorInfo->setRotation({index, 0}, newRot);
   }
 
   for (const auto &index : componentRangeInSubtree(componentIndex)) {
-    auto newPos = transform * (position(index) - compPos) + compPos;
-    auto newRot = rotDelta * rotation(index);
+    const Eigen::Vector3d newPos =
+        transform * (position(index) - compPos) + compPos;
+    const Eigen::Quaterniond newRot = rotDelta * rotation(index);
     const size_t childCompIndexOffset = compOffsetIndex(index);
     m_positions.access()[childCompIndexOffset] = newPos;
     m_rotations.access()[childCompIndexOffset] = newRot.normalized();
   }
 }
 
+/**
+ * Sets the absolute positions and rotations of several components in one go.
+ *
+ * Each update moves and rotates the subtree of its component in a single pass,
+ * rather than one pass each for setPosition and setRotation. Components whose
+ * position and rotation are unchanged are skipped, so their subtrees are not
+ * touched. All inputs are validated before anything is modified, a batch that
+ * throws leaves the beamline unchanged.
+ *
+ * Updates may be nested, e.g. a bank and one of its tubes. The targets are
+ * absolute, so the tube ends up at the given position regardless of the move
+ * of the bank.
+ *
+ * @param componentIndices : Indices of the components to update
+ * @param newPositions : Absolute positions, one per component index
+ * @param newRotations : Absolute rotations, one per component index
+ */
+void ComponentInfo::setPositionsAndRotations(
+    const std::vector<size_t> &componentIndices,
+    const std::vector<Eigen::Vector3d> &newPositions,
+    const std::vector<Eigen::Quaterniond> &newRotations) {
+  if (componentIndices.size() != newPositions.size() ||
+      componentIndices.size() != newRotations.size()) {
+    throw std::invalid_argument("ComponentInfo::setPositionsAndRotations - "
+                                "inputs must have the same size");
+  }
+  bool movesDetectors = false;
+  for (const auto index : componentIndices) {
+    if (index >= size())
+      throw std::out_of_range("ComponentInfo::setPositionsAndRotations - "
+                              "component index out of range");
+    movesDetectors |=
+        isDetector(index) || !detectorRangeInSubtree(index).empty();
+  }
+  if (movesDetectors)
+    failIfScanning();
+
+  // A parent always has a larger index than its children. Applying updates
+  // in order of decreasing index moves parents first, nested updates then
+  // start from the already moved state of their subtree.
+  std::vector<size_t> order(componentIndices.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&componentIndices](const size_t a, const size_t b) {
+                     return componentIndices[a] > componentIndices[b];
+                   });
+
+  for (const auto i : order) {
+    const size_t componentIndex = componentIndices[i];
+    const Eigen::Vector3d &newPosition = newPositions[i];
+    const Eigen::Quaterniond &newRotation = newRotations[i];
+    if (isDetector(componentIndex)) {
+      m_detectorInfo->setPosition({componentIndex, 0}, newPosition);
+      m_detectorInfo->setRotation({componentIndex, 0}, newRotation);
+      continue;
+    }
+
+    const Eigen::Vector3d oldPosition = position(componentIndex);
+    const Eigen::Quaterniond oldRotation = rotation(componentIndex);
+    if (newPosition == oldPosition &&
+        newRotation.coeffs() == oldRotation.coeffs())
+      continue;
+    const Eigen::Quaterniond rotDelta =
+        (newRotation * oldRotation.inverse()).normalized();
+    const Eigen::Matrix3d transform(rotDelta);
+
+    for (const auto &index : detectorRangeInSubtree(componentIndex)) {
+      m_detectorInfo->setPosition(
+          {index, 0},
+          transform * (m_detectorInfo->position({index, 0}) - oldPosition) +
+              newPosition);
+      m_detectorInfo->setRotation(
+          {index, 0}, rotDelta * m_detectorInfo->rotation({index, 0}));
+    }
+    auto &positions = m_positions.access();
+    auto &rotations = m_rotations.access();
+    for (const auto &index : componentRangeInSubtree(componentIndex)) {
+      const size_t offsetIndex = compOffsetIndex(index);
+      positions[offsetIndex] =
+          transform * (positions[offsetIndex] - oldPosition) + newPosition;
+      rotations[offsetIndex] = (rotDelta * rotations[offsetIndex]).normalized();
+    }
+  }
+}
+
 void ComponentInfo::failIfScanning() const {
   if (m_detectorInfo->isScanning()) {
     throw std::runtime_error(
@@ -278,6 +367,12 @@ bool ComponentInfo::hasDetectorInfo() const {
   return m_detectorInfo != nullptr;
 }
 
+/// Returns the version of the detector positions, see
+/// DetectorInfo::positionsVersion()
+uint64_t ComponentInfo::detectorPositionsVersion() const {
+  return hasDetectorInfo() ? m_detectorInfo->positionsVersion() : 0;
+}
+
 void ComponentInfo::setDetectorInfo(DetectorInfo *detectorInfo) {
   if (detectorInfo->size() != m_assemblySortedDetectorIndices->size()) {
     throw std::invalid_argument("ComponentInfo must have detector indices "
@@ -7,6 +7,11 @@
 namespace Mantid {
 namespace Beamline {
 
+namespace {
+/// Source of the versions handed out by DetectorInfo::positionsVersion()
+std::atomic<uint64_t> g_lastPositionsVersion{0};
+}
+
 DetectorInfo::DetectorInfo(std::vector<Eigen::Vector3d> positions,
                            std::vector<Eigen::Quaterniond> rotations)
     : m_isMonitor(Kernel::make_cow<std::vector<bool>>(positions.size())),
@@ -250,6 +255,7 @@ getIndex(const Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> &indices,
  * index in `other` is identical to a corresponding interval in `this`, it is
  * ignored, i.e., no time index is added. */
 void DetectorInfo::merge(const DetectorInfo &other) {
+  m_positionsVersion.value = 0;
   if (!m_scanCounts)
     initScanCounts();
   if (m_isSyncScan) {
@@ -298,6 +304,23 @@ void DetectorInfo::merge(const DetectorInfo &other) {
   m_scanCounts = std::move(scanCounts);
 }
 
+/** Returns a number identifying the current detector positions.
+ *
+ * Setting any position gives a new number, and copies share the number only
+ * until one of them is modified, so equal numbers imply equal positions. This
+ * allows caching data derived from the positions without comparing them. Safe
+ * to call concurrently, all callers get the same number. */
+uint64_t DetectorInfo::positionsVersion() const {
+  uint64_t version = m_positionsVersion.value.load();
+  if (version != 0)
+    return version;
+  const uint64_t fresh = ++g_lastPositionsVersion;
+  // If another thread assigned a version first `version` is set to it
+  if (m_positionsVersion.value.compare_exchange_strong(version, fresh))
+    return fresh;
+  return version;
+}
+
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) {
   m_componentInfo = componentInfo;
 }
@@ -444,6 +444,62 @@ public:
         detector2UpdatedPosition.isApprox(Vector3d{1, -1, -1}));
   }
 
+  void test_set_positions_and_rotations_matches_individual_updates() {
+    using namespace Eigen;
+    auto batchOutputs = makeTreeExampleAndReturnGeometricArguments();
+    auto singleOutputs = makeTreeExampleAndReturnGeometricArguments();
+    ComponentInfo &batch = std::get<0>(batchOutputs);
+    ComponentInfo &single = std::get<0>(singleOutputs);
+
+    // Move and rotate the root, and independently the sub-assembly and a
+    // detector within it. Targets are absolute so the order of the batch
+    // must not matter.
+    const std::vector<size_t> indices{0, 3, 4};
+    const std::vector<Vector3d> positions{
+        {5, 5, 5}, {2, 0, 1}, {1, 2, 3}};
+    const std::vector<Quaterniond> rotations{
+        Quaterniond(AngleAxisd(M_PI / 3, Vector3d::UnitX())),
+        Quaterniond(AngleAxisd(M_PI / 4, Vector3d::UnitZ())),
+        Quaterniond(AngleAxisd(M_PI / 2, Vector3d::UnitY()))};
+
+    batch.setPositionsAndRotations(indices, positions, rotations);
+    for (const size_t i : {2, 1, 0}) {
+      single.setPosition(indices[i], positions[i]);
+      single.setRotation(indices[i], rotations[i]);
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+      TS_ASSERT(batch.position(i).isApprox(single.position(i), 1e-12));
+      TS_ASSERT(batch.rotation(i).isApprox(single.rotation(i), 1e-12));
+    }
+    for (size_t i = 0; i < indices.size(); ++i) {
+      TS_ASSERT(batch.position(indices[i]).isApprox(positions[i], 1e-12));
+      TS_ASSERT(batch.rotation(indices[i]).isApprox(rotations[i], 1e-12));
+    }
+  }
+
+  void test_set_positions_and_rotations_is_all_or_nothing() {
+    auto allOutputs = makeTreeExampleAndReturnGeometricArguments();
+    ComponentInfo &info = std::get<0>(allOutputs);
+    const auto detPositions = std::get<1>(allOutputs);
+    const auto compPositions = std::get<3>(allOutputs);
+    const Eigen::Quaterniond identity = Eigen::Quaterniond::Identity();
+
+    TS_ASSERT_THROWS(info.setPositionsAndRotations(
+                         {3}, {Eigen::Vector3d{1, 2, 3}}, {}),
+                     std::invalid_argument &);
+    TS_ASSERT_THROWS(
+        info.setPositionsAndRotations(
+            {3, 5}, {Eigen::Vector3d{1, 2, 3}, Eigen::Vector3d{1, 2, 3}},
+            {identity, identity}),
+        std::out_of_range &);
+
+    for (size_t i = 0; i < detPositions.size(); ++i)
+      TS_ASSERT(info.position(i).isApprox(detPositions[i]));
+    for (size_t i = 0; i < compPositions.size(); ++i)
+      TS_ASSERT(info.position(i + 3).isApprox(compPositions[i]));
+  }
+
   void test_detector_indexes() {
 
     auto infos = makeTreeExample();
@@ -263,6 +263,27 @@ public:
     TS_ASSERT_EQUALS(info.position(0), pos);
   }
 
+  void test_positionsVersion() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    const auto version = info.positionsVersion();
+    TS_ASSERT_EQUALS(info.positionsVersion(), version);
+    info.setRotation(0, Eigen::Quaterniond(1, 2, 3, 4));
+    TS_ASSERT_EQUALS(info.positionsVersion(), version);
+
+    DetectorInfo copy(info);
+    TS_ASSERT_EQUALS(copy.positionsVersion(), version);
+    copy.setPosition(0, Eigen::Vector3d(1, 2, 3));
+    TS_ASSERT_DIFFERS(copy.positionsVersion(), version);
+    TS_ASSERT_EQUALS(info.positionsVersion(), version);
+    // Modifying the original gives a version distinct from the copy's
+    info.setPosition({1, 0}, Eigen::Vector3d(1, 2, 3));
+    TS_ASSERT_DIFFERS(info.positionsVersion(), version);
+    TS_ASSERT_DIFFERS(info.positionsVersion(), copy.positionsVersion());
+
+    copy = info;
+    TS_ASSERT_EQUALS(copy.positionsVersion(), info.positionsVersion());
+  }
+
   void test_setRotattion() {
     DetectorInfo info(PosVec(1), RotVec(1));
     Eigen::Quaterniond rot{1, 2, 3, 4};
@@ -67,6 +67,10 @@ void adjustBankPositionsAndSizes(const std::vector<std::string> &bankNames,
                                  ComponentInfo &componentInfo) {
   boost::shared_ptr<ParameterMap> pmap = newInstrument.getParameterMap();
 
+  std::vector<boost::shared_ptr<const RectangularDetector>> banks;
+  std::vector<size_t> bankComponentIndices;
+  std::vector<V3D> newPositions;
+  std::vector<Quat> newRotations;
   for (const auto &bankName : bankNames) {
     boost::shared_ptr<const IComponent> bank1 =
         newInstrument.getComponentByName(bankName);
@@ -75,17 +79,20 @@ void adjustBankPositionsAndSizes(const std::vector<std::string> &bankNames,
 
     Quat relRot = bank->getRelativeRot();
     Quat parentRot = bank->getParent()->getRotation();
-    Quat newRot = parentRot * rot * relRot;
-
-    const auto bankComponentIndex =
-        componentInfo.indexOf(bank->getComponentID());
-    componentInfo.setRotation(bankComponentIndex, newRot);
-
     V3D rotatedPos = V3D(pos);
-    bank->getParent()->getRotation().rotate(rotatedPos);
+    parentRot.rotate(rotatedPos);
 
-    componentInfo.setPosition(bankComponentIndex, rotatedPos + bank->getPos());
+    banks.push_back(bank);
+    bankComponentIndices.push_back(
+        componentInfo.indexOf(bank->getComponentID()));
+    newRotations.push_back(parentRot * rot * relRot);
+    newPositions.push_back(rotatedPos + bank->getPos());
+  }
+  // Move all banks in one batch so each is only transformed once
+  componentInfo.setPositionsAndRotations(bankComponentIndices, newPositions,
+                                         newRotations);
 
+  for (const auto &bank : banks) {
     std::vector<double> oldScalex =
         pmap->getDouble(bank->getName(), std::string("scalex"));
     std::vector<double> oldScaley =
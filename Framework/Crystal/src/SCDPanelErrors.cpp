@@ -11,6 +11,7 @@
 #include "MantidGeometry/Crystal/OrientedLattice.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Instrument/Component.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include <boost/math/special_functions/round.hpp>
 #include <algorithm>
 #include <cmath>
@@ -78,69 +79,28 @@ void SCDPanelErrors::moveDetector(double x, double y, double z, double rotx,
   if (inst->getName().compare("CORELLI") == 0.0 && detname != "moderator")
     detname.append("/sixteenpack");
 
-  if (x != 0.0 || y != 0.0 || z != 0.0) {
-    IAlgorithm_sptr alg1 = Mantid::API::AlgorithmFactory::Instance().create(
-        "MoveInstrumentComponent", -1);
-    alg1->initialize();
-    alg1->setChild(true);
-    alg1->setLogging(false);
-    alg1->setProperty<Workspace_sptr>("Workspace", inputW);
-    alg1->setPropertyValue("ComponentName", detname);
-    // Move in m
-    alg1->setProperty("X", x);
-    alg1->setProperty("Y", y);
-    alg1->setProperty("Z", z);
-    alg1->setPropertyValue("RelativePosition", "1");
-    alg1->execute();
-  }
-
-  if (rotx != 0.0) {
-    IAlgorithm_sptr algx = Mantid::API::AlgorithmFactory::Instance().create(
-        "RotateInstrumentComponent", -1);
-    algx->initialize();
-    algx->setChild(true);
-    algx->setLogging(false);
-    algx->setProperty<Workspace_sptr>("Workspace", inputW);
-    algx->setPropertyValue("ComponentName", detname);
-    algx->setProperty("X", 1.0);
-    algx->setProperty("Y", 0.0);
-    algx->setProperty("Z", 0.0);
-    algx->setProperty("Angle", rotx);
-    algx->setPropertyValue("RelativeRotation", "1");
-    algx->execute();
-  }
-
-  if (roty != 0.0) {
-    IAlgorithm_sptr algy = Mantid::API::AlgorithmFactory::Instance().create(
-        "RotateInstrumentComponent", -1);
-    algy->initialize();
-    algy->setChild(true);
-    algy->setLogging(false);
-    algy->setProperty<Workspace_sptr>("Workspace", inputW);
-    algy->setPropertyValue("ComponentName", detname);
-    algy->setProperty("X", 0.0);
-    algy->setProperty("Y", 1.0);
-    algy->setProperty("Z", 0.0);
-    algy->setProperty("Angle", roty);
-    algy->setPropertyValue("RelativeRotation", "1");
-    algy->execute();
+  if (x != 0.0 || y != 0.0 || z != 0.0 || rotx != 0.0 || roty != 0.0 ||
+      rotz != 0.0) {
+    Geometry::IComponent_const_sptr comp = inst->getComponentByName(detname);
+    if (!comp)
+      throw std::runtime_error("Component with name " + detname +
+                               " was not found.");
+    // Same result as MoveInstrumentComponent followed by relative
+    // RotateInstrumentComponent about X, Y and Z, but the panel is only
+    // transformed once instead of up to four times per evaluation.
+    auto &componentInfo = inputP->mutableComponentInfo();
+    const size_t index = componentInfo.indexOf(comp->getComponentID());
+    Quat rotation = componentInfo.rotation(index);
+    if (rotx != 0.0)
+      rotation = rotation * Quat(rotx, V3D(1.0, 0.0, 0.0));
+    if (roty != 0.0)
+      rotation = rotation * Quat(roty, V3D(0.0, 1.0, 0.0));
+    if (rotz != 0.0)
+      rotation = rotation * Quat(rotz, V3D(0.0, 0.0, 1.0));
+    componentInfo.setPositionsAndRotations(
+        {index}, {componentInfo.position(index) + V3D(x, y, z)}, {rotation});
   }
 
-  if (rotz != 0.0) {
-    IAlgorithm_sptr algz = Mantid::API::AlgorithmFactory::Instance().create(
-        "RotateInstrumentComponent", -1);
-    algz->initialize();
-    algz->setChild(true);
-    algz->setLogging(false);
-    algz->setProperty<Workspace_sptr>("Workspace", inputW);
-    algz->setPropertyValue("ComponentName", detname);
-    algz->setProperty("X", 0.0);
-    algz->setProperty("Y", 0.0);
-    algz->setProperty("Z", 1.0);
-    algz->setProperty("Angle", rotz);
-    algz->setPropertyValue("RelativeRotation", "1");
-    algz->execute();
-  }
   if (scalex != 1.0 || scaley != 1.0) {
     Geometry::IComponent_const_sptr comp = inst->getComponentByName(detname);
     boost::shared_ptr<const Geometry::RectangularDetector> rectDet =
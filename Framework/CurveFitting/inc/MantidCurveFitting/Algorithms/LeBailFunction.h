@@ -152,6 +152,11 @@ private:
       const std::vector<double> &vecX, const std::vector<double> &vecY,
       std::vector<double> &vec_summedpeaks);
 
+  /// Get a peak's values over a range, calculating them only if changed
+  const std::vector<double> &
+  getPeakProfile(const API::IPowderDiffPeakFunction_sptr &peak,
+                 const std::vector<double> &datax);
+
   /// Group close peaks together
   void groupPeaks(
       std::vector<std::vector<
@@ -187,6 +192,18 @@ private:
   /// Parameters
   std::map<std::string, double> m_functionParameters;
 
+  /// The values of a peak over the range of its group
+  struct PeakProfile {
+    /// The peak's parameter values the profile was calculated with
+    std::vector<double> parameters;
+    /// The x values of the range
+    std::vector<double> x;
+    /// The peak's values at x
+    std::vector<double> values;
+  };
+  /// Last calculated values of each peak
+  std::map<const API::IPowderDiffPeakFunction *, PeakProfile> m_peakProfiles;
+
   /// Has new peak values
   mutable bool m_hasNewPeakValue;
 
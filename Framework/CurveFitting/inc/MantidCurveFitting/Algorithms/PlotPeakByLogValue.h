@@ -6,6 +6,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/IFunction.h"
+#include "MantidAPI/ITableWorkspace_fwd.h"
 
 namespace Mantid {
 namespace CurveFitting {
@@ -105,6 +106,19 @@ private:
   /// Create a list of input workspace names
   std::vector<InputData> makeNames() const;
 
+  /// Check if the spectra can be fitted without Fit child algorithms
+  bool canFitWithBatchFitter() const;
+
+  /// Fit a range of spectra of a workspace with a BatchFitter
+  void fitWithBatchFitter(const InputData &data, const std::string &name,
+                          const int start, const int end,
+                          const bool individual, API::IFunction_sptr ifun,
+                          API::Progress &prog, API::ITableWorkspace &result);
+
+  /// Get the value to plot the parameters of a spectrum against
+  double getLogValue(const API::MatrixWorkspace &ws, const int wsIndex,
+                     const std::string &logName) const;
+
   /// Create a minimizer string based on template string provided
   std::string getMinimizerString(const std::string &wsName,
                                  const std::string &wsIndex);
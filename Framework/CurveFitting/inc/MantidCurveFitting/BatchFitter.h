@@ -0,0 +1,125 @@
+#ifndef MANTID_CURVEFITTING_BATCHFITTER_H_
+#define MANTID_CURVEFITTING_BATCHFITTER_H_
+
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/ITableWorkspace_fwd.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidKernel/EmptyValues.h"
+#include "MantidKernel/System.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class ProgressBase;
+}
+namespace CurveFitting {
+
+/** BatchFitter : Fits one function independently to many spectra of a
+  MatrixWorkspace.
+
+  By default all fits start from the parameter values of the same function,
+  use the least squares cost function with the Levenberg-MarquardtMD
+  minimizer and run in parallel. Each thread keeps its own copy of the
+  function, the cost function, the minimizer and the fitting data buffers and
+  reuses them for all of its fits, so a fit costs no more than the
+  minimization itself. In contrast, running Fit as a child algorithm per
+  spectrum parses properties, recreates the function from its string and
+  allocates a new domain and minimizer every time.
+
+  In chained mode the spectra are fitted one after another in the given order
+  and each fit starts from the parameters found by the previous one. This
+  suits series of spectra which change slowly, such as a temperature scan,
+  where the previous result is a much better starting point than the initial
+  guess.
+
+  A failing fit does not stop the others; its error message is reported in
+  the Status column of the result table. Alternatively, fit() can rethrow
+  the error of the first failed fit.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport BatchFitter {
+public:
+  explicit BatchFitter(API::IFunction_const_sptr function);
+
+  /// Set the maximum number of iterations of each fit
+  void setMaxIterations(const size_t maxIterations) {
+    m_maxIterations = maxIterations;
+  }
+  /// Set the fitting range. Both must be EMPTY_DBL() to fit whole spectra.
+  void setFittingRange(const double startX, const double endX) {
+    m_startX = startX;
+    m_endX = endX;
+  }
+  /// Give zero weight to NaN or infinite data instead of failing the fit
+  void setIgnoreInvalidData(const bool ignore) { m_ignoreInvalidData = ignore; }
+  /// Set the peak radius passed to the peak functions, 0 for the whole range
+  void setPeakRadius(const int radius) { m_peakRadius = radius; }
+  /// Start each fit from the result of the previous one, fitting serially
+  void setChained(const bool chained) { m_chained = chained; }
+  /// Make fit() throw the error of the first failed fit
+  void setRethrowErrors(const bool rethrow) { m_rethrowErrors = rethrow; }
+  /// Report the progress once per fitted spectrum. The fits stop early and
+  /// fit() throws if the progress reporter requests cancellation.
+  void setProgress(Kernel::ProgressBase *progress) { m_progress = progress; }
+  void setMinimizer(const std::string &minimizer);
+  void setCostFunction(const std::string &costFunction);
+
+  API::ITableWorkspace_sptr
+  fit(API::MatrixWorkspace_const_sptr workspace,
+      const std::vector<size_t> &workspaceIndices) const;
+
+private:
+  struct ThreadState;
+  struct Result;
+
+  std::unique_ptr<ThreadState> createThreadState() const;
+  void fitSpectrum(const API::MatrixWorkspace_const_sptr &workspace,
+                   const size_t workspaceIndex,
+                   const std::vector<double> &startParameters,
+                   ThreadState &state, Result &result) const;
+  void setFittingData(const API::MatrixWorkspace &workspace,
+                      const size_t workspaceIndex, ThreadState &state) const;
+
+  /// The function fitted to every spectrum, with the initial parameters
+  API::IFunction_const_sptr m_function;
+  size_t m_maxIterations{500};
+  double m_startX{EMPTY_DBL()};
+  double m_endX{EMPTY_DBL()};
+  bool m_ignoreInvalidData{false};
+  int m_peakRadius{0};
+  bool m_chained{false};
+  bool m_rethrowErrors{false};
+  /// The minimizer, possibly with options as accepted by FuncMinimizerFactory
+  std::string m_minimizer{"Levenberg-MarquardtMD"};
+  std::string m_costFunction{"Least squares"};
+  /// Reports the progress of the fits, if set
+  Kernel::ProgressBase *m_progress{nullptr};
+};
+
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_BATCHFITTER_H_ */
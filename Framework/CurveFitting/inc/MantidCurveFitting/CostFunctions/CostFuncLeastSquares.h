@@ -9,6 +9,10 @@
 #include "MantidCurveFitting/GSLVector.h"
 
 namespace Mantid {
+namespace API {
+class CompositeDomain;
+class MultiDomainFunction;
+}
 namespace CurveFitting {
 class SeqDomain;
 class ParDomain;
@@ -81,6 +85,10 @@ protected:
                           API::FunctionDomain_sptr domain,
                           API::FunctionValues_sptr values,
                           bool evalDeriv = true, bool evalHessian = true) const;
+  void addMultiDomainValDerivHessian(API::MultiDomainFunction &function,
+                                     const API::CompositeDomain &domain,
+                                     API::FunctionValues_sptr values,
+                                     bool evalHessian) const;
 
   /// Get mapped weights from FunctionValues
   virtual std::vector<double>
@@ -7,6 +7,7 @@
 #include "MantidAPI/IFuncMinimizer.h"
 #include "MantidCurveFitting/GSLVector.h"
 #include "MantidCurveFitting/GSLMatrix.h"
+#include "MantidCurveFitting/ParameterBlocks.h"
 
 namespace Mantid {
 namespace CurveFitting {
@@ -71,6 +72,8 @@ private:
   /// To keep function value
   double m_F;
   std::vector<double> m_D;
+  /// The local and global parameters of a multi-domain fit
+  ParameterBlocks m_blocks;
 };
 
 } // namespace FuncMinimisers
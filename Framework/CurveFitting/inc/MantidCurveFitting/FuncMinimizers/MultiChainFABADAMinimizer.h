@@ -0,0 +1,137 @@
+#ifndef MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZER_H_
+#define MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZER_H_
+
+#include "MantidAPI/IFuncMinimizer.h"
+#include "MantidCurveFitting/GSLVector.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace CostFunctions {
+/// Forward Declaration
+class CostFuncLeastSquares;
+}
+namespace FuncMinimisers {
+
+/** MultiChainFABADAMinimizer : A Bayesian sampler in the spirit of FABADA
+  that runs several Markov chains at once.
+
+  NumberOfChains independent replicas each hold a ladder of
+  NumberOfTemperatures chains, with temperatures spaced geometrically from 1
+  to MaximumTemperature. Every iteration makes one adaptive Metropolis sweep
+  over the parameters of every chain, with the chains running in parallel,
+  followed by parallel tempering swaps between neighbouring temperatures of
+  a replica. The burn-in is shared: the jumps are adapted until the
+  Gelman-Rubin statistic (R-hat) of the cold chains is below
+  ConvergenceCriteria for every parameter, then all the cold chains are
+  sampled together.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport MultiChainFABADAMinimizer : public API::IFuncMinimizer {
+public:
+  /// Constructor
+  MultiChainFABADAMinimizer();
+  /// Destructor
+  ~MultiChainFABADAMinimizer() override;
+  /// Name of the minimizer.
+  std::string name() const override { return "MultiChainFABADA"; }
+  /// Initialize minimizer, i.e. pass a function to minimize.
+  void initialize(API::ICostFunction_sptr function,
+                  size_t maxIterations) override;
+  /// Do one iteration.
+  bool iterate(size_t iter) override;
+  /// Return current value of the cost function
+  double costFunctionVal() override;
+  /// Finalize minimization, eg store additional outputs
+  void finalize() override;
+
+  /// Split R-hat of a set of equally long sequences of one parameter
+  static double gelmanRubin(const std::vector<std::vector<double>> &sequences);
+
+private:
+  struct Chain;
+  /// Create the chains, all starting near the initial parameters
+  void initChains();
+  /// Find the boundary constraints of the active parameters
+  void initBounds();
+  /// Do one Metropolis sweep over the parameters of a chain
+  void sweep(Chain &chain);
+  /// Keep a proposed value inside the bounds of its parameter
+  double reflect(size_t parameterIndex, double value) const;
+  /// Try to swap the states of neighbouring temperatures
+  void temperatureSwaps();
+  /// Adapt the jumps from the recent acceptance rates
+  void jumpUpdate();
+  /// Check if the cold chains have converged
+  bool burnInConverged() const;
+  /// The cold chain of a replica
+  Chain &coldChain(size_t replica);
+  /// Output the parameter table
+  void outputParameterTable(const std::vector<double> &values,
+                            const std::vector<double> &errorsLeft,
+                            const std::vector<double> &errorsRight,
+                            const std::vector<double> &rHat);
+  /// Output the sampled chains
+  void outputChains();
+
+  /// The cost function of the fit
+  boost::shared_ptr<CostFunctions::CostFuncLeastSquares> m_leastSquares;
+  /// Number of active parameters
+  size_t m_nParams;
+  /// Number of independent replicas
+  size_t m_nReplicas;
+  /// Number of temperatures of each replica
+  size_t m_nTemperatures;
+  /// The chains, ordered by replica then by increasing temperature
+  std::vector<std::unique_ptr<Chain>> m_chains;
+  /// The lower and upper bounds of the active parameters
+  std::vector<std::pair<double, double>> m_bounds;
+  /// Sweeps done in the current phase
+  size_t m_counter;
+  /// True once the burn-in has converged
+  bool m_converged;
+  /// Sweeps each cold chain makes after the burn-in
+  size_t m_samplingSweeps;
+  /// Sweeps between the samples that are kept
+  size_t m_stepsBetweenValues;
+  /// The maximum number of iterations
+  size_t m_maxIter;
+  /// Generator used for the swaps
+  std::mt19937 m_generator;
+  /// Cold chain positions during the burn-in, [replica][parameter][sweep]
+  std::vector<std::vector<std::vector<double>>> m_burnIn;
+  /// Sampled cold chains, [replica][parameter][sample], the last
+  /// "parameter" being the cost function
+  std::vector<std::vector<std::vector<double>>> m_samples;
+  /// Current value of the cost function
+  double m_chi2;
+};
+
+} // namespace FuncMinimisers
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZER_H_ */
@@ -0,0 +1,84 @@
+#ifndef MANTID_CURVEFITTING_CHEBFUNCACHE_H_
+#define MANTID_CURVEFITTING_CHEBFUNCACHE_H_
+
+#include "MantidCurveFitting/Functions/SimpleChebfun.h"
+#include "MantidKernel/System.h"
+
+#include <functional>
+#include <list>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace Functions {
+
+/** ChebfunCache : keeps Chebyshev approximations of an expensive kernel of
+  one variable which also depends on a few other parameters.
+
+  A fitting function creates the cache with a builder which approximates the
+  kernel for a set of values of the other parameters, the key. The function
+  then evaluates the approximations instead of the kernel. An approximation is
+  built the first time its key is requested and the most recently used ones
+  are kept, so a fit which changes the key only now and then, or goes back to
+  previous values while calculating numerical derivatives, mostly finds them
+  ready.
+
+  The builder may return an empty pointer if the kernel cannot be
+  approximated for a key; the calling function must then evaluate the kernel
+  directly. The cache is not thread safe: every function object owns its
+  cache.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport ChebfunCache {
+public:
+  typedef boost::shared_ptr<const SimpleChebfun> Approximation;
+  /// Creates the approximation for a key
+  typedef std::function<Approximation(const std::vector<double> &)> Builder;
+
+  /// Constructor.
+  explicit ChebfunCache(Builder builder, size_t maxSize = 8);
+  /// Get the approximation for a key, building it if necessary.
+  Approximation get(const std::vector<double> &key);
+  /// Number of cached approximations.
+  size_t size() const { return m_entries.size(); }
+  /// Remove all the approximations.
+  void clear() { m_entries.clear(); }
+
+  /// Approximate a function to a given accuracy.
+  static Approximation approximate(ChebfunFunctionType fun, double start,
+                                   double end, double accuracy,
+                                   size_t maxOrder = 1024);
+
+private:
+  Builder m_builder;
+  size_t m_maxSize;
+  /// The approximations with their keys, most recently used first
+  std::list<std::pair<std::vector<double>, Approximation>> m_entries;
+};
+
+} // namespace Functions
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_CHEBFUNCACHE_H_ */
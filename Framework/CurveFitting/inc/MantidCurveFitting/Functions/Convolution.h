@@ -5,6 +5,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAPI/CompositeFunction.h"
+#include "MantidAPI/FunctionDomain1D.h"
 #include <boost/shared_array.hpp>
 #include <cmath>
 #include <vector>
@@ -140,9 +141,10 @@ public:
   /// Set up the function for a fit.
   void setUpForFit() override;
 
-  /// Deletes and zeroes pointer m_resolution forsing function(...) to
-  /// recalculate the resolution function
-  void refreshResolution() const;
+  /// Clears m_resolution if the resolution must be recalculated for the
+  /// domain
+  void refreshResolution(const API::FunctionDomain1D &domain,
+                         const bool directMode) const;
 
 protected:
   /// overwrite IFunction base class method, which declare function parameters
@@ -153,6 +155,12 @@ private:
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// The mode, domain size and resolution parameters m_resolution was
+  /// calculated for
+  mutable std::vector<double> m_resolutionKey;
+  /// Hash of the x values and the resolution attributes m_resolution was
+  /// calculated for
+  mutable size_t m_resolutionHash = 0;
 };
 
 } // namespace Functions
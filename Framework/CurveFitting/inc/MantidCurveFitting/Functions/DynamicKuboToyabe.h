@@ -7,6 +7,7 @@
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidAPI/IFunctionMW.h"
 #include "MantidAPI/IFunctionWithLocation.h"
+#include "MantidCurveFitting/Functions/ChebfunCache.h"
 #include <cmath>
 
 namespace Mantid {
@@ -83,6 +84,9 @@ private:
   /// Bin width
   double m_eps;
   double m_minEps, m_maxEps;
+  /// Approximations of the integral in the static Kubo Toyabe function in a
+  /// field, which otherwise takes most of the time
+  mutable ChebfunCache m_fieldIntegrals;
 };
 
 } // namespace Functions
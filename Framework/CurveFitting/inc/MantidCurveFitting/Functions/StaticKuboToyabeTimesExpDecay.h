@@ -1,8 +1,9 @@
 #ifndef MANTID_CURVEFITTING_STATICKUBOTOYABETIMESEXPDECAY_H_
 #define MANTID_CURVEFITTING_STATICKUBOTOYABETIMESEXPDECAY_H_
 
-#include "MantidAPI/ParamFunction.h"
-#include "MantidAPI/IFunction1D.h"
+#include "MantidAPI/AutoDiffFunction1D.h"
+
+#include <cmath>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -38,17 +39,27 @@ namespace Functions {
   File change history is stored at: <https://github.com/mantidproject/mantid>
   Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
-class DLLExport StaticKuboToyabeTimesExpDecay : public API::ParamFunction,
-                                                public API::IFunction1D {
+class DLLExport StaticKuboToyabeTimesExpDecay
+    : public API::AutoDiffFunction1D<StaticKuboToyabeTimesExpDecay, 3> {
 public:
   std::string name() const override { return "StaticKuboToyabeTimesExpDecay"; }
 
   const std::string category() const override { return "Muon"; }
 
-protected:
-  void function1D(double *out, const double *xValues,
-                  const size_t nData) const override;
+  /// The function at x for parameters A, Delta and Lambda
+  template <typename T>
+  T evaluate(const double x, const std::array<T, 3> &parameters) const {
+    using std::exp;
+    using std::pow;
+    const double C1 = 2.0 / 3;
+    const double C2 = 1.0 / 3;
+    const T DXSquared = pow(parameters[1] * x, 2);
+    return parameters[0] *
+           (exp(-DXSquared / 2) * (1 - DXSquared) * C1 + C2) *
+           exp(-parameters[2] * x);
+  }
 
+protected:
   void init() override;
 };
 
@@ -4,8 +4,10 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
-#include "MantidAPI/ParamFunction.h"
-#include "MantidAPI/IFunction1D.h"
+#include "MantidAPI/AutoDiffFunction1D.h"
+
+#include <cmath>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -37,16 +39,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 File change history is stored at: <https://github.com/mantidproject/mantid>
 Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
-class DLLExport StretchExpMuon : public API::ParamFunction,
-                                 public API::IFunction1D {
+class DLLExport StretchExpMuon
+    : public API::AutoDiffFunction1D<StretchExpMuon, 3> {
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "StretchExpMuon"; }
   const std::string category() const override { return "Muon"; }
 
+  /// The function at x for parameters A, Lambda and Beta
+  template <typename T>
+  T evaluate(const double x, const std::array<T, 3> &parameters) const {
+    using std::exp;
+    using std::pow;
+    return parameters[0] * exp(-pow(parameters[1] * x, parameters[2]));
+  }
+
 protected:
-  void function1D(double *out, const double *xValues,
-                  const size_t nData) const override;
   void init() override;
 };
 
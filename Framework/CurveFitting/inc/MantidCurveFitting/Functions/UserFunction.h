@@ -4,9 +4,12 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
+#include "MantidAPI/CompiledExpression.h"
 #include "MantidAPI/ParamFunction.h"
 #include "MantidAPI/IFunction1D.h"
 #include <boost/shared_array.hpp>
+#include <memory>
+#include <vector>
 
 namespace mu {
 class Parser;
@@ -94,6 +97,19 @@ private:
   /// Temporary data storage used in functionDeriv
   mutable boost::shared_array<double> m_tmp1;
 
+  /// Parsers of the derivatives by each parameter. Empty if the formula
+  /// cannot be differentiated symbolically.
+  std::vector<std::unique_ptr<mu::Parser>> m_derivativeParsers;
+  /// The formula compiled for evaluation over arrays, or null if it cannot be
+  /// compiled and m_parser must be used
+  std::unique_ptr<API::CompiledExpression> m_compiled;
+  /// The compiled derivatives. Empty if any of them cannot be compiled.
+  std::vector<std::unique_ptr<API::CompiledExpression>> m_compiledDerivatives;
+
+  void setUpDerivatives();
+  std::unique_ptr<API::CompiledExpression>
+  compile(const std::string &formula);
+
   /// mu::Parser callback function for setting variables.
   static double *AddVariable(const char *varName, void *pufun);
 };
@@ -9,6 +9,7 @@
 
 #include <boost/weak_ptr.hpp>
 #include <list>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -80,6 +81,10 @@ public:
     m_startX = startX;
     m_endX = endX;
   }
+  /// Find the fitting interval of a spectrum's x values
+  static std::pair<size_t, size_t>
+  getXInterval(const std::vector<double> &X, const bool isHistogram,
+               double &startX, double &endX);
 
 protected:
   /// Calculate size and starting iterator in the X array
@@ -0,0 +1,82 @@
+#ifndef MANTID_CURVEFITTING_PARAMETERBLOCKS_H_
+#define MANTID_CURVEFITTING_PARAMETERBLOCKS_H_
+
+#include "MantidCurveFitting/DllConfig.h"
+#include "MantidCurveFitting/GSLMatrix.h"
+#include "MantidCurveFitting/GSLVector.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class IFunction;
+}
+namespace CurveFitting {
+
+/** ParameterBlocks : Splits the active parameters of a fitting function into
+  blocks of local parameters, which only affect one domain of a multi-domain
+  fit, and the global parameters, which affect several domains.
+
+  The normal equations of a least squares fit do not couple the local
+  parameters of different domains, so their matrix has the structure
+
+      | A_1          B_1 |
+      |     ...      ... |
+      |         A_n  B_n |
+      | B_1^T ...  B_n^T C |
+
+  solve() eliminates the local parameters of each domain with the Schur
+  complement of its block, which costs O(n) in the number of domains instead
+  of the O(n^3) of a dense solution.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_CURVEFITTING_DLL ParameterBlocks {
+public:
+  /// Create an empty partition
+  ParameterBlocks() = default;
+  /// Partition the active parameters of a function
+  explicit ParameterBlocks(const API::IFunction &function);
+
+  /// The number of blocks of local parameters
+  size_t nBlocks() const { return m_blocks.size(); }
+  /// The active indices of the local parameters of a block
+  const std::vector<size_t> &block(size_t i) const { return m_blocks[i]; }
+  /// The active indices of the global parameters
+  const std::vector<size_t> &globals() const { return m_globals; }
+  /// Check if solve() can be used with a matrix
+  bool isBlockStructured(const GSLMatrix &matrix) const;
+  /// Solve a system of linear equations with the block structure
+  void solve(const GSLMatrix &matrix, const GSLVector &rhs,
+             GSLVector &x) const;
+
+private:
+  /// Local parameters, one vector per domain that has any
+  std::vector<std::vector<size_t>> m_blocks;
+  /// Global parameters
+  std::vector<size_t> m_globals;
+};
+
+} // namespace CurveFitting
+} // namespace Mantid
+
+#endif /* MANTID_CURVEFITTING_PARAMETERBLOCKS_H_ */
@@ -494,7 +494,7 @@ bool LeBailFunction::calculateGroupPeakIntensities(
   // Prepare to integrate dataY to calculate peak intensity
   vector<double> sumYs(ndata, 0.0);
   size_t numPeaks(peakgroup.size());
-  vector<vector<double>> peakvalues(numPeaks);
+  vector<const vector<double> *> peakvalues(numPeaks);
 
   // Integrage peak by peak
   bool datavalueinvalid = false;
@@ -503,8 +503,7 @@ bool LeBailFunction::calculateGroupPeakIntensities(
     // value
     IPowderDiffPeakFunction_sptr peak = peakgroup[ipk].second;
     peak->setHeight(1.0);
-    vector<double> localpeakvalue(ndata, 0.0);
-    peak->function(localpeakvalue, datax);
+    const vector<double> &localpeakvalue = getPeakProfile(peak, datax);
 
     // check data
     size_t numbadpts(0);
@@ -534,7 +533,7 @@ bool LeBailFunction::calculateGroupPeakIntensities(
       g_log.debug(warnss.str());
       datavalueinvalid = true;
     }
-    peakvalues[ipk].assign(localpeakvalue.begin(), localpeakvalue.end());
+    peakvalues[ipk] = &localpeakvalue;
   } // For All peaks
 
   // Calculate intensity of all peaks
@@ -548,7 +547,7 @@ bool LeBailFunction::calculateGroupPeakIntensities(
         double temp;
         if (sumYs[i] > 1.0E-5) {
           // Reasonable non-zero value
-          double peaktogroupratio = peakvalues[ipk][i] / sumYs[i];
+          double peaktogroupratio = (*peakvalues[ipk])[i] / sumYs[i];
           temp = datay[i] * peaktogroupratio;
         } else {
           // SumY too smaller
@@ -595,7 +594,7 @@ bool LeBailFunction::calculateGroupPeakIntensities(
 
       // Add peak's value to peaksvalues
       for (size_t i = ileft; i < iright; ++i) {
-        vec_summedpeaks[i] += (intensity * peakvalues[ipk][i - ileft]);
+        vec_summedpeaks[i] += (intensity * (*peakvalues[ipk])[i - ileft]);
       }
 
     } // ENDFOR each peak
@@ -604,6 +603,39 @@ bool LeBailFunction::calculateGroupPeakIntensities(
   return peakheightsphysical;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Get the values of a peak over a range of data.  The values are cached for
+* each peak and only recalculated if any of the peak's parameters or the
+* range have changed since the last call.  Usually a step of a refinement
+* changes only some of the parameters, or is rejected and restores them, and
+* the peaks that don't depend on them are not calculated again.
+* @param peak :: peak function
+* @param datax :: x values of the range
+* @return :: the peak's values at datax
+*/
+const vector<double> &
+LeBailFunction::getPeakProfile(const IPowderDiffPeakFunction_sptr &peak,
+                               const vector<double> &datax) {
+  auto &profile = m_peakProfiles[peak.get()];
+  const size_t numparams = peak->nParams();
+  bool changed = profile.x != datax || profile.parameters.size() != numparams;
+  for (size_t i = 0; i < numparams && !changed; ++i) {
+    changed = profile.parameters[i] != peak->getParameter(i);
+  }
+
+  if (changed) {
+    profile.parameters.resize(numparams);
+    for (size_t i = 0; i < numparams; ++i) {
+      profile.parameters[i] = peak->getParameter(i);
+    }
+    profile.x = datax;
+    profile.values.assign(datax.size(), 0.0);
+    peak->function(profile.values, datax);
+  }
+
+  return profile.values;
+}
+
 //----------------------------------------------------------------------------------------------
 /** From table/map to set parameters to an individual peak.
 * It mostly is called by function in calculation.
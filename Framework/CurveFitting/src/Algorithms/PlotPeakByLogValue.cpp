@@ -8,6 +8,7 @@
 #include <boost/algorithm/string/replace.hpp>
 
 #include "MantidCurveFitting/Algorithms/PlotPeakByLogValue.h"
+#include "MantidCurveFitting/BatchFitter.h"
 #include "MantidAPI/IFuncMinimizer.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/FuncMinimizerFactory.h"
@@ -19,6 +20,7 @@
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/IFunction.h"
+#include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/TableRow.h"
 #include "MantidAPI/ITableWorkspace.h"
@@ -205,6 +207,9 @@ void PlotPeakByLogValue::exec() {
   std::vector<std::string> fit_workspaces;
   std::vector<std::string> parameter_workspaces;
 
+  // Fit the spectra without child algorithms if Fit's outputs are not needed
+  const bool batchFit = canFitWithBatchFitter();
+
   double dProg = 1. / static_cast<double>(wsNames.size());
   double Prog = 0.;
   for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
@@ -237,33 +242,18 @@ void PlotPeakByLogValue::exec() {
     }
 
     dProg /= abs(jend - j);
+    if (batchFit) {
+      Progress fitProgress(this, Prog, Prog + dProg * (jend - j), jend - j);
+      fitWithBatchFitter(data, wsNames[i].name, j, jend, individual, ifun,
+                         fitProgress, *result);
+      Prog += dProg * (jend - j);
+      continue;
+    }
     for (; j < jend; ++j) {
 
       // Find the log value: it is either a log-file value or simply the
       // workspace number
-      double logValue = 0;
-      if (logName.empty()) {
-        API::Axis *axis = data.ws->getAxis(1);
-        if (dynamic_cast<BinEdgeAxis *>(axis)) {
-          double lowerEdge((*axis)(j));
-          double upperEdge((*axis)(j + 1));
-          logValue = lowerEdge + (upperEdge - lowerEdge) / 2;
-        } else
-          logValue = (*axis)(j);
-      } else if (logName != "SourceName") {
-        Kernel::Property *prop = data.ws->run().getLogData(logName);
-        if (!prop) {
-          throw std::invalid_argument("Log value " + logName +
-                                      " does not exist");
-        }
-        TimeSeriesProperty<double> *logp =
-            dynamic_cast<TimeSeriesProperty<double> *>(prop);
-        if (!logp) {
-          throw std::runtime_error("Failed to cast " + logName +
-                                   " to TimeSeriesProperty");
-        }
-        logValue = logp->lastValue();
-      }
+      const double logValue = getLogValue(*data.ws, j, logName);
 
       double chi2;
 
@@ -394,6 +384,152 @@ void PlotPeakByLogValue::exec() {
   }
 }
 
+/** Find out if all the spectra of a workspace can be fitted at once with a
+ * BatchFitter instead of a Fit child algorithm per spectrum. This is possible
+ * unless an output of Fit other than the parameters is requested or the
+ * fitting function needs a workspace index.
+ */
+bool PlotPeakByLogValue::canFitWithBatchFitter() const {
+  const bool createFitOutput = getProperty("CreateOutput");
+  const bool passWSIndexToFunction = getProperty("PassWSIndexToFunction");
+  if (createFitOutput || passWSIndexToFunction ||
+      getPropertyValue("EvaluationType") != "CentrePoint") {
+    return false;
+  }
+  // Minimizers that write workspaces are given a name for each spectrum
+  const std::string minimizer = getPropertyValue("Minimizer");
+  if (minimizer.find('$') != std::string::npos) {
+    return false;
+  }
+  auto minimizerProps =
+      FuncMinimizerFactory::Instance().createMinimizer(minimizer)
+          ->getProperties();
+  return std::none_of(
+      minimizerProps.begin(), minimizerProps.end(),
+      [](const Kernel::Property *prop) {
+        return dynamic_cast<const API::IWorkspaceProperty *>(prop) &&
+               !prop->value().empty();
+      });
+}
+
+/** Fit a range of spectra of a workspace with a BatchFitter and append the
+ * results to the output table. Sequential fits are chained so that each fit
+ * starts from the result of the previous one; individual fits run in
+ * parallel.
+ * @param data :: The input data with the workspace
+ * @param name :: The name of the data source
+ * @param start :: The first workspace index to fit
+ * @param end :: One past the last workspace index to fit
+ * @param individual :: True if every fit starts from the initial parameters
+ * @param ifun :: The fitting function. After sequential fits it holds the
+ * parameters of the last fit.
+ * @param prog :: Reports the progress once per spectrum
+ * @param result :: The output table
+ */
+void PlotPeakByLogValue::fitWithBatchFitter(
+    const InputData &data, const std::string &name, const int start,
+    const int end, const bool individual, IFunction_sptr ifun, Progress &prog,
+    ITableWorkspace &result) {
+  std::vector<size_t> indices;
+  indices.reserve(end - start);
+  for (int j = start; j < end; ++j) {
+    indices.push_back(static_cast<size_t>(j));
+  }
+
+  const std::string logName = getProperty("LogValue");
+  std::vector<double> logValues;
+  logValues.reserve(indices.size());
+  for (int j = start; j < end; ++j) {
+    logValues.push_back(getLogValue(*data.ws, j, logName));
+  }
+
+  const double startX = getProperty("StartX");
+  const double endX = getProperty("EndX");
+  const int maxIterations = getProperty("MaxIterations");
+  const int peakRadius = getProperty("PeakRadius");
+  BatchFitter fitter(ifun);
+  fitter.setMinimizer(getPropertyValue("Minimizer"));
+  fitter.setCostFunction(getPropertyValue("CostFunction"));
+  fitter.setMaxIterations(static_cast<size_t>(maxIterations));
+  fitter.setFittingRange(startX, endX);
+  fitter.setPeakRadius(peakRadius);
+  fitter.setChained(!individual);
+  fitter.setRethrowErrors(true);
+  fitter.setProgress(&prog);
+
+  g_log.debug() << "Fitting " << data.ws->getName() << " indices " << start
+                << " to " << end - 1 << " with \n" << ifun->asString() << '\n';
+  ITableWorkspace_sptr fits;
+  try {
+    fits = fitter.fit(data.ws, indices);
+  } catch (...) {
+    g_log.error("Error in Fit ChildAlgorithm");
+    throw;
+  }
+
+  // The fits have a workspace index column in front and a status at the end
+  const size_t nParams = ifun->nParams();
+  const size_t firstRow = result.rowCount();
+  result.setRowCount(firstRow + indices.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const size_t row = firstRow + i;
+    if (logName == "SourceName") {
+      result.cell<std::string>(row, 0) = name;
+    } else {
+      result.cell<double>(row, 0) = logValues[i];
+    }
+    for (size_t col = 1; col <= 2 * nParams + 1; ++col) {
+      result.cell<double>(row, col) = fits->cell<double>(i, col);
+    }
+    g_log.debug() << "Fit result "
+                  << fits->cell<std::string>(i, 2 * nParams + 2) << ' '
+                  << fits->cell<double>(i, 2 * nParams + 1) << '\n';
+  }
+
+  if (!individual && !indices.empty()) {
+    const size_t last = indices.size() - 1;
+    for (size_t iPar = 0; iPar < nParams; ++iPar) {
+      ifun->setParameter(iPar, fits->cell<double>(last, 2 * iPar + 1));
+      ifun->setError(iPar, fits->cell<double>(last, 2 * iPar + 2));
+    }
+  }
+}
+
+/** Find the value to plot the parameters of a spectrum against.
+ * @param ws :: The workspace with the spectrum
+ * @param wsIndex :: The workspace index of the spectrum
+ * @param logName :: The name of the log, empty to use the vertical axis or
+ * "SourceName" if there is no value
+ * @return The last value of the log or the value of the vertical axis
+ */
+double PlotPeakByLogValue::getLogValue(const API::MatrixWorkspace &ws,
+                                       const int wsIndex,
+                                       const std::string &logName) const {
+  double logValue = 0;
+  if (logName.empty()) {
+    const API::Axis *axis = ws.getAxis(1);
+    if (dynamic_cast<const BinEdgeAxis *>(axis)) {
+      double lowerEdge((*axis)(wsIndex));
+      double upperEdge((*axis)(wsIndex + 1));
+      logValue = lowerEdge + (upperEdge - lowerEdge) / 2;
+    } else
+      logValue = (*axis)(wsIndex);
+  } else if (logName != "SourceName") {
+    Kernel::Property *prop = ws.run().getLogData(logName);
+    if (!prop) {
+      throw std::invalid_argument("Log value " + logName + " does not exist");
+    }
+    TimeSeriesProperty<double> *logp =
+        dynamic_cast<TimeSeriesProperty<double> *>(prop);
+    if (!logp) {
+      throw std::runtime_error("Failed to cast " + logName +
+                               " to TimeSeriesProperty");
+    }
+    logValue = logp->lastValue();
+  }
+  return logValue;
+}
+
 /** Get a workspace identified by an InputData structure.
   * @param data :: InputData with name and either spec or i fields defined.
   * @return InputData structure with the ws field set if everything was OK.
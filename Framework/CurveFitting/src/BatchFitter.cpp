@@ -0,0 +1,333 @@
+#include "MantidCurveFitting/BatchFitter.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/CostFunctionFactory.h"
+#include "MantidAPI/FuncMinimizerFactory.h"
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/IFuncMinimizer.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidCurveFitting/CostFunctions/CostFuncFitting.h"
+#include "MantidCurveFitting/GSLMatrix.h"
+#include "MantidCurveFitting/IMWDomainCreator.h"
+#include "MantidCurveFitting/ParameterEstimator.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ProgressBase.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <tuple>
+
+namespace Mantid {
+namespace CurveFitting {
+
+using namespace API;
+
+/// Everything a thread needs to run fits, reused between its fits
+struct BatchFitter::ThreadState {
+  IFunction_sptr function;
+  boost::shared_ptr<CostFunctions::CostFuncFitting> costFunction;
+  IFuncMinimizer_sptr minimizer;
+  /// The x values of the spectrum being fitted
+  std::vector<double> x;
+  boost::shared_ptr<FunctionValues> values;
+};
+
+/// The outcome of one fit
+struct BatchFitter::Result {
+  std::vector<double> parameters;
+  std::vector<double> errors;
+  double chiSquared = 0.0;
+  std::string status;
+  /// The exception thrown by a failed fit
+  std::exception_ptr error;
+};
+
+namespace {
+/// Create a cost function which can be used for fitting
+boost::shared_ptr<CostFunctions::CostFuncFitting>
+createCostFunction(const std::string &name) {
+  auto costFunction =
+      boost::dynamic_pointer_cast<CostFunctions::CostFuncFitting>(
+          CostFunctionFactory::Instance().create(name));
+  if (!costFunction)
+    throw std::invalid_argument("BatchFitter: " + name +
+                                " is not a fitting cost function.");
+  return costFunction;
+}
+}
+
+/** Constructor
+ * @param function :: The function to fit. Its parameter values are the
+ * starting point of every fit.
+ */
+BatchFitter::BatchFitter(IFunction_const_sptr function)
+    : m_function(std::move(function)) {
+  if (!m_function)
+    throw std::invalid_argument("BatchFitter: the function must not be null.");
+}
+
+/** Set the minimizer used by the fits.
+ * @param minimizer :: The name of the minimizer optionally followed by its
+ * options, for example "Levenberg-Marquardt,AbsError=0.01"
+ * @throws std::exception if the minimizer cannot be created
+ */
+void BatchFitter::setMinimizer(const std::string &minimizer) {
+  FuncMinimizerFactory::Instance().createMinimizer(minimizer);
+  m_minimizer = minimizer;
+}
+
+/** Set the cost function minimized by the fits.
+ * @param costFunction :: The name of a cost function
+ * @throws std::invalid_argument if it is not a fitting cost function
+ */
+void BatchFitter::setCostFunction(const std::string &costFunction) {
+  createCostFunction(costFunction);
+  m_costFunction = costFunction;
+}
+
+/** Fit the function to each of the given spectra.
+ * @param workspace :: The workspace with the data
+ * @param workspaceIndices :: The spectra to fit
+ * @return A table with one row per spectrum holding the workspace index, the
+ * fitted parameters and their errors, the chi squared divided by the degrees
+ * of freedom and the status of the fit.
+ */
+ITableWorkspace_sptr
+BatchFitter::fit(MatrixWorkspace_const_sptr workspace,
+                 const std::vector<size_t> &workspaceIndices) const {
+  const auto nHistograms = workspace->getNumberHistograms();
+  for (const auto index : workspaceIndices) {
+    if (index >= nHistograms)
+      throw std::out_of_range("BatchFitter: workspace index out of range.");
+  }
+
+  std::vector<double> startParameters(m_function->nParams());
+  for (size_t i = 0; i < startParameters.size(); ++i)
+    startParameters[i] = m_function->getParameter(i);
+
+  std::vector<Result> results(workspaceIndices.size());
+  if (m_chained) {
+    auto state = createThreadState();
+    for (size_t i = 0; i < workspaceIndices.size(); ++i) {
+      auto &result = results[i];
+      try {
+        fitSpectrum(workspace, workspaceIndices[i], startParameters, *state,
+                    result);
+        startParameters = result.parameters;
+      } catch (std::exception &e) {
+        if (m_rethrowErrors)
+          throw;
+        result.status = e.what();
+      }
+      if (m_progress) {
+        m_progress->report();
+        if (m_progress->hasCancellationBeenRequested())
+          throw API::Algorithm::CancelException();
+      }
+    }
+  } else {
+    std::vector<std::unique_ptr<ThreadState>> states(PARALLEL_GET_MAX_THREADS);
+    const auto nFits = static_cast<int64_t>(workspaceIndices.size());
+    std::atomic<bool> cancelled{false};
+    PARALLEL_FOR_IF(Kernel::threadSafe(*workspace))
+    for (int64_t i = 0; i < nFits; ++i) {
+      if (cancelled)
+        continue;
+      auto &state = states[PARALLEL_THREAD_NUMBER];
+      auto &result = results[i];
+      try {
+        if (!state) {
+          PARALLEL_CRITICAL(BatchFitter_createThreadState) {
+            state = createThreadState();
+          }
+        }
+        fitSpectrum(workspace, workspaceIndices[i], startParameters, *state,
+                    result);
+      } catch (std::exception &e) {
+        result.status = e.what();
+        result.error = std::current_exception();
+      }
+      // Cancellation cannot be thrown out of the parallel region
+      if (m_progress) {
+        m_progress->report();
+        if (m_progress->hasCancellationBeenRequested())
+          cancelled = true;
+      }
+    }
+    if (cancelled)
+      throw API::Algorithm::CancelException();
+    if (m_rethrowErrors) {
+      for (const auto &result : results) {
+        if (result.error)
+          std::rethrow_exception(result.error);
+      }
+    }
+  }
+
+  auto table = WorkspaceFactory::Instance().createTable("TableWorkspace");
+  table->addColumn("int", "WorkspaceIndex");
+  const auto nParams = m_function->nParams();
+  for (size_t i = 0; i < nParams; ++i) {
+    table->addColumn("double", m_function->parameterName(i));
+    table->addColumn("double", m_function->parameterName(i) + "_Err");
+  }
+  table->addColumn("double", "Chi_squared");
+  table->addColumn("str", "Status");
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto &result = results[i];
+    TableRow row = table->appendRow();
+    row << static_cast<int>(workspaceIndices[i]);
+    for (size_t j = 0; j < nParams; ++j) {
+      if (result.parameters.empty())
+        row << std::nan("") << std::nan("");
+      else
+        row << result.parameters[j] << result.errors[j];
+    }
+    row << result.chiSquared << result.status;
+  }
+  return table;
+}
+
+/// Create the objects a thread needs to run fits
+std::unique_ptr<BatchFitter::ThreadState>
+BatchFitter::createThreadState() const {
+  auto state = Kernel::make_unique<ThreadState>();
+  state->function = m_function->clone();
+  state->costFunction = createCostFunction(m_costFunction);
+  state->minimizer =
+      FuncMinimizerFactory::Instance().createMinimizer(m_minimizer);
+  state->values = boost::make_shared<FunctionValues>();
+  return state;
+}
+
+/// Run one fit, with the same steps and status messages as Fit
+void BatchFitter::fitSpectrum(const MatrixWorkspace_const_sptr &workspace,
+                              const size_t workspaceIndex,
+                              const std::vector<double> &startParameters,
+                              ThreadState &state, Result &result) const {
+  auto &function = *state.function;
+  for (size_t i = 0; i < function.nParams(); ++i) {
+    function.setParameter(i, startParameters[i]);
+    function.setError(i, 0.0);
+  }
+  function.setUpForFit();
+  function.setWorkspace(workspace);
+  function.setMatrixWorkspace(workspace, workspaceIndex, m_startX, m_endX);
+
+  setFittingData(*workspace, workspaceIndex, state);
+  auto domain =
+      boost::make_shared<FunctionDomain1DView>(state.x.data(), state.x.size());
+  if (m_peakRadius != 0)
+    domain->setPeakRadius(m_peakRadius);
+  ParameterEstimator::estimate(function, *domain, *state.values);
+
+  state.costFunction->setFittingFunction(state.function, domain, state.values);
+  state.minimizer->initialize(state.costFunction, m_maxIterations);
+  size_t iteration = 0;
+  bool isFinished = false;
+  while (iteration < m_maxIterations && !isFinished) {
+    function.iterationStarting();
+    isFinished = !state.minimizer->iterate(iteration);
+    function.iterationFinished();
+    ++iteration;
+  }
+  // Minimizers such as FABADA compute their results here
+  state.minimizer->finalize();
+
+  result.status = state.minimizer->getError();
+  if (iteration >= m_maxIterations && !isFinished) {
+    if (!result.status.empty())
+      result.status += '\n';
+    result.status += "Failed to converge after " +
+                     std::to_string(m_maxIterations) + " iterations.";
+  }
+  if (result.status.empty())
+    result.status = "success";
+
+  const double costFunctionValue = state.minimizer->costFunctionVal();
+  const auto nActive = state.costFunction->nParams();
+  size_t dof = domain->size() > nActive ? domain->size() - nActive : 0;
+  if (dof == 0)
+    dof = 1;
+  result.chiSquared = costFunctionValue / static_cast<double>(dof);
+  if (nActive > 0) {
+    GSLMatrix covar;
+    state.costFunction->calCovarianceMatrix(covar);
+    state.costFunction->calFittingErrors(covar, costFunctionValue);
+  }
+
+  result.parameters.resize(function.nParams());
+  result.errors.resize(function.nParams());
+  for (size_t i = 0; i < function.nParams(); ++i) {
+    result.parameters[i] = function.getParameter(i);
+    result.errors[i] = function.getError(i);
+  }
+}
+
+/** Fill the thread's x buffer and fitting data with a spectrum in the fitting
+ * range. The range and the weights are set the same way as Fit does it.
+ */
+void BatchFitter::setFittingData(const MatrixWorkspace &workspace,
+                                 const size_t workspaceIndex,
+                                 ThreadState &state) const {
+  const auto &X = workspace.x(workspaceIndex);
+  const auto &Y = workspace.y(workspaceIndex);
+  const auto &E = workspace.e(workspaceIndex);
+  const bool isHistogram = workspace.isHistogramData();
+
+  // Select the same data as Fit
+  double startX = m_startX;
+  double endX = m_endX;
+  size_t start, end;
+  std::tie(start, end) =
+      IMWDomainCreator::getXInterval(X.rawData(), isHistogram, startX, endX);
+  if (end <= start)
+    throw std::invalid_argument("StartX and EndX values do not capture a range "
+                                "within the workspace interval.");
+  const size_t n = end - start;
+  state.x.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    const size_t k = start + i;
+    state.x[i] = isHistogram ? (X[k] + X[k + 1]) / 2 : X[k];
+  }
+
+  FunctionDomain1DView domain(state.x.data(), n);
+  auto &values = *state.values;
+  values.reset(domain);
+  for (size_t i = 0; i < n; ++i) {
+    double y = Y[start + i];
+    const double error = E[start + i];
+    double weight = 0.0;
+    if (!std::isfinite(y)) {
+      if (!m_ignoreInvalidData)
+        throw std::runtime_error("Infinte number or NaN found in input data.");
+      y = 0.0;
+    } else if (!std::isfinite(error)) {
+      if (!m_ignoreInvalidData)
+        throw std::runtime_error("Infinte number or NaN found in input data.");
+    } else if (error <= 0) {
+      if (!m_ignoreInvalidData)
+        weight = 1.0;
+    } else {
+      weight = 1.0 / error;
+      if (!std::isfinite(weight)) {
+        if (!m_ignoreInvalidData)
+          throw std::runtime_error(
+              "Error of a data point is probably too small.");
+        weight = 0.0;
+      }
+    }
+    values.setFitData(i, y);
+    values.setFitWeight(i, weight);
+  }
+}
+
+} // namespace CurveFitting
+} // namespace Mantid
@@ -4,12 +4,14 @@
 #include "MantidAPI/CompositeDomain.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/IConstraint.h"
+#include "MantidAPI/MultiDomainFunction.h"
 #include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
 #include "MantidCurveFitting/Jacobian.h"
 #include "MantidCurveFitting/SeqDomain.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/MultiThreaded.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace Mantid {
@@ -227,6 +229,16 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
                                               bool evalDeriv,
                                               bool evalHessian) const {
   UNUSED_ARG(evalDeriv);
+  auto multiDomain =
+      boost::dynamic_pointer_cast<API::MultiDomainFunction>(function);
+  auto compositeDomain =
+      boost::dynamic_pointer_cast<API::CompositeDomain>(domain);
+  if (multiDomain && compositeDomain &&
+      !multiDomain->getAttribute("NumDeriv").asBool()) {
+    addMultiDomainValDerivHessian(*multiDomain, *compositeDomain, values,
+                                  evalHessian);
+    return;
+  }
   function->function(*domain, *values);
   size_t np = function->nParams(); // number of parameters
   size_t ny = values->size();      // number of data points
@@ -293,6 +305,114 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
   }
 }
 
+/**
+ * Update the cost function, derivatives and hessian by adding values calculated
+ * by a MultiDomainFunction. The Jacobian is calculated one domain at a time
+ * and only for the parameters of the member functions applied to the domain,
+ * so the memory it needs doesn't grow with the number of domains.
+ * @param function :: The multi-domain fitting function
+ * @param domain :: The composite domain.
+ * @param values :: The fit function values
+ * @param evalHessian :: Flag to evaluate the Hessian
+ */
+void CostFuncLeastSquares::addMultiDomainValDerivHessian(
+    API::MultiDomainFunction &function, const API::CompositeDomain &domain,
+    API::FunctionValues_sptr values, bool evalHessian) const {
+  function.function(domain, *values);
+  const std::vector<double> weights = getFitWeights(values);
+  const size_t nDomains = domain.getNParts();
+
+  // The member functions applied to each domain
+  std::vector<std::vector<size_t>> domainFunctions(nDomains);
+  std::vector<size_t> domainIndices;
+  for (size_t iFun = 0; iFun < function.nFunctions(); ++iFun) {
+    function.getDomainIndices(iFun, nDomains, domainIndices);
+    for (auto iDomain : domainIndices) {
+      domainFunctions[iDomain].push_back(iFun);
+    }
+  }
+  // The active index of each declared parameter and the index of the first
+  // parameter of each member function
+  const size_t np = function.nParams();
+  std::vector<size_t> activeIndex(np, np);
+  std::vector<size_t> paramOffsets(function.nFunctions(), np);
+  for (size_t ip = 0, ia = 0; ip < np; ++ip) {
+    if (function.isActive(ip))
+      activeIndex[ip] = ia++;
+    auto &paramOffset = paramOffsets[function.functionIndex(ip)];
+    paramOffset = std::min(paramOffset, ip);
+  }
+
+  double fVal = 0.0;
+  size_t offset = 0;
+  std::vector<size_t> columns;
+  std::vector<std::vector<double>> derivatives;
+  for (size_t iDomain = 0; iDomain < nDomains; ++iDomain) {
+    const API::FunctionDomain &d = domain.getDomain(iDomain);
+    const size_t ny = d.size();
+    std::vector<double> residuals(ny);
+    for (size_t i = 0; i < ny; ++i) {
+      const double calc = values->getCalculated(offset + i);
+      const double obs = values->getFitData(offset + i);
+      residuals[i] = (calc - obs) * weights[offset + i];
+      fVal += residuals[i] * residuals[i];
+    }
+
+    // The weighted columns of the Jacobian of the active parameters
+    columns.clear();
+    derivatives.clear();
+    for (auto iFun : domainFunctions[iDomain]) {
+      auto member = function.getFunction(iFun);
+      const size_t nMemberParams = member->nParams();
+      Jacobian jacobian(ny, nMemberParams);
+      member->functionDeriv(d, jacobian);
+      for (size_t k = 0; k < nMemberParams; ++k) {
+        const size_t ia = activeIndex[paramOffsets[iFun] + k];
+        if (ia == np)
+          continue;
+        columns.push_back(ia);
+        derivatives.emplace_back(ny);
+        auto &column = derivatives.back();
+        for (size_t i = 0; i < ny; ++i) {
+          column[i] = jacobian.get(i, k) * weights[offset + i];
+        }
+      }
+    }
+    offset += ny;
+
+    for (size_t c1 = 0; c1 < columns.size(); ++c1) {
+      const auto &column1 = derivatives[c1];
+      double d1 = 0.0;
+      for (size_t i = 0; i < ny; ++i) {
+        d1 += residuals[i] * column1[i];
+      }
+      PARALLEL_CRITICAL(der_set) {
+        m_der.set(columns[c1], m_der.get(columns[c1]) + d1);
+      }
+      if (!evalHessian)
+        continue;
+      for (size_t c2 = 0; c2 <= c1; ++c2) {
+        const auto &column2 = derivatives[c2];
+        double h = 0.0;
+        for (size_t i = 0; i < ny; ++i) {
+          h += column1[i] * column2[i];
+        }
+        const auto i1 = columns[c1];
+        const auto i2 = columns[c2];
+        PARALLEL_CRITICAL(hessian_set) {
+          m_hessian.set(i1, i2, m_hessian.get(i1, i2) + h);
+          if (i1 != i2) {
+            m_hessian.set(i2, i1, m_hessian.get(i2, i1) + h);
+          }
+        }
+      }
+    }
+  }
+
+  PARALLEL_ATOMIC
+  m_value += 0.5 * fVal;
+}
+
 std::vector<double>
 CostFuncLeastSquares::getFitWeights(API::FunctionValues_sptr values) const {
   std::vector<double> weights(values->size());
@@ -50,6 +50,12 @@ void LevenbergMarquardtMDMinimizer::initialize(API::ICostFunction_sptr function,
   m_mu = 0;
   m_nu = 2.0;
   m_rho = 1.0;
+  m_F = 0.0;
+  m_D.clear();
+  m_errorString.clear();
+  auto fittingFunction = m_leastSquares->getFittingFunction();
+  m_blocks = fittingFunction ? ParameterBlocks(*fittingFunction)
+                             : ParameterBlocks();
 }
 
 /// Do one iteration.
@@ -150,7 +156,12 @@ bool LevenbergMarquardtMDMinimizer::iterate(size_t) {
   // To find dx solve the system of linear equations   H * dx == -m_der
   dd *= -1.0;
   try {
-    H.solve(dd, dx);
+    // Eliminate the local parameters of multi-domain fits block by block
+    if (m_blocks.isBlockStructured(H)) {
+      m_blocks.solve(H, dd, dx);
+    } else {
+      H.solve(dd, dx);
+    }
   } catch (std::runtime_error &error) {
     m_errorString = error.what();
     return false;
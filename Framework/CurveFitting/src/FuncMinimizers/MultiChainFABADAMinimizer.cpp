@@ -0,0 +1,608 @@
+#include "MantidCurveFitting/FuncMinimizers/MultiChainFABADAMinimizer.h"
+#include "MantidAPI/FuncMinimizerFactory.h"
+#include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/TableRow.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidCurveFitting/Constraints/BoundaryConstraint.h"
+#include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
+#include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace FuncMinimisers {
+
+namespace {
+// static logger object
+Kernel::Logger g_log("MultiChainFABADAMinimizer");
+// number of sweeps when convergence isn't expected
+const size_t LOWER_CONVERGENCE_LIMIT = 350;
+// sweeps between the jump updates and the convergence checks
+const size_t JUMP_CHECKING_RATE = 100;
+// low jump limit
+const double LOW_JUMP_LIMIT = 1e-25;
+
+/// The value at a fraction of a sorted sample
+double quantile(const std::vector<double> &sorted, double fraction) {
+  const double position = fraction * static_cast<double>(sorted.size() - 1);
+  const auto below = static_cast<size_t>(position);
+  if (below + 1 >= sorted.size())
+    return sorted.back();
+  const double weight = position - static_cast<double>(below);
+  return (1.0 - weight) * sorted[below] + weight * sorted[below + 1];
+}
+} // namespace
+
+DECLARE_FUNCMINIMIZER(MultiChainFABADAMinimizer, MultiChainFABADA)
+
+/// A Markov chain with its own copy of the fitting function
+struct MultiChainFABADAMinimizer::Chain {
+  API::IFunction_sptr function;
+  boost::shared_ptr<CostFunctions::CostFuncLeastSquares> costFunction;
+  /// Current position
+  GSLVector parameters;
+  /// Cost function at the current position
+  double chi2 = 0.0;
+  double temperature = 1.0;
+  /// The width of the proposals of each parameter
+  std::vector<double> jump;
+  /// Accepted proposals of each parameter since the last jump update
+  std::vector<size_t> accepted;
+  std::mt19937 generator;
+  /// The error that stopped a sweep, if any
+  std::string error;
+};
+
+/// Constructor
+MultiChainFABADAMinimizer::MultiChainFABADAMinimizer()
+    : m_nParams(0), m_nReplicas(0), m_nTemperatures(0), m_counter(0),
+      m_converged(false), m_samplingSweeps(0), m_stepsBetweenValues(0),
+      m_maxIter(0), m_chi2(0.0) {
+  auto mustBePositive = boost::make_shared<Kernel::BoundedValidator<int>>();
+  mustBePositive->setLower(1);
+  declareProperty("NumberOfChains", 4, mustBePositive,
+                  "Number of independent chains sampling the posterior.");
+  declareProperty("NumberOfTemperatures", 4, mustBePositive,
+                  "Number of tempered chains run with each independent chain,"
+                  " including the one at temperature 1.");
+  declareProperty("MaximumTemperature", 10.0,
+                  "Temperature of the hottest tempered chain.");
+  declareProperty("ChainLength", static_cast<size_t>(10000),
+                  "Total number of sweeps done by the chains at temperature 1"
+                  " after the burn-in.");
+  declareProperty("StepsBetweenValues", 10, mustBePositive,
+                  "Sweeps done between chain points to avoid correlation"
+                  " between them.");
+  declareProperty("ConvergenceCriteria", 1.1,
+                  "The burn-in ends when the Gelman-Rubin statistic (R-hat)"
+                  " of every parameter is below this value.");
+  declareProperty("JumpAcceptanceRate", 0.6666666,
+                  "Desired jumping acceptance rate");
+  declareProperty("Seed", 1, "Seed of the random number generators.");
+  // Output Properties
+  declareProperty(Kernel::make_unique<API::WorkspaceProperty<>>(
+                      "Chains", "", Kernel::Direction::Output,
+                      API::PropertyMode::Optional),
+                  "The name to give the output workspace for the sampled"
+                  " chains at temperature 1, one after the other.");
+  declareProperty(
+      Kernel::make_unique<API::WorkspaceProperty<API::ITableWorkspace>>(
+          "Parameters", "", Kernel::Direction::Output,
+          API::PropertyMode::Optional),
+      "The name to give the output workspace (Parameter values, errors and"
+      " R-hat)");
+}
+
+MultiChainFABADAMinimizer::~MultiChainFABADAMinimizer() = default;
+
+/** Initialize minimizer. Set initial values for all private members
+*
+* @param function :: the fit function
+* @param maxIterations :: maximum number of iterations
+*/
+void MultiChainFABADAMinimizer::initialize(API::ICostFunction_sptr function,
+                                           size_t maxIterations) {
+  m_leastSquares =
+      boost::dynamic_pointer_cast<CostFunctions::CostFuncLeastSquares>(
+          function);
+  if (!m_leastSquares) {
+    throw std::invalid_argument("MultiChainFABADA works only with least "
+                                "squares. Different function was given.");
+  }
+  m_nParams = m_leastSquares->nParams();
+  if (m_nParams == 0) {
+    throw std::invalid_argument("Function has 0 fitting parameters.");
+  }
+
+  const int nReplicas = getProperty("NumberOfChains");
+  const int nTemperatures = getProperty("NumberOfTemperatures");
+  const int nSteps = getProperty("StepsBetweenValues");
+  m_nReplicas = static_cast<size_t>(nReplicas);
+  m_nTemperatures = static_cast<size_t>(nTemperatures);
+  m_stepsBetweenValues = static_cast<size_t>(nSteps);
+  const size_t chainLength = getProperty("ChainLength");
+  m_samplingSweeps = (chainLength + m_nReplicas - 1) / m_nReplicas;
+  m_maxIter = maxIterations;
+  m_counter = 0;
+  m_converged = false;
+  const int seed = getProperty("Seed");
+  m_generator.seed(static_cast<std::mt19937::result_type>(seed));
+
+  if (LOWER_CONVERGENCE_LIMIT + m_samplingSweeps >= maxIterations) {
+    throw std::length_error("Too few iterations to perform the posterior "
+                            "chains plus 350 iterations for the burn-in "
+                            "period. Increase MaxIterations property");
+  }
+
+  initBounds();
+  initChains();
+  m_burnIn.assign(m_nReplicas, std::vector<std::vector<double>>(m_nParams));
+  m_samples.assign(m_nReplicas,
+                   std::vector<std::vector<double>>(m_nParams + 1));
+}
+
+/** Do one iteration: a sweep of every chain followed by the temperature
+* swaps.
+*
+* @param iter :: The number of the iteration
+* @return :: true if iterations must be continued, false otherwise
+*/
+bool MultiChainFABADAMinimizer::iterate(size_t iter) {
+  if (!m_leastSquares) {
+    throw std::runtime_error("Cost function isn't set up.");
+  }
+
+  const auto nChains = static_cast<int64_t>(m_chains.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nChains; ++i) {
+    auto &chain = *m_chains[i];
+    try {
+      sweep(chain);
+    } catch (std::exception &e) {
+      chain.error = e.what();
+    }
+  }
+  for (const auto &chain : m_chains) {
+    if (!chain->error.empty())
+      throw std::runtime_error(chain->error);
+  }
+  temperatureSwaps();
+  ++m_counter;
+  m_chi2 = coldChain(0).chi2;
+
+  if (!m_converged) {
+    for (size_t r = 0; r < m_nReplicas; ++r) {
+      const auto &parameters = coldChain(r).parameters;
+      for (size_t j = 0; j < m_nParams; ++j) {
+        m_burnIn[r][j].push_back(parameters.get(j));
+      }
+    }
+    if (m_counter % JUMP_CHECKING_RATE == 0) {
+      jumpUpdate();
+      if (m_counter >= LOWER_CONVERGENCE_LIMIT && burnInConverged()) {
+        g_log.information() << "Burn-in converged after " << m_counter
+                            << " iterations.\n";
+        m_converged = true;
+        m_counter = 0;
+        m_burnIn.clear();
+        return true;
+      }
+    }
+    if (iter + m_samplingSweeps >= m_maxIter) {
+      throw std::runtime_error("The chains did not converge during the "
+                               "burn-in. Increase MaxIterations property");
+    }
+    return true;
+  }
+
+  if (m_counter % m_stepsBetweenValues == 0) {
+    for (size_t r = 0; r < m_nReplicas; ++r) {
+      const auto &chain = coldChain(r);
+      for (size_t j = 0; j < m_nParams; ++j) {
+        m_samples[r][j].push_back(chain.parameters.get(j));
+      }
+      m_samples[r][m_nParams].push_back(chain.chi2);
+    }
+  }
+  return m_counter < m_samplingSweeps;
+}
+
+double MultiChainFABADAMinimizer::costFunctionVal() { return m_chi2; }
+
+/** When all the iterations have been done, set the parameters to the medians
+* of the posterior and output the results.
+*/
+void MultiChainFABADAMinimizer::finalize() {
+  const auto nSamples = m_samples.empty() ? 0 : m_samples[0][0].size();
+  if (nSamples == 0) {
+    g_log.warning() << "No samples were taken, the parameters are left at"
+                       " the end of the burn-in.\n";
+    return;
+  }
+
+  std::vector<double> values(m_nParams);
+  std::vector<double> errorsLeft(m_nParams);
+  std::vector<double> errorsRight(m_nParams);
+  std::vector<double> rHat(m_nParams);
+  std::vector<double> all;
+  for (size_t j = 0; j < m_nParams; ++j) {
+    all.clear();
+    std::vector<std::vector<double>> sequences;
+    for (size_t r = 0; r < m_nReplicas; ++r) {
+      const auto &samples = m_samples[r][j];
+      all.insert(all.end(), samples.begin(), samples.end());
+      const auto half = samples.size() / 2;
+      sequences.emplace_back(samples.begin(), samples.begin() + half);
+      sequences.emplace_back(samples.end() - half, samples.end());
+    }
+    std::sort(all.begin(), all.end());
+    // The median and the limits of the central 68% of the posterior
+    values[j] = quantile(all, 0.5);
+    errorsLeft[j] = values[j] - quantile(all, 0.1587);
+    errorsRight[j] = quantile(all, 0.8413) - values[j];
+    rHat[j] = gelmanRubin(sequences);
+  }
+
+  GSLVector best(m_nParams);
+  for (size_t j = 0; j < m_nParams; ++j) {
+    best.set(j, values[j]);
+  }
+  m_leastSquares->setParameters(best);
+  m_chi2 = m_leastSquares->val();
+
+  if (!getPropertyValue("Parameters").empty()) {
+    outputParameterTable(values, errorsLeft, errorsRight, rHat);
+  }
+  if (!getPropertyValue("Chains").empty()) {
+    outputChains();
+  }
+}
+
+/** Calculate the split Gelman-Rubin statistic of sequences sampling one
+* parameter. Values close to 1 show that the sequences sample the same
+* distribution.
+*
+* @param sequences :: Sequences of equal length, at least 2 of them
+* @return :: R-hat, or NaN if there are too few values
+*/
+double MultiChainFABADAMinimizer::gelmanRubin(
+    const std::vector<std::vector<double>> &sequences) {
+  const auto m = sequences.size();
+  const auto n = m == 0 ? 0 : sequences.front().size();
+  if (m < 2 || n < 2) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  std::vector<double> means(m);
+  double within = 0.0;
+  for (size_t k = 0; k < m; ++k) {
+    const auto &sequence = sequences[k];
+    const double mean =
+        std::accumulate(sequence.begin(), sequence.end(), 0.0) / double(n);
+    double variance = 0.0;
+    for (auto value : sequence) {
+      variance += (value - mean) * (value - mean);
+    }
+    means[k] = mean;
+    within += variance / double(n - 1);
+  }
+  within /= double(m);
+  const double grandMean =
+      std::accumulate(means.begin(), means.end(), 0.0) / double(m);
+  double between = 0.0;
+  for (auto mean : means) {
+    between += (mean - grandMean) * (mean - grandMean);
+  }
+  between *= double(n) / double(m - 1);
+  if (within == 0.0) {
+    // A parameter that never moved
+    return between == 0.0 ? 1.0 : std::numeric_limits<double>::infinity();
+  }
+  const double variance = (double(n - 1) * within + between) / double(n);
+  return std::sqrt(variance / within);
+}
+
+/** Find the bounds of the active parameters that are declared parameters
+* with a boundary constraint.
+*/
+void MultiChainFABADAMinimizer::initBounds() {
+  const double inf = std::numeric_limits<double>::infinity();
+  m_bounds.assign(m_nParams, std::make_pair(-inf, inf));
+  auto function = m_leastSquares->getFittingFunction();
+  for (size_t i = 0, j = 0; i < function->nParams(); ++i) {
+    if (!function->isActive(i))
+      continue;
+    auto bcon = dynamic_cast<Constraints::BoundaryConstraint *>(
+        function->getConstraint(i));
+    // Bounds only apply if the active parameter is the declared one
+    if (bcon && function->activeParameter(i) == function->getParameter(i)) {
+      if (bcon->hasLower())
+        m_bounds[j].first = bcon->lower();
+      if (bcon->hasUpper())
+        m_bounds[j].second = bcon->upper();
+    }
+    ++j;
+  }
+}
+
+/** Create the chains. The chains at temperature 1 of the first replica uses
+* the cost function of the fit, all the others get a copy of the fitting
+* function. The replicas start at random positions around the initial
+* parameters.
+*/
+void MultiChainFABADAMinimizer::initChains() {
+  auto function = m_leastSquares->getFittingFunction();
+  auto domain = m_leastSquares->getDomain();
+  auto values = m_leastSquares->getValues();
+  GSLVector start;
+  m_leastSquares->getParameters(start);
+  for (size_t j = 0; j < m_nParams; ++j) {
+    start.set(j, reflect(j, start.get(j)));
+  }
+  std::vector<double> jump(m_nParams);
+  for (size_t j = 0; j < m_nParams; ++j) {
+    const double param = start.get(j);
+    jump[j] = param != 0.0 ? std::abs(param / 10) : 0.01;
+  }
+
+  const double maxTemperature = getProperty("MaximumTemperature");
+  const int seed = getProperty("Seed");
+  m_chains.clear();
+  for (size_t r = 0; r < m_nReplicas; ++r) {
+    for (size_t t = 0; t < m_nTemperatures; ++t) {
+      auto chain = Kernel::make_unique<Chain>();
+      if (m_chains.empty()) {
+        chain->function = function;
+        chain->costFunction = m_leastSquares;
+      } else {
+        chain->function = function->clone();
+        chain->function->setUpForFit();
+        chain->costFunction =
+            boost::make_shared<CostFunctions::CostFuncLeastSquares>();
+        chain->costFunction->setFittingFunction(
+            chain->function, domain,
+            boost::make_shared<API::FunctionValues>(*values));
+        if (chain->costFunction->nParams() != m_nParams) {
+          throw std::runtime_error("A copy of the fitting function has a "
+                                   "different number of parameters.");
+        }
+      }
+      chain->temperature =
+          m_nTemperatures == 1
+              ? 1.0
+              : std::pow(maxTemperature,
+                         double(t) / double(m_nTemperatures - 1));
+      chain->jump = jump;
+      chain->accepted.assign(m_nParams, 0);
+      std::seed_seq seq{seed, static_cast<int>(m_chains.size())};
+      chain->generator.seed(seq);
+      chain->parameters = start;
+      if (r > 0) {
+        for (size_t j = 0; j < m_nParams; ++j) {
+          std::normal_distribution<double> step(0.0, jump[j]);
+          chain->parameters.set(
+              j, reflect(j, start.get(j) + step(chain->generator)));
+        }
+      }
+      m_chains.push_back(std::move(chain));
+    }
+  }
+
+  const auto nChains = static_cast<int64_t>(m_chains.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nChains; ++i) {
+    auto &chain = *m_chains[i];
+    try {
+      chain.costFunction->setParameters(chain.parameters);
+      chain.chi2 = chain.costFunction->val();
+    } catch (std::exception &e) {
+      chain.error = e.what();
+    }
+  }
+  for (const auto &chain : m_chains) {
+    if (!chain->error.empty())
+      throw std::runtime_error(chain->error);
+  }
+  m_chi2 = coldChain(0).chi2;
+}
+
+/** Do one Metropolis step for each parameter of a chain in turn. Runs in
+* parallel with the sweeps of the other chains, so it must only touch the
+* chain.
+*
+* @param chain :: The chain to move
+*/
+void MultiChainFABADAMinimizer::sweep(Chain &chain) {
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  GSLVector proposal = chain.parameters;
+  for (size_t j = 0; j < m_nParams; ++j) {
+    // A parameter bounded to a single value cannot move
+    if (!(m_bounds[j].first < m_bounds[j].second))
+      continue;
+    std::normal_distribution<double> step(0.0, chain.jump[j]);
+    const double newValue =
+        reflect(j, chain.parameters.get(j) + step(chain.generator));
+    if (std::isnan(newValue)) {
+      throw std::runtime_error("Parameter value is NaN.");
+    }
+    proposal.set(j, newValue);
+    chain.costFunction->setParameters(proposal);
+    const double chi2New = chain.costFunction->val();
+
+    const bool accept =
+        chi2New < chain.chi2 ||
+        uniform(chain.generator) <=
+            std::exp((chain.chi2 - chi2New) / (2.0 * chain.temperature));
+    if (accept) {
+      chain.parameters.set(j, newValue);
+      chain.chi2 = chi2New;
+      ++chain.accepted[j];
+    } else {
+      proposal.set(j, chain.parameters.get(j));
+    }
+  }
+  // Leave the function at the current position
+  chain.costFunction->setParameters(chain.parameters);
+}
+
+/** Keep a value inside the bounds of its parameter by reflecting it on the
+* bounds, which keeps the proposals symmetric.
+*
+* @param parameterIndex :: The index of an active parameter
+* @param value :: A proposed value of the parameter
+* @return :: The value inside the bounds
+*/
+double MultiChainFABADAMinimizer::reflect(size_t parameterIndex,
+                                          double value) const {
+  const double lower = m_bounds[parameterIndex].first;
+  const double upper = m_bounds[parameterIndex].second;
+  if (std::isfinite(lower) && std::isfinite(upper)) {
+    const double width = upper - lower;
+    if (width <= 0.0)
+      return lower;
+    double offset = std::fmod(value - lower, 2.0 * width);
+    if (offset < 0.0)
+      offset += 2.0 * width;
+    return offset <= width ? lower + offset : lower + 2.0 * width - offset;
+  }
+  if (value < lower)
+    return 2.0 * lower - value;
+  if (value > upper)
+    return 2.0 * upper - value;
+  return value;
+}
+
+/** Propose to swap the positions of neighbouring temperatures in each
+* replica. The pairs alternate between iterations so every pair gets its
+* turn.
+*/
+void MultiChainFABADAMinimizer::temperatureSwaps() {
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  for (size_t r = 0; r < m_nReplicas; ++r) {
+    for (size_t t = m_counter % 2; t + 1 < m_nTemperatures; t += 2) {
+      auto &colder = *m_chains[r * m_nTemperatures + t];
+      auto &hotter = *m_chains[r * m_nTemperatures + t + 1];
+      const double logRatio =
+          (colder.chi2 - hotter.chi2) *
+          (1.0 / (2.0 * colder.temperature) - 1.0 / (2.0 * hotter.temperature));
+      if (logRatio >= 0.0 || uniform(m_generator) < std::exp(logRatio)) {
+        std::swap(colder.parameters, hotter.parameters);
+        std::swap(colder.chi2, hotter.chi2);
+        colder.costFunction->setParameters(colder.parameters);
+        hotter.costFunction->setParameters(hotter.parameters);
+      }
+    }
+  }
+}
+
+/** Scale the jumps to bring the acceptance rates since the last update
+* towards JumpAcceptanceRate.
+*/
+void MultiChainFABADAMinimizer::jumpUpdate() {
+  const double jumpAR = getProperty("JumpAcceptanceRate");
+  for (auto &chain : m_chains) {
+    for (size_t j = 0; j < m_nParams; ++j) {
+      auto &jump = chain->jump[j];
+      if (chain->accepted[j] == 0) {
+        jump /= 10.0;
+      } else {
+        const double f =
+            double(chain->accepted[j]) / double(JUMP_CHECKING_RATE);
+        jump *= f / jumpAR;
+      }
+      // The floor is applied last so that a zero-width bound cannot give a
+      // normal distribution with no spread
+      const double width = m_bounds[j].second - m_bounds[j].first;
+      jump = std::max(std::min(jump, width), LOW_JUMP_LIMIT);
+      chain->accepted[j] = 0;
+    }
+  }
+}
+
+/** Check the convergence of the burn-in with the split R-hat of the second
+* half of the cold chains.
+*
+* @return :: True if every parameter has converged
+*/
+bool MultiChainFABADAMinimizer::burnInConverged() const {
+  const double criterion = getProperty("ConvergenceCriteria");
+  // Split the second half of the histories in two
+  const auto quarter = m_burnIn[0][0].size() / 4;
+  for (size_t j = 0; j < m_nParams; ++j) {
+    std::vector<std::vector<double>> sequences;
+    for (size_t r = 0; r < m_nReplicas; ++r) {
+      const auto &history = m_burnIn[r][j];
+      sequences.emplace_back(history.end() - 2 * quarter,
+                             history.end() - quarter);
+      sequences.emplace_back(history.end() - quarter, history.end());
+    }
+    const double rHat = gelmanRubin(sequences);
+    if (!(rHat < criterion))
+      return false;
+  }
+  return true;
+}
+
+/// The chain at temperature 1 of a replica
+MultiChainFABADAMinimizer::Chain &
+MultiChainFABADAMinimizer::coldChain(size_t replica) {
+  return *m_chains[replica * m_nTemperatures];
+}
+
+/** Create the table with the medians of the parameters, the distances to
+* the limits of the central 68% of the posterior and R-hat.
+*/
+void MultiChainFABADAMinimizer::outputParameterTable(
+    const std::vector<double> &values, const std::vector<double> &errorsLeft,
+    const std::vector<double> &errorsRight, const std::vector<double> &rHat) {
+  API::ITableWorkspace_sptr wsPdfE =
+      API::WorkspaceFactory::Instance().createTable("TableWorkspace");
+  wsPdfE->addColumn("str", "Name");
+  wsPdfE->addColumn("double", "Value");
+  wsPdfE->addColumn("double", "Left's error");
+  wsPdfE->addColumn("double", "Right's error");
+  wsPdfE->addColumn("double", "R-hat");
+  for (size_t j = 0; j < m_nParams; ++j) {
+    API::TableRow row = wsPdfE->appendRow();
+    row << m_leastSquares->parameterName(j) << values[j] << errorsLeft[j]
+        << errorsRight[j] << rHat[j];
+  }
+  setProperty("Parameters", wsPdfE);
+}
+
+/** Create the workspace with the sampled chains at temperature 1, one after
+* the other. The last histogram is for the cost function.
+*/
+void MultiChainFABADAMinimizer::outputChains() {
+  const auto perChain = m_samples[0][0].size();
+  const auto length = perChain * m_nReplicas;
+  API::MatrixWorkspace_sptr wsC = API::WorkspaceFactory::Instance().create(
+      "Workspace2D", m_nParams + 1, length, length);
+  for (size_t j = 0; j < m_nParams + 1; ++j) {
+    auto &X = wsC->mutableX(j);
+    auto &Y = wsC->mutableY(j);
+    for (size_t r = 0; r < m_nReplicas; ++r) {
+      std::copy(m_samples[r][j].begin(), m_samples[r][j].end(),
+                Y.begin() + r * perChain);
+    }
+    for (size_t k = 0; k < length; ++k) {
+      X[k] = double(k);
+    }
+  }
+  setProperty("Chains", wsC);
+}
+
+} // namespace FuncMinimisers
+} // namespace CurveFitting
+} // namespace Mantid
@@ -3,11 +3,12 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/BackToBackExponential.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidKernel/Math/ArrayFunctions.h"
 
-#include <gsl/gsl_sf_erf.h>
 #include <gsl/gsl_multifit_nlin.h>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -109,19 +110,26 @@ void BackToBackExponential::function1D(double *out, const double *xValues,
   // Needed for IntegratePeaksMD for cylinder profile fitted with b=0
   if (normFactor == 0.0)
     normFactor = 1.0;
+  // exp(arg) * erfc(y) of the rising and the decaying edges are calculated
+  // for all the points at once, which is much faster than point by point
+  const double width = sqrt(2 * s2);
+  std::vector<double> arg(nData), y(nData), decay(nData);
   for (size_t i = 0; i < nData; i++) {
-    double diff = xValues[i] - x0;
-    if (fabs(diff) < extent) {
-      double val = 0.0;
-      double arg1 = a / 2 * (a * s2 + 2 * diff);
-      val += exp(arg1 + gsl_sf_log_erfc((a * s2 + diff) /
-                                        sqrt(2 * s2))); // prevent overflow
-      double arg2 = b / 2 * (b * s2 - 2 * diff);
-      val += exp(arg2 + gsl_sf_log_erfc((b * s2 - diff) /
-                                        sqrt(2 * s2))); // prevent overflow
-      out[i] = I * val * normFactor;
-    } else
-      out[i] = 0.0;
+    const double diff = xValues[i] - x0;
+    arg[i] = a / 2 * (a * s2 + 2 * diff);
+    y[i] = (a * s2 + diff) / width;
+  }
+  Kernel::Math::vectorExpErfc(arg.data(), y.data(), out, nData);
+  for (size_t i = 0; i < nData; i++) {
+    const double diff = xValues[i] - x0;
+    arg[i] = b / 2 * (b * s2 - 2 * diff);
+    y[i] = (b * s2 - diff) / width;
+  }
+  Kernel::Math::vectorExpErfc(arg.data(), y.data(), decay.data(), nData);
+  for (size_t i = 0; i < nData; i++) {
+    const double diff = xValues[i] - x0;
+    out[i] =
+        fabs(diff) < extent ? I * (out[i] + decay[i]) * normFactor : 0.0;
   }
 }
 
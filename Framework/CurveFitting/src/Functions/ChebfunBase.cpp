@@ -3,10 +3,9 @@
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/HalfComplex.h"
+#include "MantidKernel/Math/FourierTransform.h"
 
 #include <gsl/gsl_errno.h>
-#include <gsl/gsl_fft_real.h>
-#include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_eigen.h>
 
 #include <algorithm>
@@ -336,6 +335,8 @@ ChebfunBase_sptr ChebfunBase::integral(const std::vector<double> &a,
   }
   aout[m_n] = a[m_n - 1] / double(2 * m_n);
   aout[m_n + 1] = a[m_n] / double(2 * (m_n + 1));
+  // a[0] multiplies T0 rather than T0 / 2
+  aout[1] += a[0] / 2;
   double d = (m_end - m_start) / 2;
   std::transform(aout.begin(), aout.end(), aout.begin(),
                  std::bind(std::multiplies<double>(), _1, d));
@@ -529,11 +530,7 @@ std::vector<double> ChebfunBase::calcA(const std::vector<double> &p) const {
     std::reverse_copy(p.begin(), p.end(), tmp.begin());
     std::copy(p.begin() + 1, p.end() - 1, tmp.begin() + m_n + 1);
 
-    gsl_fft_real_workspace *workspace = gsl_fft_real_workspace_alloc(2 * m_n);
-    gsl_fft_real_wavetable *wavetable = gsl_fft_real_wavetable_alloc(2 * m_n);
-    gsl_fft_real_transform(&tmp[0], 1, 2 * m_n, wavetable, workspace);
-    gsl_fft_real_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
+    Kernel::RealFourierTransform(2 * m_n).forward(tmp.data());
 
     HalfComplex fc(&tmp[0], tmp.size());
     for (size_t i = 0; i < nn; ++i) {
@@ -573,14 +570,7 @@ std::vector<double> ChebfunBase::calcP(const std::vector<double> &a) const {
         d *= 2;
       fc.set(i, d, 0.0);
     }
-    gsl_fft_real_workspace *workspace = gsl_fft_real_workspace_alloc(2 * m_n);
-    gsl_fft_halfcomplex_wavetable *wavetable =
-        gsl_fft_halfcomplex_wavetable_alloc(2 * m_n);
-
-    gsl_fft_halfcomplex_transform(tmp.data(), 1, 2 * m_n, wavetable, workspace);
-
-    gsl_fft_halfcomplex_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
+    Kernel::RealFourierTransform(2 * m_n).backward(tmp.data());
 
     std::reverse_copy(tmp.begin(), tmp.begin() + nn, p.begin());
   } else {
@@ -0,0 +1,84 @@
+#include "MantidCurveFitting/Functions/ChebfunCache.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace CurveFitting {
+namespace Functions {
+
+/// Constructor.
+/// @param builder :: Creates the approximation for a key.
+/// @param maxSize :: The maximum number of approximations to keep.
+ChebfunCache::ChebfunCache(Builder builder, size_t maxSize)
+    : m_builder(std::move(builder)), m_maxSize(maxSize) {
+  if (!m_builder) {
+    throw std::invalid_argument("ChebfunCache: the builder must be set.");
+  }
+  if (m_maxSize == 0) {
+    throw std::invalid_argument("ChebfunCache: the size must be positive.");
+  }
+}
+
+/// Get the approximation for a key. If it isn't in the cache it is built and
+/// replaces the least recently used one.
+/// @param key :: The values of the parameters of the kernel.
+/// @return :: The approximation or an empty pointer if the builder couldn't
+/// create it.
+ChebfunCache::Approximation
+ChebfunCache::get(const std::vector<double> &key) {
+  auto entry = std::find_if(
+      m_entries.begin(), m_entries.end(),
+      [&key](const std::pair<std::vector<double>, Approximation> &cached) {
+        return cached.first == key;
+      });
+  if (entry != m_entries.end()) {
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    return m_entries.front().second;
+  }
+  auto approximation = m_builder(key);
+  if (m_entries.size() == m_maxSize) {
+    m_entries.pop_back();
+  }
+  m_entries.emplace_front(key, approximation);
+  return approximation;
+}
+
+/// Approximate a function to a given accuracy. The order of the polynomial
+/// is doubled until the coefficients of the highest orders become negligible.
+/// @param fun :: The function to approximate.
+/// @param start :: The start of the interval on the x-axis.
+/// @param end :: The end of the interval on the x-axis.
+/// @param accuracy :: The required accuracy relative to the largest
+/// Chebyshev coefficient.
+/// @param maxOrder :: The maximum order of the polynomial.
+/// @return :: The approximation or an empty pointer if the function cannot be
+/// approximated to the accuracy with a polynomial of at most maxOrder.
+ChebfunCache::Approximation
+ChebfunCache::approximate(ChebfunFunctionType fun, double start, double end,
+                          double accuracy, size_t maxOrder) {
+  for (size_t n = 16; n <= maxOrder; n *= 2) {
+    auto approximation = boost::make_shared<SimpleChebfun>(n, fun, start, end);
+    const auto &a = approximation->coeffs();
+    auto absLess = [](double a1, double a2) {
+      return std::fabs(a1) < std::fabs(a2);
+    };
+    const double maxA =
+        std::fabs(*std::max_element(a.begin(), a.end(), absLess));
+    // Check the last eighth of the coefficients
+    const auto tail = a.end() - (n + 1) / 8;
+    const double maxTail =
+        std::fabs(*std::max_element(tail, a.end(), absLess));
+    if (maxTail <= accuracy * maxA) {
+      return approximation;
+    }
+  }
+  return Approximation();
+}
+
+} // namespace Functions
+} // namespace CurveFitting
+} // namespace Mantid
@@ -7,15 +7,14 @@
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/FunctionDomain1D.h"
+#include "MantidKernel/Math/FourierTransform.h"
+
+#include <boost/functional/hash.hpp>
 
 #include <cmath>
 #include <algorithm>
 #include <functional>
 
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_fft_real.h>
-#include <gsl/gsl_fft_halfcomplex.h>
-
 #include <sstream>
 #include <fstream>
 
@@ -66,23 +65,6 @@ void Convolution::setAttribute(const std::string &attName,
   CompositeFunction::setAttribute(attName, att);
 }
 
-namespace {
-// anonymous namespace for local definitions
-
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
-    gsl_fft_real_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
-  }
-  gsl_fft_real_workspace *workspace;
-  gsl_fft_real_wavetable *wavetable;
-};
-}
-
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
  * to direct mode if the domain is not symmetric with respect to the
@@ -128,8 +110,8 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
-  refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  refreshResolution(d1d, false);
+  Kernel::RealFourierTransform fft(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
   if (m_resolution.empty()) {
@@ -173,8 +155,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
         m_resolution[n2 + i] = tmp;
       }
     }
-    gsl_fft_real_transform(m_resolution.data(), 1, nData, workspace.wavetable,
-                           workspace.workspace);
+    fft.forward(m_resolution.data());
     std::transform(m_resolution.begin(), m_resolution.end(),
                    m_resolution.begin(),
                    std::bind2nd(std::multiplies<double>(), dx));
@@ -234,8 +215,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   if (!deltaFunctionsOnly) {
     // Transform the model function
     getFunction(1)->function(domain, values);
-    gsl_fft_real_transform(out, 1, nData, workspace.wavetable,
-                           workspace.workspace);
+    fft.forward(out);
 
     // Fourier transform is integration - multiply by the step in the
     // integration variable
@@ -260,11 +240,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
-                                workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
+    fft.inverse(out);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -320,7 +296,7 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
                                                            // x-values
   auto ixN = nData - ixP - 1; // negative x-values (ixP+ixN=nData-1)
 
-  refreshResolution();
+  refreshResolution(d1d, true);
 
   // double the domain where to evaluate the convolution. Guarantees complete
   // overlap betwen convolution and signal in the original range.
@@ -343,11 +319,11 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
   }
   if (m_resolution.empty()) {
     m_resolution.resize(nData);
-  }
-  resolution->function1D(m_resolution.data(), xValues, nData);
+    resolution->function1D(m_resolution.data(), xValues, nData);
 
-  // Reverse the axis of the resolution data
-  std::reverse(m_resolution.begin(), m_resolution.end());
+    // Reverse the axis of the resolution data
+    std::reverse(m_resolution.begin(), m_resolution.end());
+  }
 
   // check for delta functions
   std::vector<boost::shared_ptr<DeltaFunction>> dltFuns;
@@ -474,27 +450,42 @@ size_t Convolution::addFunction(IFunction_sptr f) {
   * Make sure that the resolution is updated if this function is reused in
  * several Fits.
   */
-void Convolution::setUpForFit() { m_resolution.clear(); }
-
-/// Deletes and zeroes pointer m_resolution forsing function(...) to recalculate
-/// the resolution function
-void Convolution::refreshResolution() const {
-  // refresh when calculation for the first time
-  bool needRefreshing = m_resolution.empty();
-  if (!needRefreshing) {
-    // if resolution has active parameters always refresh
-    IFunction &res = *getFunction(0);
-    for (size_t i = 0; i < res.nParams(); ++i) {
-      if (res.isActive(i)) {
-        needRefreshing = true;
-        break;
-      }
-    }
+void Convolution::setUpForFit() {
+  m_resolution.clear();
+  m_resolutionKey.clear();
+}
+
+/**
+ * Clear m_resolution, forcing function(...) to recalculate the resolution,
+ * unless it was calculated for the same mode, domain, attributes and values of
+ * the resolution parameters. The resolution is therefore calculated once per
+ * fit when its parameters are fixed, and once per iteration otherwise.
+ * @param domain :: The domain of the calculation
+ * @param directMode :: True if calculating in the direct mode
+ */
+void Convolution::refreshResolution(const FunctionDomain1D &domain,
+                                    const bool directMode) const {
+  const size_t nData = domain.size();
+  // Every x value takes part: two domains of the same size and range can
+  // still be spaced differently
+  size_t domainHash = boost::hash_range(domain.getPointerAt(0),
+                                        domain.getPointerAt(0) + nData);
+  const IFunction &res = *getFunction(0);
+  for (const auto &name : res.getAttributeNames()) {
+    boost::hash_combine(domainHash, name);
+    boost::hash_combine(domainHash, res.getAttribute(name).value());
+  }
+  std::vector<double> key{directMode ? 1.0 : 0.0, static_cast<double>(nData)};
+  for (size_t i = 0; i < res.nParams(); ++i) {
+    key.push_back(res.getParameter(i));
   }
-  if (!needRefreshing)
+  if (key == m_resolutionKey && domainHash == m_resolutionHash &&
+      m_resolution.size() == nData)
     return;
   // delete fourier transform of the resolution to force its recalculation
   m_resolution.clear();
+  m_resolutionKey.swap(key);
+  m_resolutionHash = domainHash;
 }
 
 } // namespace Functions
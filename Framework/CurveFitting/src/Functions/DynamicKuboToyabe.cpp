@@ -4,6 +4,9 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidKernel/PhysicalConstants.h"
 
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -141,28 +144,82 @@ double ZFKT(const double x, const double G) {
   return (0.3333333333 + 0.6666666667 * exp(-0.5 * q) * (1 - q));
 }
 
-// Static non-zero field Kubo Toyabe relaxation function
-double HKT(const double x, const double G, const double F) {
-  // q = Delta^2 t^2 in doc
-  const double q = G * G * x * x;
+namespace {
+// omega_0 of the static non-zero field Kubo Toyabe function
+double omega0(const double G, const double F) {
   // Muon gyromagnetic ratio * 2 * PI
   const double gm = 2 * M_PI * PhysicalConstants::MuonGyromagneticRatio;
-  // w = omega_0 in doc
-  double w;
   if (F > 2 * G) {
     // Use F
-    w = gm * F;
-  } else {
-    // Use G
-    w = gm * 2 * G;
+    return gm * F;
   }
+  // Use G
+  return gm * 2 * G;
+}
+
+// Beyond this value of Delta * t the integral of the static non-zero field
+// Kubo Toyabe function doesn't change
+const double FIELD_INTEGRAL_END = 10.0;
+
+// Build a Chebyshev approximation of the integral of the static non-zero field
+// Kubo Toyabe function, int_0^s exp(-u^2/2) sin(b u) du, as a function of
+// s = Delta * t in [0, FIELD_INTEGRAL_END]. The key is {b}.
+ChebfunCache::Approximation buildFieldIntegral(const std::vector<double> &key) {
+  const double b = key.front();
+  auto integrand = ChebfunCache::approximate(
+      [b](double u) { return f1(u, 1.0, b); }, 0.0, FIELD_INTEGRAL_END, 1e-12);
+  if (!integrand) {
+    return integrand;
+  }
+  auto antiderivative = integrand->integral();
+  // Shift the antiderivative to start at zero
+  const double offset = antiderivative(0.0);
+  antiderivative += [offset](double) { return -offset; };
+  return boost::make_shared<const SimpleChebfun>(std::move(antiderivative));
+}
+
+// The integral of the static non-zero field Kubo Toyabe function for fixed
+// Delta and field: int_0^x exp(-Delta^2 t^2 / 2) sin(omega_0 t) dt
+class FieldIntegral {
+public:
+  FieldIntegral(const double G, const double F, ChebfunCache &cache)
+      : m_G(G), m_w(omega0(G, F)) {
+    if (G > 0) {
+      m_approximation = cache.get({m_w / G});
+    }
+  }
+  double operator()(const double x) const {
+    if (x <= 0 || m_G <= 0) {
+      return 0.0;
+    }
+    if (!m_approximation) {
+      // Compute integral
+      return integral(f1, 0.0, x, m_G, m_w);
+    }
+    const double s = std::min(m_G * x, FIELD_INTEGRAL_END);
+    return (*m_approximation)(s) / m_G;
+  }
+
+private:
+  const double m_G;
+  const double m_w;
+  ChebfunCache::Approximation m_approximation;
+};
+
+// Static non-zero field Kubo Toyabe relaxation function
+double HKT(const double x, const double G, const double F,
+           const FieldIntegral &fieldIntegral) {
+  // q = Delta^2 t^2 in doc
+  const double q = G * G * x * x;
+  // w = omega_0 in doc
+  const double w = omega0(G, F);
   // r = Delta^2/omega_0^2
   const double r = G * G / w / w;
 
   double ig;
   if (x > 0 && r > 0) {
     // Compute integral
-    ig = integral(f1, 0.0, x, G, w);
+    ig = fieldIntegral(x);
   } else {
     // Integral is 0
     ig = 0;
@@ -181,6 +238,8 @@ double HKT(const double x, const double G, const double F) {
   }
 }
 
+} // namespace
+
 // Dynamic Kubo-Toyabe
 double DynamicKuboToyabe::getDKT(double t, double G, double F, double v,
                                  double eps) const {
@@ -208,8 +267,9 @@ double DynamicKuboToyabe::getDKT(double t, double G, double F, double v,
           gStat[k] = ZFKT(k * eps, G);
         }
       } else {
+        const FieldIntegral fieldIntegral(G, F, m_fieldIntegrals);
         for (int k = 0; k < tsmax; k++) {
-          gStat[k] = HKT(k * eps, G, F);
+          gStat[k] = HKT(k * eps, G, F, fieldIntegral);
         }
       }
       // Store new G value
@@ -264,8 +324,9 @@ void DynamicKuboToyabe::function1D(double *out, const double *xValues,
     }
     // Non-zero external field
     else {
+      const FieldIntegral fieldIntegral(G, F, m_fieldIntegrals);
       for (size_t i = 0; i < nData; i++) {
-        out[i] = A * HKT(xValues[i], G, F);
+        out[i] = A * HKT(xValues[i], G, F, fieldIntegral);
       }
     }
   }
@@ -283,7 +344,8 @@ void DynamicKuboToyabe::function1D(double *out, const double *xValues,
 /** Constructor
  */
 DynamicKuboToyabe::DynamicKuboToyabe()
-    : m_eps(0.05), m_minEps(0.001), m_maxEps(0.1) {}
+    : m_eps(0.05), m_minEps(0.001), m_maxEps(0.1),
+      m_fieldIntegrals(buildFieldIntegral) {}
 
 //----------------------------------------------------------------------------------------------
 /** Function to calculate derivative numerically
@@ -3,9 +3,11 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/Gaussian.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidKernel/Math/ArrayFunctions.h"
 
 #include <cmath>
 #include <numeric>
+#include <vector>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -33,7 +35,11 @@ void Gaussian::functionLocal(double *out, const double *xValues,
 
   for (size_t i = 0; i < nData; i++) {
     double diff = xValues[i] - peakCentre;
-    out[i] = height * exp(-0.5 * diff * diff * weight);
+    out[i] = -0.5 * diff * diff * weight;
+  }
+  Kernel::Math::vectorExp(out, out, nData);
+  for (size_t i = 0; i < nData; i++) {
+    out[i] *= height;
   }
 }
 
@@ -43,9 +49,15 @@ void Gaussian::functionDerivLocal(Jacobian *out, const double *xValues,
   const double peakCentre = getParameter("PeakCentre");
   const double weight = pow(1 / getParameter("Sigma"), 2);
 
+  std::vector<double> exponential(nData);
+  for (size_t i = 0; i < nData; i++) {
+    double diff = xValues[i] - peakCentre;
+    exponential[i] = -0.5 * diff * diff * weight;
+  }
+  Kernel::Math::vectorExp(exponential.data(), exponential.data(), nData);
   for (size_t i = 0; i < nData; i++) {
     double diff = xValues[i] - peakCentre;
-    double e = exp(-0.5 * diff * diff * weight);
+    double e = exponential[i];
     out->set(i, 0, e);
     out->set(i, 1, diff * height * e * weight);
     out->set(i, 2, -0.5 * diff * diff * height *
@@ -8,10 +8,10 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/PeakFunctionIntegrator.h"
+#include "MantidKernel/Math/ArrayFunctions.h"
 #include "MantidKernel/UnitFactory.h"
 #include <cmath>
 #include <gsl/gsl_math.h>
-#include <gsl/gsl_sf_erf.h>
 #include <gsl/gsl_multifit_nlin.h>
 #include <limits>
 #include "MantidGeometry/Instrument.h"
@@ -287,10 +287,10 @@ void IkedaCarpenterPV::constFunction(double *out, const double *xValues,
 
     double N = 0.25 * alpha * (1 - k * k) / (k * k);
 
-    out[i] = I * N * ((1 - eta) * (Nu * exp(u + gsl_sf_log_erfc(yu)) +
-                                   Nv * exp(v + gsl_sf_log_erfc(yv)) +
-                                   Ns * exp(s + gsl_sf_log_erfc(ys)) +
-                                   Nr * exp(r + gsl_sf_log_erfc(yr))) -
+    out[i] = I * N * ((1 - eta) * (Nu * Kernel::Math::expErfc(u, yu) +
+                                   Nv * Kernel::Math::expErfc(v, yv) +
+                                   Ns * Kernel::Math::expErfc(s, ys) +
+                                   Nr * Kernel::Math::expErfc(r, yr)) -
                       eta * 2.0 / M_PI * (Nu * exponentialIntegral(zu).imag() +
                                           Nv * exponentialIntegral(zv).imag() +
                                           Ns * exponentialIntegral(zs).imag() +
@@ -369,10 +369,10 @@ void IkedaCarpenterPV::functionLocal(double *out, const double *xValues,
 
     double N = 0.25 * alpha * (1 - k * k) / (k * k);
 
-    out[i] = I * N * ((1 - eta) * (Nu * exp(u + gsl_sf_log_erfc(yu)) +
-                                   Nv * exp(v + gsl_sf_log_erfc(yv)) +
-                                   Ns * exp(s + gsl_sf_log_erfc(ys)) +
-                                   Nr * exp(r + gsl_sf_log_erfc(yr))) -
+    out[i] = I * N * ((1 - eta) * (Nu * Kernel::Math::expErfc(u, yu) +
+                                   Nv * Kernel::Math::expErfc(v, yv) +
+                                   Ns * Kernel::Math::expErfc(s, ys) +
+                                   Nr * Kernel::Math::expErfc(r, yr)) -
                       eta * 2.0 / M_PI * (Nu * exponentialIntegral(zu).imag() +
                                           Nv * exponentialIntegral(zv).imag() +
                                           Ns * exponentialIntegral(zs).imag() +
@@ -1,9 +1,11 @@
 #include "MantidCurveFitting/Functions/PseudoVoigt.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidCurveFitting/Constraints/BoundaryConstraint.h"
+#include "MantidKernel/Math/ArrayFunctions.h"
 #include "MantidKernel/make_unique.h"
 
 #include <cmath>
+#include <vector>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -32,10 +34,16 @@ void PseudoVoigt::functionLocal(double *out, const double *xValues,
   // Gaussian parameter sigma...fwhm/(2*sqrt(2*ln(2)))...gamma/sqrt(2*ln(2))
   double sSquared = gSquared / (2.0 * M_LN2);
 
+  for (size_t i = 0; i < nData; ++i) {
+    double xDiffSquared = (xValues[i] - x0) * (xValues[i] - x0);
+    out[i] = -0.5 * xDiffSquared / sSquared;
+  }
+  Kernel::Math::vectorExp(out, out, nData);
+
   for (size_t i = 0; i < nData; ++i) {
     double xDiffSquared = (xValues[i] - x0) * (xValues[i] - x0);
 
-    out[i] = h * (gFraction * exp(-0.5 * xDiffSquared / sSquared) +
+    out[i] = h * (gFraction * out[i] +
                   (lFraction * gSquared / (xDiffSquared + gSquared)));
   }
 }
@@ -57,11 +65,18 @@ void PseudoVoigt::functionDerivLocal(Jacobian *out, const double *xValues,
   // Gaussian parameter sigma...fwhm/(2*sqrt(2*ln(2)))...gamma/sqrt(2*ln(2))
   double sSquared = gSquared / (2.0 * M_LN2);
 
+  std::vector<double> expTerms(nData);
+  for (size_t i = 0; i < nData; ++i) {
+    double xDiff = (xValues[i] - x0);
+    expTerms[i] = -0.5 * xDiff * xDiff / sSquared;
+  }
+  Kernel::Math::vectorExp(expTerms.data(), expTerms.data(), nData);
+
   for (size_t i = 0; i < nData; ++i) {
     double xDiff = (xValues[i] - x0);
     double xDiffSquared = xDiff * xDiff;
 
-    double expTerm = exp(-0.5 * xDiffSquared / sSquared);
+    double expTerm = expTerms[i];
     double lorentzTerm = gSquared / (xDiffSquared + gSquared);
 
     out->set(i, 0, h * (expTerm - lorentzTerm));
@@ -3,7 +3,6 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/StretchExpMuon.h"
 #include "MantidAPI/FunctionFactory.h"
-#include <cmath>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -24,17 +23,6 @@ void StretchExpMuon::init() {
                    "Stretching exponent, usually in the (0,2] range");
 }
 
-void StretchExpMuon::function1D(double *out, const double *xValues,
-                                const size_t nData) const {
-  const double A = getParameter("A");
-  const double G = getParameter("Lambda");
-  const double b = getParameter("Beta");
-
-  for (size_t i = 0; i < nData; i++) {
-    out[i] = A * exp(-pow(G * xValues[i], b));
-  }
-}
-
 } // namespace Functions
 } // namespace CurveFitting
 } // namespace Mantid
@@ -599,9 +599,10 @@ void ThermalNeutronBk2BkExpConvPVoigt::setParameter(size_t i,
       m_unitCellSize = value;
     }
   } else {
-    // Non lattice parameter
+    // Non lattice parameter.  The height does not affect the peak parameters
     ParamFunction::setParameter(i, value, explicitlySet);
-    m_hasNewParameterValue = true;
+    if (i != HEIGHTINDEX)
+      m_hasNewParameterValue = true;
   }
 }
 
@@ -622,7 +623,8 @@ void ThermalNeutronBk2BkExpConvPVoigt::setParameter(const std::string &name,
     }
   } else {
     ParamFunction::setParameter(name, value, explicitlySet);
-    m_hasNewParameterValue = true;
+    if (name != "Height")
+      m_hasNewParameterValue = true;
   }
 }
 
@@ -3,8 +3,11 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/UserFunction.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include "MantidAPI/MuParserUtils.h"
+#include "MantidKernel/make_unique.h"
 #include <boost/tokenizer.hpp>
+#include <algorithm>
 #include "MantidGeometry/muParser_Silent.h"
 
 namespace Mantid {
@@ -63,6 +66,9 @@ void UserFunction::setAttribute(const std::string &attName,
   }
 
   m_x_set = false;
+  m_derivativeParsers.clear();
+  m_compiled.reset();
+  m_compiledDerivatives.clear();
   clearAllParameters();
 
   try {
@@ -93,6 +99,59 @@ void UserFunction::setAttribute(const std::string &attName,
   }
 
   m_parser->SetExpr(m_formula);
+  m_compiled = compile(m_formula);
+  setUpDerivatives();
+}
+
+/** Compile a formula in x and the parameters for evaluation over arrays.
+ * @param formula :: A formula that mu::Parser accepts
+ * @return The compiled formula or null if it cannot be compiled
+ */
+std::unique_ptr<CompiledExpression>
+UserFunction::compile(const std::string &formula) {
+  std::map<std::string, const double *> parameters;
+  for (size_t i = 0; i < nParams(); ++i) {
+    parameters.emplace(parameterName(i), getParameterAddress(i));
+  }
+  try {
+    return Kernel::make_unique<CompiledExpression>(
+        formula, std::vector<std::string>(1, "x"), parameters);
+  } catch (std::invalid_argument &) {
+    return nullptr;
+  }
+}
+
+/// Create parsers for the derivatives of the formula by each parameter, if it
+/// can be differentiated symbolically.
+void UserFunction::setUpDerivatives() {
+  try {
+    for (size_t i = 0; i < nParams(); ++i) {
+      auto parser = Kernel::make_unique<mu::Parser>();
+      extraOneVarFunctions(*parser);
+      parser->DefineVar("x", &m_x);
+      for (size_t j = 0; j < nParams(); ++j) {
+        parser->DefineVar(parameterName(j), getParameterAddress(j));
+      }
+      const auto derivative =
+          MuParserUtils::differentiate(m_formula, parameterName(i));
+      parser->SetExpr(derivative);
+      // Check the syntax of the derivative
+      parser->Eval();
+      m_derivativeParsers.push_back(std::move(parser));
+      m_compiledDerivatives.push_back(compile(derivative));
+    }
+  } catch (...) {
+    // Fall back to the numerical derivatives
+    m_derivativeParsers.clear();
+  }
+  const bool allCompiled =
+      std::all_of(m_compiledDerivatives.begin(), m_compiledDerivatives.end(),
+                  [](const std::unique_ptr<CompiledExpression> &derivative) {
+                    return static_cast<bool>(derivative);
+                  });
+  if (m_derivativeParsers.empty() || !allCompiled) {
+    m_compiledDerivatives.clear();
+  }
 }
 
 /** Calculate the fitting function.
@@ -104,13 +163,18 @@ void UserFunction::setAttribute(const std::string &attName,
 */
 void UserFunction::function1D(double *out, const double *xValues,
                               const size_t nData) const {
+  if (m_compiled) {
+    m_compiled->evaluate(xValues, out, nData);
+    return;
+  }
   for (size_t i = 0; i < nData; i++) {
     m_x = xValues[i];
     out[i] = m_parser->Eval();
   }
 }
 
-/**
+/** Calculate the derivatives from the symbolic derivatives of the formula if
+* they exist, or numerically otherwise.
 * @param domain :: the space on which the function acts
 * @param jacobian :: the set of partial derivatives of the function with respect
 * to the
@@ -118,7 +182,29 @@ void UserFunction::function1D(double *out, const double *xValues,
 */
 void UserFunction::functionDeriv(const API::FunctionDomain &domain,
                                  API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
+  const auto *d1d = dynamic_cast<const FunctionDomain1D *>(&domain);
+  if (m_derivativeParsers.empty() || !d1d ||
+      dynamic_cast<const FunctionDomain1DHistogram *>(&domain)) {
+    calNumericalDeriv(domain, jacobian);
+    return;
+  }
+  if (!m_compiledDerivatives.empty()) {
+    std::vector<double> values(d1d->size());
+    for (size_t j = 0; j < m_compiledDerivatives.size(); ++j) {
+      m_compiledDerivatives[j]->evaluate(d1d->getPointerAt(0), values.data(),
+                                         values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        jacobian.set(i, j, values[i]);
+      }
+    }
+    return;
+  }
+  for (size_t i = 0; i < d1d->size(); ++i) {
+    m_x = (*d1d)[i];
+    for (size_t j = 0; j < m_derivativeParsers.size(); ++j) {
+      jacobian.set(i, j, m_derivativeParsers[j]->Eval());
+    }
+  }
 }
 
 } // namespace Functions
@@ -134,14 +134,31 @@ void IMWDomainCreator::declareDatasetProperties(const std::string &suffix,
  * @returns :: A pair of start iterator and size of the data.
  */
 std::pair<size_t, size_t> IMWDomainCreator::getXInterval() const {
-
   const auto &X = m_matrixWorkspace->x(m_workspaceIndex);
+  setParameters();
+  return getXInterval(X.rawData(), m_matrixWorkspace->isHistogramData(),
+                      m_startX, m_endX);
+}
+
+/**
+ * Find the range of x values within [startX, endX]. Other fitting code uses
+ * this to select the same data as Fit.
+ * @param X :: The x values of a spectrum, ascending or descending
+ * @param isHistogram :: True if X holds bin edges
+ * @param startX :: The start of the range, EMPTY_DBL() for the whole spectrum.
+ * Set to the start actually used.
+ * @param endX :: The end of the range, EMPTY_DBL() for the whole spectrum.
+ * Set to the end actually used.
+ * @returns :: The indices of the first and one past the last data point
+ */
+std::pair<size_t, size_t>
+IMWDomainCreator::getXInterval(const std::vector<double> &X,
+                               const bool isHistogram, double &startX,
+                               double &endX) {
   if (X.empty()) {
     throw std::runtime_error("Workspace contains no data.");
   }
 
-  setParameters();
-
   // From points to the first occurrence of StartX in the workspace interval.
   // End points to the last occurrence of EndX in the workspace interval.
   // Find the fitting interval: from -> to
@@ -150,26 +167,26 @@ std::pair<size_t, size_t> IMWDomainCreator::getXInterval() const {
 
   bool isXAscending = X.front() < X.back();
 
-  if (m_startX == EMPTY_DBL() && m_endX == EMPTY_DBL()) {
-    m_startX = X.front();
+  if (startX == EMPTY_DBL() && endX == EMPTY_DBL()) {
+    startX = X.front();
     from = X.begin();
-    m_endX = X.back();
+    endX = X.back();
     to = X.end();
-  } else if (m_startX == EMPTY_DBL() || m_endX == EMPTY_DBL()) {
+  } else if (startX == EMPTY_DBL() || endX == EMPTY_DBL()) {
     throw std::invalid_argument(
         "Both StartX and EndX must be given to set fitting interval.");
   } else if (isXAscending) {
-    if (m_startX > m_endX) {
-      std::swap(m_startX, m_endX);
+    if (startX > endX) {
+      std::swap(startX, endX);
     }
-    from = std::lower_bound(X.begin(), X.end(), m_startX);
-    to = std::upper_bound(from, X.end(), m_endX);
+    from = std::lower_bound(X.begin(), X.end(), startX);
+    to = std::upper_bound(from, X.end(), endX);
   } else { // x is descending
-    if (m_startX < m_endX) {
-      std::swap(m_startX, m_endX);
+    if (startX < endX) {
+      std::swap(startX, endX);
     }
-    from = std::lower_bound(X.begin(), X.end(), m_startX, greaterIsLess);
-    to = std::upper_bound(from, X.end(), m_endX, greaterIsLess);
+    from = std::lower_bound(X.begin(), X.end(), startX, greaterIsLess);
+    to = std::upper_bound(from, X.end(), endX, greaterIsLess);
   }
 
   // Check whether the fitting interval defined by StartX and EndX is 0.
@@ -180,7 +197,7 @@ std::pair<size_t, size_t> IMWDomainCreator::getXInterval() const {
                                 "within the workspace interval.");
   }
 
-  if (m_matrixWorkspace->isHistogramData()) {
+  if (isHistogram) {
     if (X.end() == to) {
       to = X.end() - 1;
     }
@@ -0,0 +1,187 @@
+#include "MantidCurveFitting/ParameterBlocks.h"
+#include "MantidAPI/MultiDomainFunction.h"
+
+#include <gsl/gsl_linalg.h>
+
+#include <map>
+#include <stdexcept>
+
+namespace Mantid {
+namespace CurveFitting {
+
+namespace {
+/// The LU decomposition of a matrix, solving for many right-hand sides
+class LUDecomposition {
+public:
+  explicit LUDecomposition(GSLMatrix matrix)
+      : m_lu(std::move(matrix)),
+        m_permutation(gsl_permutation_alloc(m_lu.size1())) {
+    int sign;
+    gsl_linalg_LU_decomp(m_lu.gsl(), m_permutation, &sign);
+    for (size_t i = 0; i < m_lu.size1(); ++i) {
+      if (m_lu.get(i, i) == 0.0)
+        throw std::runtime_error("Failed to solve system of linear "
+                                 "equations: the matrix is singular.");
+    }
+  }
+  ~LUDecomposition() { gsl_permutation_free(m_permutation); }
+  LUDecomposition(const LUDecomposition &) = delete;
+  LUDecomposition &operator=(const LUDecomposition &) = delete;
+  /// Solve in place
+  void solve(gsl_vector *x) const {
+    gsl_linalg_LU_svx(m_lu.gsl(), m_permutation, x);
+  }
+
+private:
+  GSLMatrix m_lu;
+  gsl_permutation *m_permutation;
+};
+} // namespace
+
+/**
+ * Find the local parameters of each domain of a MultiDomainFunction: the
+ * active parameters of the member functions that are applied to a single
+ * domain. Any other function has only global parameters.
+ * @param function :: A fitting function
+ */
+ParameterBlocks::ParameterBlocks(const API::IFunction &function) {
+  auto multi = dynamic_cast<const API::MultiDomainFunction *>(&function);
+  std::map<size_t, std::vector<size_t>> blocks;
+  const auto nDomains = multi ? multi->getNumberDomains() : 0;
+  std::vector<size_t> domains;
+  for (size_t ip = 0, ia = 0; ip < function.nParams(); ++ip) {
+    if (!function.isActive(ip))
+      continue;
+    if (multi) {
+      multi->getDomainIndices(multi->functionIndex(ip), nDomains, domains);
+      if (domains.size() == 1) {
+        blocks[domains.front()].push_back(ia);
+        ++ia;
+        continue;
+      }
+    }
+    m_globals.push_back(ia);
+    ++ia;
+  }
+  for (auto &block : blocks) {
+    m_blocks.push_back(std::move(block.second));
+  }
+}
+
+/**
+ * Check that the matrix of a system of equations for the active parameters
+ * doesn't couple the local parameters of different blocks.
+ * @param matrix :: A square matrix
+ * @return :: True if solve() can be used
+ */
+bool ParameterBlocks::isBlockStructured(const GSLMatrix &matrix) const {
+  if (m_blocks.empty())
+    return false;
+  size_t n = m_globals.size();
+  for (const auto &block : m_blocks) {
+    n += block.size();
+  }
+  if (matrix.size1() != n || matrix.size2() != n)
+    return false;
+  for (size_t b1 = 0; b1 < m_blocks.size(); ++b1) {
+    for (size_t b2 = 0; b2 < b1; ++b2) {
+      for (auto i : m_blocks[b1]) {
+        for (auto j : m_blocks[b2]) {
+          if (matrix.get(i, j) != 0.0 || matrix.get(j, i) != 0.0)
+            return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * Solve matrix * x == rhs by eliminating the local parameters of each block
+ * with its Schur complement. The matrix must be block structured.
+ * @param matrix :: The matrix of the system
+ * @param rhs :: The right-hand side
+ * @param x :: The solution
+ * @throw std::runtime_error if a block or the Schur complement is singular
+ */
+void ParameterBlocks::solve(const GSLMatrix &matrix, const GSLVector &rhs,
+                            GSLVector &x) const {
+  const auto ng = m_globals.size();
+  x.resize(rhs.size());
+  // The Schur complement of the local blocks and its right-hand side
+  GSLMatrix schur(ng, ng);
+  GSLVector schurRhs(ng);
+  for (size_t i = 0; i < ng; ++i) {
+    schurRhs.set(i, rhs.get(m_globals[i]));
+    for (size_t j = 0; j < ng; ++j) {
+      schur.set(i, j, matrix.get(m_globals[i], m_globals[j]));
+    }
+  }
+
+  // For each block: A^-1 * r and the columns of A^-1 * B
+  std::vector<GSLVector> localRhs(m_blocks.size());
+  std::vector<std::vector<GSLVector>> localCoupling(m_blocks.size());
+  for (size_t b = 0; b < m_blocks.size(); ++b) {
+    const auto &block = m_blocks[b];
+    const auto nl = block.size();
+    GSLMatrix A(nl, nl);
+    auto &r = localRhs[b];
+    r.resize(nl);
+    for (size_t i = 0; i < nl; ++i) {
+      r.set(i, rhs.get(block[i]));
+      for (size_t j = 0; j < nl; ++j) {
+        A.set(i, j, matrix.get(block[i], block[j]));
+      }
+    }
+    LUDecomposition lu(A);
+    lu.solve(r.gsl());
+    auto &coupling = localCoupling[b];
+    coupling.resize(ng);
+    for (size_t k = 0; k < ng; ++k) {
+      auto &column = coupling[k];
+      column.resize(nl);
+      for (size_t i = 0; i < nl; ++i) {
+        column.set(i, matrix.get(block[i], m_globals[k]));
+      }
+      lu.solve(column.gsl());
+    }
+    // Subtract B^T * A^-1 * B and B^T * A^-1 * r
+    for (size_t k1 = 0; k1 < ng; ++k1) {
+      double d = 0.0;
+      for (size_t i = 0; i < nl; ++i) {
+        d += matrix.get(m_globals[k1], block[i]) * r.get(i);
+      }
+      schurRhs.set(k1, schurRhs.get(k1) - d);
+      for (size_t k2 = 0; k2 < ng; ++k2) {
+        d = 0.0;
+        for (size_t i = 0; i < nl; ++i) {
+          d += matrix.get(m_globals[k1], block[i]) * coupling[k2].get(i);
+        }
+        schur.set(k1, k2, schur.get(k1, k2) - d);
+      }
+    }
+  }
+
+  // Solve for the global parameters
+  if (ng > 0) {
+    LUDecomposition lu(schur);
+    lu.solve(schurRhs.gsl());
+    for (size_t k = 0; k < ng; ++k) {
+      x.set(m_globals[k], schurRhs.get(k));
+    }
+  }
+  // Back-substitute: x_b = A^-1 * r - A^-1 * B * x_g
+  for (size_t b = 0; b < m_blocks.size(); ++b) {
+    const auto &block = m_blocks[b];
+    for (size_t i = 0; i < block.size(); ++i) {
+      double value = localRhs[b].get(i);
+      for (size_t k = 0; k < ng; ++k) {
+        value -= localCoupling[b][k].get(i) * schurRhs.get(k);
+      }
+      x.set(block[i], value);
+    }
+  }
+}
+
+} // namespace CurveFitting
+} // namespace Mantid
@@ -305,6 +305,67 @@ public:
     return;
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Goal: Test that the peaks calculated after a change of the profile
+   * parameters are the same as those of a new function
+   */
+  void test_CalculatePeaksIntensitiesAfterParameterChange() {
+    map<string, double> parammap{{"Dtt1", 29671.7500},
+                                 {"Dtt2", 0.0},
+                                 {"Dtt1t", 29671.750},
+                                 {"Dtt2t", 0.30},
+                                 {"Zero", 0.0},
+                                 {"Zerot", 33.70},
+                                 {"Alph0", 4.026},
+                                 {"Alph1", 7.362},
+                                 {"Beta0", 3.489},
+                                 {"Beta1", 19.535},
+                                 {"Alph0t", 60.683},
+                                 {"Alph1t", 39.730},
+                                 {"Beta0t", 96.864},
+                                 {"Beta1t", 96.864},
+                                 {"Sig2", sqrt(11.380)},
+                                 {"Sig1", sqrt(9.901)},
+                                 {"Sig0", sqrt(17.370)},
+                                 {"Width", 1.0055},
+                                 {"Tcross", 0.4700},
+                                 {"Gam0", 0.0},
+                                 {"Gam1", 0.0},
+                                 {"Gam2", 0.0},
+                                 {"LatticeConstant", 4.156890}};
+    std::vector<std::vector<int>> hkls{{9, 3, 2}, {8, 5, 2}};
+
+    MatrixWorkspace_sptr dataws = createDataWorkspace(2);
+    const MantidVec &vecX = dataws->readX(0);
+    const MantidVec &vecY = dataws->readY(0);
+
+    LeBailFunction lebailfunction("ThermalNeutronBk2BkExpConvPVoigt");
+    lebailfunction.setProfileParameterValues(parammap);
+    lebailfunction.addPeaks(hkls);
+    vector<double> first(vecY.size(), 0.);
+    lebailfunction.calculatePeaksIntensities(vecX, vecY, first);
+    // Nothing changed
+    vector<double> second(vecY.size(), 0.);
+    lebailfunction.calculatePeaksIntensities(vecX, vecY, second);
+    TS_ASSERT_EQUALS(first, second);
+
+    // Broaden the peaks
+    parammap["Sig1"] = sqrt(30.0);
+    lebailfunction.setProfileParameterValues(parammap);
+    vector<double> changed(vecY.size(), 0.);
+    lebailfunction.calculatePeaksIntensities(vecX, vecY, changed);
+    TS_ASSERT_DIFFERS(first, changed);
+
+    LeBailFunction expectedfunction("ThermalNeutronBk2BkExpConvPVoigt");
+    expectedfunction.setProfileParameterValues(parammap);
+    expectedfunction.addPeaks(hkls);
+    vector<double> expected(vecY.size(), 0.);
+    expectedfunction.calculatePeaksIntensities(vecX, vecY, expected);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      TS_ASSERT_DELTA(changed[i], expected[i], 1e-10 * fabs(expected[i]));
+    }
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Goal: Test function() of LeBailFunction of Fullprof No. 9 by plotting 2
    *adjacent peaks
@@ -22,8 +22,10 @@
 #include "MantidKernel/UnitFactory.h"
 
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
+#include <cmath>
 #include <sstream>
 #include <algorithm>
+#include <limits>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -617,6 +619,101 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  void test_fits_without_child_algorithms_agree_with_Fit() {
+    createData();
+    const std::string function = "name=LinearBackground,A0=1,A1=0.3;name="
+                                 "Gaussian,PeakCentre=5,Height=2,Sigma=0.1";
+
+    for (const std::string fitType : {"Sequential", "Individual"}) {
+      // CreateOutput makes the algorithm run Fit for every spectrum
+      std::vector<TWS_type> results;
+      for (const bool createOutput : {false, true}) {
+        PlotPeakByLogValue alg;
+        alg.initialize();
+        alg.setPropertyValue(
+            "Input", "PlotPeakGroup_0;PlotPeakGroup_1;PlotPeakGroup_2,i0");
+        alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+        alg.setPropertyValue("WorkspaceIndex", "1");
+        alg.setPropertyValue("LogValue", "var");
+        alg.setPropertyValue("Function", function);
+        alg.setPropertyValue("FitType", fitType);
+        alg.setProperty("CreateOutput", createOutput);
+        alg.execute();
+        TS_ASSERT(alg.isExecuted());
+        results.push_back(
+            WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult"));
+      }
+
+      TS_ASSERT_EQUALS(results[0]->rowCount(), 3);
+      TS_ASSERT_EQUALS(results[1]->rowCount(), 3);
+      TS_ASSERT_EQUALS(results[0]->getColumnNames(),
+                       results[1]->getColumnNames());
+      for (size_t row = 0; row < 3; ++row) {
+        for (size_t col = 0; col < results[0]->columnCount(); ++col) {
+          TS_ASSERT_DELTA(results[0]->Double(row, col),
+                          results[1]->Double(row, col), 1e-8);
+        }
+      }
+    }
+
+    AnalysisDataService::Instance().clear();
+    m_wsg.reset();
+  }
+
+  void test_minimizer_table_outputs_are_created() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspace(1, 20);
+    auto &x = ws->mutableX(0);
+    auto &y = ws->mutableY(0);
+    for (size_t i = 0; i < y.size(); ++i) {
+      x[i] = 0.1 * static_cast<double>(i);
+      y[i] = 10.0 * exp(-x[i] / 0.5);
+    }
+    AnalysisDataService::Instance().addOrReplace("PlotPeakExpDecay", ws);
+
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakExpDecay,i0");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("Function", "name=ExpDecay,Height=8,Lifetime=1");
+    alg.setPropertyValue("MaxIterations", "100000");
+    alg.setPropertyValue(
+        "Minimizer", "MultiChainFABADA,NumberOfChains=4,NumberOfTemperatures=3,"
+                     "ChainLength=8000,StepsBetweenValues=10,"
+                     "Parameters=PlotPeakFABADAParameters");
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+
+    TS_ASSERT(AnalysisDataService::Instance().doesExist(
+        "PlotPeakFABADAParameters"));
+    auto result =
+        WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult");
+    TS_ASSERT_DELTA(result->Double(0, 1), 10.0, 0.1);
+    TS_ASSERT_DELTA(result->Double(0, 3), 0.5, 0.02);
+
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_failed_fit_stops_the_algorithm() {
+    createData();
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        "PlotPeakGroup_1");
+    ws->mutableY(1)[10] = std::numeric_limits<double>::quiet_NaN();
+
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setPropertyValue("Input",
+                         "PlotPeakGroup_0;PlotPeakGroup_1;PlotPeakGroup_2");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("WorkspaceIndex", "1");
+    alg.setPropertyValue("Function", "name=LinearBackground,A0=1,A1=0.3");
+    alg.setPropertyValue("FitType", "Individual");
+    TS_ASSERT_THROWS(alg.execute(), std::runtime_error);
+
+    deleteData();
+    AnalysisDataService::Instance().remove("PlotPeakResult");
+  }
+
 private:
   WorkspaceGroup_sptr m_wsg;
 
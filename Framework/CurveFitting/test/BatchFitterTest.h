@@ -0,0 +1,299 @@
+#ifndef MANTID_CURVEFITTING_BATCHFITTERTEST_H_
+#define MANTID_CURVEFITTING_BATCHFITTERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/ITableWorkspace.h"
+#include "MantidCurveFitting/Algorithms/Fit.h"
+#include "MantidCurveFitting/BatchFitter.h"
+#include "MantidCurveFitting/Functions/Gaussian.h"
+#include "MantidCurveFitting/Functions/LinearBackground.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidKernel/ProgressBase.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using Mantid::CurveFitting::BatchFitter;
+using Mantid::CurveFitting::Functions::Gaussian;
+using Mantid::CurveFitting::Functions::LinearBackground;
+using namespace Mantid::API;
+
+namespace {
+/// Spectrum i holds the line y = i + (i + 1) * x at the bin centres
+MatrixWorkspace_sptr createLines(const int nSpectra) {
+  auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(nSpectra, 20, 0.0,
+                                                             0.5);
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    const auto &x = ws->x(i);
+    auto &y = ws->mutableY(i);
+    auto &e = ws->mutableE(i);
+    const double index = static_cast<double>(i);
+    for (size_t j = 0; j < y.size(); ++j) {
+      y[j] = index + (index + 1.0) * (x[j] + x[j + 1]) / 2.0;
+      e[j] = 1.0;
+    }
+  }
+  return ws;
+}
+
+/// Spectrum i holds a narrow Gaussian centred at 1 + 0.3 * i
+MatrixWorkspace_sptr createMovingPeak(const int nSpectra) {
+  auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(nSpectra, 200,
+                                                             0.0, 0.05);
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    const auto &x = ws->x(i);
+    auto &y = ws->mutableY(i);
+    auto &e = ws->mutableE(i);
+    const double centre = 1.0 + 0.3 * static_cast<double>(i);
+    for (size_t j = 0; j < y.size(); ++j) {
+      const double dx = (x[j] + x[j + 1]) / 2.0 - centre;
+      y[j] = std::exp(-dx * dx / 0.08);
+      e[j] = 1.0;
+    }
+  }
+  return ws;
+}
+
+/// A wavy line over 20 bins on [0, 10], with the x values descending if asked
+MatrixWorkspace_sptr createWavyHistogram(const bool descending) {
+  auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 20, 0.0, 0.5);
+  auto &x = ws->mutableX(0);
+  if (descending)
+    std::reverse(x.begin(), x.end());
+  auto &y = ws->mutableY(0);
+  auto &e = ws->mutableE(0);
+  for (size_t j = 0; j < y.size(); ++j) {
+    const double centre = (x[j] + x[j + 1]) / 2.0;
+    y[j] = 1.0 + 2.0 * centre + 0.3 * std::sin(5.0 * centre);
+    e[j] = 1.0;
+  }
+  return ws;
+}
+
+/// Counts the reports and requests cancellation after a number of them
+class CountingProgress : public Mantid::Kernel::ProgressBase {
+public:
+  CountingProgress(int64_t numSteps, int cancelAfter)
+      : ProgressBase(0.0, 1.0, numSteps), m_cancelAfter(cancelAfter) {
+    setNotifyStep(0.0);
+  }
+  void doReport(const std::string &) override { ++reports; }
+  bool hasCancellationBeenRequested() const override {
+    return reports >= m_cancelAfter;
+  }
+  std::atomic<int> reports{0};
+
+private:
+  const int m_cancelAfter;
+};
+
+IFunction_sptr createLinearBackground() {
+  auto function = boost::make_shared<LinearBackground>();
+  function->initialize();
+  function->setParameter("A0", 1.0);
+  function->setParameter("A1", 1.0);
+  return function;
+}
+}
+
+class BatchFitterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BatchFitterTest *createSuite() { return new BatchFitterTest(); }
+  static void destroySuite(BatchFitterTest *suite) { delete suite; }
+
+  BatchFitterTest() { FrameworkManager::Instance(); }
+
+  void test_null_function_throws() {
+    TS_ASSERT_THROWS(BatchFitter(IFunction_const_sptr()),
+                     std::invalid_argument);
+  }
+
+  void test_fits_every_spectrum() {
+    auto ws = createLines(50);
+    std::vector<size_t> indices(50);
+    for (size_t i = 0; i < indices.size(); ++i)
+      indices[i] = indices.size() - 1 - i;
+    BatchFitter fitter(createLinearBackground());
+
+    ITableWorkspace_sptr table;
+    TS_ASSERT_THROWS_NOTHING(table = fitter.fit(ws, indices));
+    TS_ASSERT_EQUALS(table->rowCount(), 50);
+    const std::vector<std::string> columns{"WorkspaceIndex", "A0",
+                                           "A0_Err",         "A1",
+                                           "A1_Err",         "Chi_squared",
+                                           "Status"};
+    TS_ASSERT_EQUALS(table->getColumnNames(), columns);
+    for (size_t row = 0; row < table->rowCount(); ++row) {
+      const int index = table->Int(row, 0);
+      TS_ASSERT_EQUALS(index, static_cast<int>(indices[row]));
+      TS_ASSERT_DELTA(table->Double(row, 1), index, 1e-8);
+      TS_ASSERT_DELTA(table->Double(row, 3), index + 1.0, 1e-8);
+      TS_ASSERT(table->Double(row, 2) > 0.0);
+      TS_ASSERT_DELTA(table->Double(row, 5), 0.0, 1e-10);
+      TS_ASSERT_EQUALS(table->String(row, 6), "success");
+    }
+  }
+
+  void test_fitting_range() {
+    auto ws = createLines(2);
+    // Spoil the data outside of the fitting range
+    ws->mutableY(1)[0] = 100.0;
+    ws->mutableY(1)[19] = 100.0;
+    BatchFitter fitter(createLinearBackground());
+    fitter.setFittingRange(0.5, 9.0);
+
+    auto table = fitter.fit(ws, {1});
+    TS_ASSERT_EQUALS(table->rowCount(), 1);
+    TS_ASSERT_DELTA(table->Double(0, 1), 1.0, 1e-8);
+    TS_ASSERT_DELTA(table->Double(0, 3), 2.0, 1e-8);
+    TS_ASSERT_EQUALS(table->String(0, 6), "success");
+  }
+
+  void test_fitting_range_of_histograms_matches_fit() {
+    // Descending x, and a range reaching the last bin edge
+    checkMatchesFit(createWavyHistogram(true), 9.0, 0.5);
+    checkMatchesFit(createWavyHistogram(true), 0.0, 10.0);
+    checkMatchesFit(createWavyHistogram(false), 2.0, 10.0);
+    checkMatchesFit(createWavyHistogram(false), Mantid::EMPTY_DBL(),
+                    Mantid::EMPTY_DBL());
+  }
+
+  void test_failed_fit_does_not_stop_the_others() {
+    auto ws = createLines(3);
+    ws->mutableY(1)[5] = std::nan("");
+    BatchFitter fitter(createLinearBackground());
+
+    auto table = fitter.fit(ws, {0, 1, 2});
+    TS_ASSERT_EQUALS(table->rowCount(), 3);
+    TS_ASSERT_EQUALS(table->String(0, 6), "success");
+    TS_ASSERT_DIFFERS(table->String(1, 6), "success");
+    TS_ASSERT(std::isnan(table->Double(1, 1)));
+    TS_ASSERT_EQUALS(table->String(2, 6), "success");
+    TS_ASSERT_DELTA(table->Double(2, 1), 2.0, 1e-8);
+
+    fitter.setIgnoreInvalidData(true);
+    table = fitter.fit(ws, {1});
+    TS_ASSERT_EQUALS(table->String(0, 6), "success");
+    TS_ASSERT_DELTA(table->Double(0, 1), 1.0, 1e-8);
+  }
+
+  void test_max_iterations_is_reported() {
+    auto ws = createLines(1);
+    BatchFitter fitter(createLinearBackground());
+    fitter.setMaxIterations(1);
+
+    auto table = fitter.fit(ws, {0});
+    TS_ASSERT_EQUALS(table->String(0, 6),
+                     "Failed to converge after 1 iterations.");
+  }
+
+  void test_chained_fits_follow_a_moving_peak() {
+    auto ws = createMovingPeak(15);
+    auto gaussian = boost::make_shared<Gaussian>();
+    gaussian->initialize();
+    gaussian->setHeight(1.0);
+    gaussian->setCentre(1.0);
+    gaussian->setFwhm(0.2 * 2.0 * std::sqrt(2.0 * std::log(2.0)));
+    std::vector<size_t> indices(15);
+    for (size_t i = 0; i < indices.size(); ++i)
+      indices[i] = i;
+    BatchFitter fitter(gaussian);
+    fitter.setChained(true);
+
+    auto table = fitter.fit(ws, indices);
+    TS_ASSERT_EQUALS(table->rowCount(), 15);
+    for (size_t row = 0; row < table->rowCount(); ++row) {
+      TS_ASSERT_DELTA(table->Double(row, 3), 1.0 + 0.3 * row, 1e-6);
+      TS_ASSERT_EQUALS(table->String(row, 8), "success");
+    }
+
+    // Fitted from the initial guess the last peak is out of reach
+    fitter.setChained(false);
+    table = fitter.fit(ws, {14});
+    TS_ASSERT(!(std::abs(table->Double(0, 3) - 5.2) < 1e-3));
+  }
+
+  void test_rethrow_errors() {
+    auto ws = createLines(3);
+    ws->mutableY(1)[5] = std::nan("");
+    BatchFitter fitter(createLinearBackground());
+    fitter.setRethrowErrors(true);
+    TS_ASSERT_THROWS(fitter.fit(ws, {0, 1, 2}), std::runtime_error);
+    fitter.setChained(true);
+    TS_ASSERT_THROWS(fitter.fit(ws, {0, 1, 2}), std::runtime_error);
+    TS_ASSERT_THROWS_NOTHING(fitter.fit(ws, {0, 2}));
+  }
+
+  void test_minimizer_and_cost_function() {
+    auto ws = createLines(2);
+    BatchFitter fitter(createLinearBackground());
+    TS_ASSERT_THROWS_ANYTHING(fitter.setMinimizer("NoSuchMinimizer"));
+    TS_ASSERT_THROWS_ANYTHING(fitter.setCostFunction("NoSuchCostFunction"));
+    fitter.setMinimizer("Levenberg-Marquardt,AbsError=1e-10");
+    fitter.setCostFunction("Unweighted least squares");
+
+    auto table = fitter.fit(ws, {0, 1});
+    TS_ASSERT_DELTA(table->Double(1, 1), 1.0, 1e-6);
+    TS_ASSERT_DELTA(table->Double(1, 3), 2.0, 1e-6);
+    TS_ASSERT_EQUALS(table->String(1, 6), "success");
+  }
+
+  void test_progress_is_reported_and_cancels_the_fits() {
+    auto ws = createLines(4);
+    BatchFitter fitter(createLinearBackground());
+    for (const bool chained : {false, true}) {
+      fitter.setChained(chained);
+      CountingProgress progress(4, 100);
+      fitter.setProgress(&progress);
+      TS_ASSERT_THROWS_NOTHING(fitter.fit(ws, {0, 1, 2, 3}));
+      TS_ASSERT_EQUALS(progress.reports.load(), 4);
+
+      CountingProgress cancelling(4, 1);
+      fitter.setProgress(&cancelling);
+      TS_ASSERT_THROWS(fitter.fit(ws, {0, 1, 2, 3}),
+                       Algorithm::CancelException);
+    }
+  }
+
+  void test_bad_workspace_index_throws() {
+    auto ws = createLines(2);
+    BatchFitter fitter(createLinearBackground());
+    TS_ASSERT_THROWS(fitter.fit(ws, {2}), std::out_of_range);
+  }
+
+private:
+  void checkMatchesFit(const MatrixWorkspace_sptr &ws, const double startX,
+                       const double endX) {
+    auto fitFunction = createLinearBackground();
+    Mantid::CurveFitting::Algorithms::Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fitFunction);
+    fit.setProperty("InputWorkspace", ws);
+    fit.setProperty("WorkspaceIndex", 0);
+    fit.setProperty("StartX", startX);
+    fit.setProperty("EndX", endX);
+    fit.execute();
+    TS_ASSERT(fit.isExecuted());
+    const double chiSquared = fit.getProperty("OutputChi2overDoF");
+
+    BatchFitter fitter(createLinearBackground());
+    fitter.setFittingRange(startX, endX);
+    auto table = fitter.fit(ws, {0});
+    TS_ASSERT_EQUALS(table->String(0, 6), "success");
+    TS_ASSERT_DELTA(table->Double(0, 1), fitFunction->getParameter("A0"),
+                    1e-5);
+    TS_ASSERT_DELTA(table->Double(0, 3), fitFunction->getParameter("A1"),
+                    1e-5);
+    TS_ASSERT_DELTA(table->Double(0, 5), chiSquared, 1e-5);
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_BATCHFITTERTEST_H_ */
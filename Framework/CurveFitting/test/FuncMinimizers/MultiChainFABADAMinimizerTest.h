@@ -0,0 +1,160 @@
+#ifndef MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZERTEST_H_
+#define MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/FuncMinimizers/MultiChainFABADAMinimizer.h"
+
+#include "MantidCurveFitting/Algorithms/Fit.h"
+#include "MantidCurveFitting/Functions/ExpDecay.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <cmath>
+
+using Mantid::CurveFitting::FuncMinimisers::MultiChainFABADAMinimizer;
+using namespace Mantid::API;
+using namespace Mantid::CurveFitting::Algorithms;
+using namespace Mantid::CurveFitting::Functions;
+
+class MultiChainFABADAMinimizerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MultiChainFABADAMinimizerTest *createSuite() {
+    return new MultiChainFABADAMinimizerTest();
+  }
+  static void destroySuite(MultiChainFABADAMinimizerTest *suite) {
+    delete suite;
+  }
+
+  void test_expDecay() {
+    auto ws2 = createExpDecayWorkspace();
+
+    Mantid::API::IFunction_sptr fun(new ExpDecay);
+    fun->setParameter("Height", 8.);
+    fun->setParameter("Lifetime", 1.0);
+
+    Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("WorkspaceIndex", 0);
+    fit.setProperty("CreateOutput", true);
+    fit.setProperty("MaxIterations", 100000);
+    fit.setProperty("Minimizer",
+                    "MultiChainFABADA,NumberOfChains=4,NumberOfTemperatures=3,"
+                    "ChainLength=8000,StepsBetweenValues=10,Chains=Chain,"
+                    "Parameters=Parameters");
+
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+    TS_ASSERT_EQUALS(fit.getPropertyValue("OutputStatus"), "success");
+
+    TS_ASSERT_DELTA(fun->getParameter("Height"), 10.0, 0.1);
+    TS_ASSERT_DELTA(fun->getParameter("Lifetime"), 0.5, 0.02);
+
+    size_t nParams = fun->nParams();
+
+    // Test Chain workspace: 4 chains of 2000 sweeps, one point in 10 kept
+    MatrixWorkspace_sptr chain = fit.getProperty("Chains");
+    TS_ASSERT(chain);
+    TS_ASSERT_EQUALS(chain->getNumberHistograms(), nParams + 1);
+    TS_ASSERT_EQUALS(chain->x(0).size(), 800);
+    TS_ASSERT_EQUALS(chain->x(0)[437], 437);
+
+    // Parameters workspace
+    ITableWorkspace_sptr param = fit.getProperty("Parameters");
+    TS_ASSERT(param);
+    TS_ASSERT_EQUALS(param->columnCount(), 5);
+    TS_ASSERT_EQUALS(param->rowCount(), nParams);
+    TS_ASSERT_EQUALS(param->getColumn(0)->name(), "Name");
+    TS_ASSERT_EQUALS(param->getColumn(1)->name(), "Value");
+    TS_ASSERT_EQUALS(param->getColumn(2)->name(), "Left's error");
+    TS_ASSERT_EQUALS(param->getColumn(3)->name(), "Right's error");
+    TS_ASSERT_EQUALS(param->getColumn(4)->name(), "R-hat");
+    TS_ASSERT_EQUALS(param->String(0, 0), "Height");
+    TS_ASSERT_EQUALS(param->Double(0, 1), fun->getParameter("Height"));
+    TS_ASSERT_EQUALS(param->Double(1, 1), fun->getParameter("Lifetime"));
+    for (size_t i = 0; i < nParams; ++i) {
+      TS_ASSERT_LESS_THAN(0.0, param->Double(i, 2));
+      TS_ASSERT_LESS_THAN(0.0, param->Double(i, 3));
+      TS_ASSERT_DELTA(param->Double(i, 4), 1.0, 0.1);
+    }
+  }
+
+  void test_low_MaxIterations() {
+    auto ws2 = createExpDecayWorkspace();
+
+    Mantid::API::IFunction_sptr fun(new ExpDecay);
+
+    Fit fit;
+    fit.initialize();
+    fit.setRethrows(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("MaxIterations", 10);
+    fit.setProperty("Minimizer", "MultiChainFABADA,ChainLength=5000");
+
+    TS_ASSERT_THROWS(fit.execute(), std::length_error);
+    TS_ASSERT(!fit.isExecuted());
+  }
+
+  void test_parameter_bounded_to_a_single_value() {
+    auto ws2 = createExpDecayWorkspace();
+
+    Mantid::API::IFunction_sptr fun(new ExpDecay);
+    fun->setParameter("Height", 10.);
+    fun->setParameter("Lifetime", 1.0);
+    fun->addConstraints("10 < Height < 10");
+
+    Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("MaxIterations", 100000);
+    fit.setProperty("Minimizer", "MultiChainFABADA,NumberOfChains=2,"
+                                 "NumberOfTemperatures=2,ChainLength=2000");
+
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+    TS_ASSERT_EQUALS(fun->getParameter("Height"), 10.0);
+    TS_ASSERT_DELTA(fun->getParameter("Lifetime"), 0.5, 0.02);
+  }
+
+  void test_gelmanRubin() {
+    // Sequences sampling the same values
+    std::vector<std::vector<double>> same{{1.0, 2.0, 3.0, 4.0},
+                                          {4.0, 3.0, 2.0, 1.0}};
+    TS_ASSERT_DELTA(MultiChainFABADAMinimizer::gelmanRubin(same),
+                    std::sqrt(0.75), 1e-12);
+    // Sequences far apart
+    std::vector<std::vector<double>> apart{{1.0, 2.0, 1.0, 2.0},
+                                           {11.0, 12.0, 11.0, 12.0}};
+    TS_ASSERT_LESS_THAN(5.0, MultiChainFABADAMinimizer::gelmanRubin(apart));
+    // A parameter that did not move
+    std::vector<std::vector<double>> fixed{{1.0, 1.0}, {1.0, 1.0}};
+    TS_ASSERT_EQUALS(MultiChainFABADAMinimizer::gelmanRubin(fixed), 1.0);
+    // Too short
+    std::vector<std::vector<double>> shortSequences{{1.0}, {2.0}};
+    TS_ASSERT(
+        std::isnan(MultiChainFABADAMinimizer::gelmanRubin(shortSequences)));
+  }
+
+private:
+  MatrixWorkspace_sptr createExpDecayWorkspace() {
+    MatrixWorkspace_sptr ws2(new WorkspaceTester);
+    ws2->initialize(1, 20, 20);
+
+    auto &x = ws2->mutableX(0);
+    auto &y = ws2->mutableY(0);
+    for (size_t i = 0; i < ws2->blocksize(); ++i) {
+      x[i] = 0.1 * double(i);
+      y[i] = 10.0 * exp(-(x[i]) / 0.5);
+    }
+    return ws2;
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_MULTICHAINFABADAMINIMIZERTEST_H_ */
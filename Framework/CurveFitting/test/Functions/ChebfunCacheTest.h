@@ -0,0 +1,89 @@
+#ifndef MANTID_CURVEFITTING_CHEBFUNCACHETEST_H_
+#define MANTID_CURVEFITTING_CHEBFUNCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/Functions/ChebfunCache.h"
+
+#include <cmath>
+
+using namespace Mantid::CurveFitting::Functions;
+
+class ChebfunCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ChebfunCacheTest *createSuite() { return new ChebfunCacheTest(); }
+  static void destroySuite(ChebfunCacheTest *suite) { delete suite; }
+
+  void test_approximate() {
+    auto fun = [](double x) { return std::exp(-x * x / 2) * std::sin(3 * x); };
+    auto cheb = ChebfunCache::approximate(fun, 0.0, 10.0, 1e-12);
+    TS_ASSERT(cheb);
+    for (double x = 0.0; x < 10.0; x += 0.17) {
+      TS_ASSERT_DELTA((*cheb)(x), fun(x), 1e-12);
+    }
+  }
+
+  void test_approximate_fails_if_too_many_points_are_needed() {
+    auto fun = [](double x) { return std::sin(1000 * x); };
+    TS_ASSERT(!ChebfunCache::approximate(fun, 0.0, 10.0, 1e-12));
+    TS_ASSERT(ChebfunCache::approximate(fun, 0.0, 0.01, 1e-12));
+  }
+
+  void test_get_builds_approximations_once() {
+    size_t nBuilt = 0;
+    ChebfunCache cache(
+        [&nBuilt](const std::vector<double> &key) {
+          ++nBuilt;
+          const double a = key.front();
+          return ChebfunCache::approximate(
+              [a](double x) { return std::cos(a * x); }, 0.0, 1.0, 1e-14);
+        },
+        2);
+    auto cheb1 = cache.get({1.0});
+    auto cheb2 = cache.get({2.0});
+    TS_ASSERT_EQUALS(nBuilt, 2);
+    TS_ASSERT_EQUALS(cache.get({1.0}), cheb1);
+    TS_ASSERT_EQUALS(cache.get({2.0}), cheb2);
+    TS_ASSERT_EQUALS(nBuilt, 2);
+    TS_ASSERT_DELTA((*cheb2)(0.5), std::cos(1.0), 1e-14);
+
+    // The least recently used approximation is replaced
+    cache.get({1.0});
+    cache.get({3.0});
+    TS_ASSERT_EQUALS(nBuilt, 3);
+    TS_ASSERT_EQUALS(cache.size(), 2);
+    TS_ASSERT_EQUALS(cache.get({1.0}), cheb1);
+    TS_ASSERT_EQUALS(nBuilt, 3);
+    TS_ASSERT_DIFFERS(cache.get({2.0}), cheb2);
+    TS_ASSERT_EQUALS(nBuilt, 4);
+
+    cache.clear();
+    TS_ASSERT_EQUALS(cache.size(), 0);
+  }
+
+  void test_failed_approximations_are_cached() {
+    size_t nBuilt = 0;
+    ChebfunCache cache([&nBuilt](const std::vector<double> &) {
+      ++nBuilt;
+      return ChebfunCache::Approximation();
+    });
+    TS_ASSERT(!cache.get({1.0, 2.0}));
+    TS_ASSERT(!cache.get({1.0, 2.0}));
+    TS_ASSERT_EQUALS(nBuilt, 1);
+  }
+
+  void test_constructor_throws() {
+    TS_ASSERT_THROWS(ChebfunCache(ChebfunCache::Builder()),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(ChebfunCache(
+                         [](const std::vector<double> &) {
+                           return ChebfunCache::Approximation();
+                         },
+                         0),
+                     std::invalid_argument);
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_CHEBFUNCACHETEST_H_ */
@@ -350,6 +350,82 @@ public:
     }
   }
 
+  void testResolutionIsRecalculatedWhenItsParametersChange() {
+    Convolution conv;
+    const double pi = acos(0.) * 2;
+    auto res = boost::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.0);
+    res->setParameter("h", 3.0);
+    res->setParameter("s", pi / 2);
+    conv.addFunction(res);
+
+    const int N = 116;
+    double x[N], dx = 0.13;
+    for (int i = 0; i < N; i++) {
+      x[i] = i * dx;
+    }
+    const double c2 = dx * N / 2;
+    const double h2 = 10.;
+    const double s2 = pi / 3;
+    auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("c", c2);
+    fun->setParameter("h", h2);
+    fun->setParameter("s", s2);
+    conv.addFunction(fun);
+
+    FunctionDomain1DView xView(&x[0], N);
+    FunctionValues out(xView);
+    conv.function(xView, out);
+    // A fixed resolution is only calculated once, but a change of its
+    // parameters must still be seen
+    for (double s1 : {pi / 2, pi, pi / 4}) {
+      conv.getFunction(0)->setParameter("s", s1);
+      conv.function(xView, out);
+      const double sp = s1 * s2 / (s1 + s2);
+      const double hp = 3.0 * h2 * sqrt(pi / (s1 + s2));
+      for (int i = 0; i < N; i++) {
+        const double xi = x[i] - c2;
+        TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-10);
+      }
+    }
+  }
+
+  void testResolutionIsRecalculatedWhenTheDomainOrItsAttributesChange() {
+    // Both domains have the same size and ends, and are asymmetric enough for
+    // the direct mode, where the resolution is evaluated at every x value
+    const size_t N = 101;
+    std::vector<double> uniform(N), nonUniform(N);
+    const double dx = 15.0 / static_cast<double>(N - 1);
+    for (size_t i = 0; i < N; ++i) {
+      uniform[i] = -3.0 + static_cast<double>(i) * dx;
+      nonUniform[i] = uniform[i] + 0.4 * dx * sin(static_cast<double>(i));
+    }
+    nonUniform.back() = uniform.back();
+    const std::string broad = "h*exp(-s*x^2)";
+    const std::string narrow = "h*exp(-4*s*x^2)";
+
+    auto conv = createConvolutionWithUserResolution(broad);
+    std::vector<double> values = calculate(*conv, uniform);
+    TS_ASSERT_EQUALS(values,
+                     calculate(*createConvolutionWithUserResolution(broad),
+                               uniform));
+
+    values = calculate(*conv, nonUniform);
+    TS_ASSERT_EQUALS(values,
+                     calculate(*createConvolutionWithUserResolution(broad),
+                               nonUniform));
+
+    // Same domain and parameter values, different resolution attribute
+    auto resolution = conv->getFunction(0);
+    resolution->setAttributeValue("Formula", narrow);
+    resolution->setParameter("h", 2.0);
+    resolution->setParameter("s", 0.5);
+    values = calculate(*conv, nonUniform);
+    TS_ASSERT_EQUALS(values,
+                     calculate(*createConvolutionWithUserResolution(narrow),
+                               nonUniform));
+  }
+
   /*
    * Convolve a Gausian (resolution) with a Delta-Dirac
    */
@@ -400,6 +476,36 @@ public:
     TS_ASSERT(categories.size() == 1);
     TS_ASSERT(categories[0] == "General");
   }
+private:
+  /// Convolution of a Gaussian with a UserFunction resolution with the given
+  /// formula in h and s
+  boost::shared_ptr<Convolution>
+  createConvolutionWithUserResolution(const std::string &formula) {
+    auto conv = boost::make_shared<Convolution>();
+    auto res = FunctionFactory::Instance().createFunction("UserFunction");
+    res->setAttributeValue("Formula", formula);
+    res->setParameter("h", 2.0);
+    res->setParameter("s", 0.5);
+    conv->addFunction(res);
+    auto fun = boost::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("c", 4.0);
+    fun->setParameter("h", 10.0);
+    fun->setParameter("s", 1.5);
+    conv->addFunction(fun);
+    return conv;
+  }
+
+  std::vector<double> calculate(const Convolution &conv,
+                                const std::vector<double> &x) {
+    FunctionDomain1DVector domain(x);
+    FunctionValues values(domain);
+    conv.function(domain, values);
+    std::vector<double> out(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      out[i] = values.getCalculated(i);
+    }
+    return out;
+  }
 };
 
 #endif /*CONVOLUTIONTEST_H_*/
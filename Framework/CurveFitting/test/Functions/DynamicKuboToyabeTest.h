@@ -101,6 +101,27 @@ public:
     TS_ASSERT_DELTA(y[4], 0.055052, 0.000001);
   }
 
+  void testZNDKTFunctionLargeDelta() {
+    // The field integral must be accurate for large values of Delta * t
+    DynamicKuboToyabe dkt;
+    dkt.initialize();
+    dkt.setParameter("Asym", 1.0);
+    dkt.setParameter("Delta", 3.0);
+    dkt.setParameter("Field", 10.0);
+    dkt.setParameter("Nu", 0.0);
+
+    Mantid::API::FunctionDomain1DVector x(0, 5, 5);
+    Mantid::API::FunctionValues y(x);
+
+    TS_ASSERT_THROWS_NOTHING(dkt.function(x, y));
+
+    TS_ASSERT_DELTA(y[0], 1.000000, 0.000001);
+    TS_ASSERT_DELTA(y[1], 0.337087, 0.000001);
+    TS_ASSERT_DELTA(y[2], 0.343954, 0.000001);
+    TS_ASSERT_DELTA(y[3], 0.343954, 0.000001);
+    TS_ASSERT_DELTA(y[4], 0.343954, 0.000001);
+  }
+
   void testDKTFunction() {
     // Test Dynamic Kubo Toyabe (DKT) (non-zero Field, non-zero Nu)
     const double asym = 1.0;
@@ -91,6 +91,35 @@ public:
     TS_ASSERT_DELTA(fn->intensity(), 0.26611675485780654483, 1e-10);
   }
 
+  void test_values_within_peak_radius() {
+    Gaussian fn;
+    fn.initialize();
+    fn.setHeight(2.0);
+    fn.setCentre(1.0);
+    fn.setFwhm(0.5);
+
+    // The peak is calculated for |x - 1| < 1 only
+    std::vector<double> ascending;
+    for (double x = -3.0; x < 5.0; x += 0.1) {
+      ascending.push_back(x);
+    }
+    std::vector<double> descending(ascending.rbegin(), ascending.rend());
+    const double sigma = 0.5 / (2.0 * sqrt(2.0 * M_LN2));
+    for (const auto &x : {ascending, descending}) {
+      FunctionDomain1DVector domain(x);
+      domain.setPeakRadius(2);
+      FunctionValues values(domain);
+      fn.function(domain, values);
+      for (size_t i = 0; i < x.size(); ++i) {
+        const double diff = x[i] - 1.0;
+        const double expected =
+            fabs(diff) < 1.0 ? 2.0 * exp(-0.5 * diff * diff / sigma / sigma)
+                             : 0.0;
+        TS_ASSERT_DELTA(values.getCalculated(i), expected, 1e-14);
+      }
+    }
+  }
+
   void testSetIntensity() {
     boost::shared_ptr<Gaussian> fn = boost::make_shared<Gaussian>();
     fn->initialize();
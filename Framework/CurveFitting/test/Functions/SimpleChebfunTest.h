@@ -131,6 +131,14 @@ public:
     do_test_values(cheb_cos, Cos, 1e-13, 1e-13);
   }
 
+  void test_integral() {
+    SimpleChebfun cheb_cos(Cos, 0.0, 3.0);
+    auto cheb_sin = cheb_cos.integral();
+    const double sin0 = cheb_sin(0.0);
+    do_test_values(cheb_sin, [sin0](double x) { return sin(x) + sin0; },
+                   1e-13, 1e-13);
+  }
+
   void test_roughRoots() {
     SimpleChebfun cheb(Sin, -2 * M_PI - 0.1, 2 * M_PI + 0.1);
     auto roots = cheb.roughRoots();
@@ -4,6 +4,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidCurveFitting/Functions/StretchExpMuon.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 using namespace Mantid::CurveFitting::Functions;
 
@@ -40,6 +41,31 @@ public:
     TS_ASSERT_DELTA(y[8], 0.1214, 1e-4);
     TS_ASSERT_DELTA(y[9], 0.1068, 1e-4);
   }
+
+  void test_derivatives() {
+    StretchExpMuon fn;
+    fn.initialize();
+    fn.setParameter("A", 1.50);
+    fn.setParameter("Lambda", 2.5);
+    fn.setParameter("Beta", 0.50);
+
+    Mantid::API::FunctionDomain1DVector x(0, 2, 10);
+    Mantid::CurveFitting::Jacobian jacobian(x.size(), 3);
+    TS_ASSERT_THROWS_NOTHING(fn.functionDeriv(x, jacobian));
+    // The limits at x = 0
+    TS_ASSERT_EQUALS(jacobian.get(0, 0), 1.0);
+    TS_ASSERT_EQUALS(jacobian.get(0, 1), 0.0);
+    TS_ASSERT_EQUALS(jacobian.get(0, 2), 0.0);
+    for (size_t i = 1; i < x.size(); ++i) {
+      const double gx = 2.5 * x[i];
+      const double e = exp(-sqrt(gx));
+      TS_ASSERT_DELTA(jacobian.get(i, 0), e, 1e-12);
+      TS_ASSERT_DELTA(jacobian.get(i, 1), -1.5 * e * 0.5 / sqrt(gx) * x[i],
+                      1e-12);
+      TS_ASSERT_DELTA(jacobian.get(i, 2), -1.5 * e * sqrt(gx) * log(gx),
+                      1e-12);
+    }
+  }
 };
 
 #endif /*STRETCHEXPTEST_H_*/
@@ -78,6 +78,85 @@ public:
     TS_ASSERT(categories.size() == 1);
     TS_ASSERT(categories[0] == "General");
   }
+
+  void test_derivatives_are_exact() {
+    UserFunction fun;
+    fun.setAttribute("Formula",
+                     UserFunction::Attribute("a*exp(-b*x)+c/(1+x^2)"));
+    fun.setParameter("a", 2.2);
+    fun.setParameter("b", 0.5);
+    fun.setParameter("c", 1.2);
+
+    const size_t nData = 10;
+    FunctionDomain1DVector domain(0.0, 3.0, nData);
+    UserTestJacobian J(nData, 3);
+    fun.functionDeriv(domain, J);
+    for (size_t i = 0; i < nData; i++) {
+      const double x = domain[i];
+      TS_ASSERT_DELTA(J.get(i, 0), exp(-0.5 * x), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 1), -2.2 * x * exp(-0.5 * x), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 2), 1.0 / (1.0 + x * x), 1e-12);
+    }
+  }
+
+  void test_derivatives_of_squares() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("h*(x-c)^2+b^2"));
+    fun.setParameter("h", 1.5);
+    fun.setParameter("c", 0.3);
+    fun.setParameter("b", 0.7);
+
+    const size_t nData = 10;
+    FunctionDomain1DVector domain(0.0, 3.0, nData);
+    UserTestJacobian J(nData, 3);
+    fun.functionDeriv(domain, J);
+    const size_t h = fun.parameterIndex("h");
+    const size_t c = fun.parameterIndex("c");
+    const size_t b = fun.parameterIndex("b");
+    for (size_t i = 0; i < nData; i++) {
+      const double x = domain[i];
+      TS_ASSERT_DELTA(J.get(i, h), (x - 0.3) * (x - 0.3), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, c), -2.0 * 1.5 * (x - 0.3), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, b), 2.0 * 0.7, 1e-12);
+    }
+  }
+
+  void test_formula_that_cannot_be_differentiated() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*x*(x>b)"));
+    fun.setParameter("a", 2.0);
+    fun.setParameter("b", 0.5);
+
+    const size_t nData = 4;
+    std::vector<double> x{0.0, 1.0, 2.0, 3.0};
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(nData, 2);
+    fun.functionDeriv(domain, J);
+    for (size_t i = 0; i < nData; i++) {
+      TS_ASSERT_DELTA(J.get(i, 0), x[i] > 0.5 ? x[i] : 0.0, 1e-6);
+    }
+  }
+
+  void test_values_follow_the_parameters() {
+    UserFunction fun;
+    fun.setAttribute("Formula",
+                     UserFunction::Attribute("a*x^2+b*sqrt(x)-log10(x+1)"));
+    const size_t nData = 500;
+    std::vector<double> x(nData), y(nData);
+    for (size_t i = 0; i < nData; i++) {
+      x[i] = 0.01 * static_cast<double>(i);
+    }
+    for (double a : {1.0, -2.5}) {
+      fun.setParameter("a", a);
+      fun.setParameter("b", 2.0 * a);
+      fun.function1D(&y[0], &x[0], nData);
+      for (size_t i = 0; i < nData; i++) {
+        TS_ASSERT_DELTA(y[i], a * x[i] * x[i] + 2.0 * a * sqrt(x[i]) -
+                                  log10(x[i] + 1.0),
+                        1e-12);
+      }
+    }
+  }
 };
 
 #endif /*USERFUNCTIONTEST_H_*/
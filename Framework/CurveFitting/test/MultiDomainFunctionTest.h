@@ -8,6 +8,7 @@
 #include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
 #include "MantidCurveFitting/FuncMinimizers/LevenbergMarquardtMDMinimizer.h"
 #include "MantidCurveFitting/Algorithms/Fit.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 #include "MantidTestHelpers/FakeObjects.h"
 #include "MantidTestHelpers/MultiDomainFunctionHelper.h"
@@ -65,6 +66,55 @@ public:
     TS_ASSERT_THROWS_NOTHING(
         multi = Mantid::TestHelpers::makeMultiDomainFunction3());
   }
+
+  void test_least_squares_derivatives_are_calculated_per_domain() {
+    auto domain = Mantid::TestHelpers::makeMultiDomainDomain3();
+    auto values = boost::make_shared<FunctionValues>(*domain);
+    for (size_t i = 0; i < values->size(); ++i) {
+      values->setFitData(i, 0.1 * double(i * i));
+      values->setFitWeight(i, 1.0 + 0.01 * double(i));
+    }
+    auto multi = Mantid::TestHelpers::makeMultiDomainFunction3();
+    multi->getFunction(0)->setParameter("A", 1.5);
+    multi->getFunction(1)->setParameter("B", -0.5);
+    multi->getFunction(2)->setParameter("A", 2.0);
+    multi->fix(3);
+
+    auto costFun = boost::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    const size_t np = costFun->nParams();
+    TS_ASSERT_EQUALS(np, 5);
+    costFun->valDerivHessian();
+    const auto &der = costFun->getDeriv();
+    const auto &hessian = costFun->getHessian();
+
+    // The same quantities from the Jacobian of the whole function
+    Mantid::CurveFitting::Jacobian jacobian(values->size(), multi->nParams());
+    multi->functionDeriv(*domain, jacobian);
+    for (size_t ip = 0, i1 = 0; ip < multi->nParams(); ++ip) {
+      if (!multi->isActive(ip))
+        continue;
+      double d = 0.0;
+      for (size_t k = 0; k < values->size(); ++k) {
+        const double w = values->getFitWeight(k);
+        d += (values->getCalculated(k) - values->getFitData(k)) * w * w *
+             jacobian.get(k, ip);
+      }
+      TS_ASSERT_DELTA(der.get(i1), d, 1e-10);
+      for (size_t jp = 0, i2 = 0; jp < multi->nParams(); ++jp) {
+        if (!multi->isActive(jp))
+          continue;
+        double h = 0.0;
+        for (size_t k = 0; k < values->size(); ++k) {
+          const double w = values->getFitWeight(k);
+          h += jacobian.get(k, ip) * jacobian.get(k, jp) * w * w;
+        }
+        TS_ASSERT_DELTA(hessian.get(i1, i2), h, 1e-10);
+        ++i2;
+      }
+      ++i1;
+    }
+  }
 };
 
 #endif /*MULTIDOMAINFUNCTIONTEST_H_*/
@@ -0,0 +1,97 @@
+#ifndef MANTID_CURVEFITTING_PARAMETERBLOCKSTEST_H_
+#define MANTID_CURVEFITTING_PARAMETERBLOCKSTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/ParameterBlocks.h"
+
+#include "MantidAPI/MultiDomainFunction.h"
+#include "MantidTestHelpers/MultiDomainFunctionHelper.h"
+
+#include <boost/make_shared.hpp>
+
+using namespace Mantid::API;
+using namespace Mantid::CurveFitting;
+using Mantid::TestHelpers::MultiDomainFunctionTest_Function;
+
+class ParameterBlocksTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ParameterBlocksTest *createSuite() { return new ParameterBlocksTest(); }
+  static void destroySuite(ParameterBlocksTest *suite) { delete suite; }
+
+  void test_partition_of_a_multi_domain_function() {
+    MultiDomainFunction multi;
+    for (size_t i = 0; i < 4; ++i) {
+      multi.addFunction(boost::make_shared<MultiDomainFunctionTest_Function>());
+    }
+    // Function 0 is applied to all the domains, the others to one each
+    multi.setDomainIndex(1, 0);
+    multi.setDomainIndex(2, 1);
+    multi.setDomainIndex(3, 2);
+    multi.fix(1);
+
+    ParameterBlocks blocks(multi);
+    TS_ASSERT_EQUALS(blocks.globals(), std::vector<size_t>({0}));
+    TS_ASSERT_EQUALS(blocks.nBlocks(), 3);
+    TS_ASSERT_EQUALS(blocks.block(0), std::vector<size_t>({1, 2}));
+    TS_ASSERT_EQUALS(blocks.block(1), std::vector<size_t>({3, 4}));
+    TS_ASSERT_EQUALS(blocks.block(2), std::vector<size_t>({5, 6}));
+  }
+
+  void test_other_functions_have_only_global_parameters() {
+    MultiDomainFunctionTest_Function function;
+    ParameterBlocks blocks(function);
+    TS_ASSERT_EQUALS(blocks.nBlocks(), 0);
+    TS_ASSERT_EQUALS(blocks.globals().size(), 2);
+    TS_ASSERT(!blocks.isBlockStructured(GSLMatrix(2, 2)));
+  }
+
+  void test_solve() {
+    MultiDomainFunction multi;
+    for (size_t i = 0; i < 3; ++i) {
+      multi.addFunction(boost::make_shared<MultiDomainFunctionTest_Function>());
+    }
+    multi.setDomainIndex(1, 0);
+    multi.setDomainIndex(2, 1);
+    ParameterBlocks blocks(multi);
+
+    // Globals 0 and 1, blocks {2, 3} and {4, 5}
+    GSLMatrix matrix({{9.0, 1.0, 1.0, 0.5, 2.0, 0.1},
+                      {1.0, 8.0, 0.3, 1.0, 0.2, 1.5},
+                      {1.0, 0.3, 5.0, 1.0, 0.0, 0.0},
+                      {0.5, 1.0, 1.0, 4.0, 0.0, 0.0},
+                      {2.0, 0.2, 0.0, 0.0, 6.0, 2.0},
+                      {0.1, 1.5, 0.0, 0.0, 2.0, 7.0}});
+    GSLVector rhs({1.0, -2.0, 3.0, 0.5, -1.0, 2.5});
+    TS_ASSERT(blocks.isBlockStructured(matrix));
+
+    GSLVector x;
+    blocks.solve(matrix, rhs, x);
+    GSLVector expected;
+    GSLMatrix copy(matrix);
+    copy.solve(rhs, expected);
+    TS_ASSERT_EQUALS(x.size(), 6);
+    for (size_t i = 0; i < 6; ++i) {
+      TS_ASSERT_DELTA(x.get(i), expected.get(i), 1e-12);
+    }
+
+    // Coupling the blocks breaks the structure
+    matrix.set(2, 5, 0.1);
+    TS_ASSERT(!blocks.isBlockStructured(matrix));
+  }
+
+  void test_singular_block_throws() {
+    MultiDomainFunction multi;
+    multi.addFunction(boost::make_shared<MultiDomainFunctionTest_Function>());
+    multi.setDomainIndex(0, 0);
+    ParameterBlocks blocks(multi);
+    GSLMatrix matrix({{1.0, 2.0}, {2.0, 4.0}});
+    GSLVector rhs({1.0, 1.0});
+    GSLVector x;
+    TS_ASSERT_THROWS(blocks.solve(matrix, rhs, x), std::runtime_error);
+  }
+};
+
+#endif /* MANTID_CURVEFITTING_PARAMETERBLOCKSTEST_H_ */
@@ -0,0 +1,64 @@
+#ifndef MANTID_DATAHANDLING_LOADWORKSPACESNAPSHOT_H_
+#define MANTID_DATAHANDLING_LOADWORKSPACESNAPSHOT_H_
+
+#include "MantidAPI/IFileLoader.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+namespace Mantid {
+namespace DataHandling {
+
+/** LoadWorkspaceSnapshot : Loads a file written by SaveWorkspaceSnapshot. The
+  file is memory mapped so the data pages are only read from disk as they are
+  copied into the workspace, without any intermediate buffering or parsing.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport LoadWorkspaceSnapshot
+    : public API::IFileLoader<Kernel::FileDescriptor> {
+public:
+  const std::string name() const override { return "LoadWorkspaceSnapshot"; }
+  /// Summary of algorithms purpose
+  const std::string summary() const override {
+    return "Loads a workspace from a file written by SaveWorkspaceSnapshot.";
+  }
+
+  /// Algorithm's version
+  int version() const override { return (1); }
+  /// Algorithm's category for identification
+  const std::string category() const override { return "DataHandling"; }
+  /// Returns a confidence value that this algorithm can load a file
+  int confidence(Kernel::FileDescriptor &descriptor) const override;
+
+private:
+  /// Initialisation code
+  void init() override;
+  /// Execution code
+  void exec() override;
+  /// Attach the instrument the snapshot refers to
+  bool loadInstrument(const API::MatrixWorkspace_sptr &ws,
+                      const std::string &name, const std::string &xml);
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_LOADWORKSPACESNAPSHOT_H_ */
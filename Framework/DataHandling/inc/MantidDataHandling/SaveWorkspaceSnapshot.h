@@ -0,0 +1,66 @@
+#ifndef MANTID_DATAHANDLING_SAVEWORKSPACESNAPSHOT_H_
+#define MANTID_DATAHANDLING_SAVEWORKSPACESNAPSHOT_H_
+
+#include "MantidAPI/Algorithm.h"
+
+namespace Mantid {
+namespace DataHandling {
+
+/** SaveWorkspaceSnapshot : Writes a histogram workspace to a binary snapshot
+  file that LoadWorkspaceSnapshot can map straight back into memory. The
+  data arrays are written as large contiguous blocks and the metadata (units,
+  instrument, logs and history) as a small JSON document, so saving and
+  loading are limited by the disk rather than by formatting the data.
+
+  Snapshots are intended for checkpointing and for moving workspaces out of
+  memory temporarily. They are not a long-term archive format: they are
+  only readable on machines with the same byte order as the writer.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport SaveWorkspaceSnapshot : public API::Algorithm {
+public:
+  const std::string name() const override { return "SaveWorkspaceSnapshot"; }
+  /// Summary of algorithms purpose
+  const std::string summary() const override {
+    return "Writes a histogram workspace to a binary snapshot file for fast "
+           "checkpointing.";
+  }
+
+  /// Algorithm's version
+  int version() const override { return (1); }
+  /// Algorithm's category for identification
+  const std::string category() const override { return "DataHandling"; }
+
+private:
+  /// Initialisation code
+  void init() override;
+  /// Execution code
+  void exec() override;
+  /// Check that the workspace type can be written
+  std::map<std::string, std::string> validateInputs() override;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_SAVEWORKSPACESNAPSHOT_H_ */
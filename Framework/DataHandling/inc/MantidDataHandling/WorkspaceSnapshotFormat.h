@@ -0,0 +1,71 @@
+#ifndef MANTID_DATAHANDLING_WORKSPACESNAPSHOTFORMAT_H_
+#define MANTID_DATAHANDLING_WORKSPACESNAPSHOTFORMAT_H_
+
+#include <cstdint>
+
+namespace Mantid {
+namespace DataHandling {
+/** WorkspaceSnapshotFormat : The on-disk layout shared by
+  SaveWorkspaceSnapshot and LoadWorkspaceSnapshot.
+
+  A snapshot starts with a fixed-size Header. The bulk data follow as a
+  sequence of binary blocks, each starting on an ALIGNMENT boundary so that
+  they can be used in place once the file is memory mapped. A directory of
+  Block entries locates the blocks and the workspace metadata is stored last
+  as a JSON document that refers to the blocks by their directory index.
+  All numbers are stored in the byte order of the machine that wrote them.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace WorkspaceSnapshotFormat {
+
+/// The first bytes of every snapshot file
+constexpr char MAGIC[8] = {'M', 'T', 'D', 'S', 'N', 'A', 'P', '\0'};
+/// The layout version, incremented whenever the layout changes
+constexpr uint32_t VERSION = 1;
+/// Reads back differently on a machine with another byte order
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+/// Every block starts at a multiple of this many bytes
+constexpr uint64_t ALIGNMENT = 64;
+
+/// The fixed-size header at the start of the file
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint64_t metadataOffset;
+  uint64_t metadataSize;
+  uint64_t directoryOffset;
+  uint64_t blockCount;
+};
+
+/// The position of one binary block in the file
+struct Block {
+  uint64_t offset;
+  uint64_t size;
+};
+
+} // namespace WorkspaceSnapshotFormat
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_WORKSPACESNAPSHOTFORMAT_H_ */
@@ -0,0 +1,420 @@
+#include "MantidDataHandling/LoadWorkspaceSnapshot.h"
+#include "MantidDataHandling/WorkspaceSnapshotFormat.h"
+
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/BinEdgeAxis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/NumericAxis.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/RegisterFileLoader.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/TextAxis.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/MemoryMappedFile.h"
+#include "MantidKernel/OptionalBool.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace Mantid {
+namespace DataHandling {
+
+using namespace Kernel;
+using namespace API;
+using namespace HistogramData;
+using namespace WorkspaceSnapshotFormat;
+using DataObjects::Workspace2D;
+using Types::Core::DateAndTime;
+
+DECLARE_FILELOADER_ALGORITHM(LoadWorkspaceSnapshot)
+
+namespace {
+/// A typed view of a block inside the mapped file
+template <typename T> struct BlockView {
+  const T *data;
+  size_t size;
+  const T *begin() const { return data; }
+  const T *end() const { return data + size; }
+};
+
+/**
+ * Maps a snapshot file into memory, validates its header and directory and
+ * hands out views of the blocks.
+ */
+class SnapshotReader {
+public:
+  explicit SnapshotReader(const std::string &filename) : m_file(filename) {
+    if (m_file.size() < sizeof(Header))
+      throw std::invalid_argument(filename + " is not a workspace snapshot");
+    std::memcpy(&m_header, m_file.data(), sizeof(Header));
+    if (!std::equal(std::begin(MAGIC), std::end(MAGIC), m_header.magic))
+      throw std::invalid_argument(filename + " is not a workspace snapshot");
+    if (m_header.byteOrder != BYTE_ORDER_MARK)
+      throw std::runtime_error(filename + " was written on a machine with a "
+                                          "different byte order");
+    if (m_header.version > VERSION)
+      throw std::runtime_error(filename + " was written by a newer version "
+                                          "of Mantid");
+    checkRange(m_header.directoryOffset,
+               m_header.blockCount * sizeof(Block));
+    checkRange(m_header.metadataOffset, m_header.metadataSize);
+    m_blocks = reinterpret_cast<const Block *>(m_file.data() +
+                                               m_header.directoryOffset);
+    for (uint64_t i = 0; i < m_header.blockCount; ++i)
+      checkRange(m_blocks[i].offset, m_blocks[i].size);
+  }
+
+  /// Parse the JSON metadata at the end of the file
+  Json::Value metadata() const {
+    const char *begin = m_file.data() + m_header.metadataOffset;
+    Json::Value metadata;
+    Json::Reader reader;
+    if (!reader.parse(begin, begin + m_header.metadataSize, metadata))
+      throw std::runtime_error("The snapshot metadata is corrupt: " +
+                               reader.getFormattedErrorMessages());
+    return metadata;
+  }
+
+  /// A view of the block with the given directory index
+  template <typename T> BlockView<T> block(const Json::Value &index) const {
+    if (index.isNull() || !index.isConvertibleTo(Json::uintValue) ||
+        index.asUInt() >= m_header.blockCount)
+      throw std::runtime_error("The snapshot refers to a missing block");
+    const auto &block = m_blocks[index.asUInt()];
+    if (block.size % sizeof(T) != 0)
+      throw std::runtime_error("The snapshot contains a truncated block");
+    // Blocks are aligned in the file and the mapping starts on a page
+    return {reinterpret_cast<const T *>(m_file.data() + block.offset),
+            static_cast<size_t>(block.size / sizeof(T))};
+  }
+
+private:
+  /// Check that a range of bytes lies inside the file
+  void checkRange(uint64_t offset, uint64_t size) const {
+    if (offset > m_file.size() || size > m_file.size() - offset)
+      throw std::runtime_error("The snapshot file is truncated");
+  }
+
+  MemoryMappedFile m_file;
+  Header m_header;
+  const Block *m_blocks = nullptr;
+};
+
+/// Check that a block has the expected number of entries
+template <typename T>
+void checkSize(const BlockView<T> &view, size_t expected) {
+  if (view.size != expected)
+    throw std::runtime_error("The snapshot contains inconsistent data");
+}
+
+/// Build one spectrum from the mapped Y and E values
+template <typename TX>
+Histogram makeHistogram(const cow_ptr<HistogramX> &x, const double *y,
+                        const double *e, size_t n, bool distribution) {
+  if (distribution)
+    return Histogram(TX(x), Frequencies(y, y + n),
+                     FrequencyStandardDeviations(e, e + n));
+  return Histogram(TX(x), Counts(y, y + n), CountStandardDeviations(e, e + n));
+}
+
+/// Restore a numeric time series log from its blocks
+template <typename T, typename Stored>
+std::unique_ptr<Property> loadSeries(const SnapshotReader &reader,
+                                     const Json::Value &log) {
+  const auto times = reader.block<int64_t>(log["times"]);
+  const auto values = reader.block<Stored>(log["values"]);
+  checkSize(values, times.size);
+  auto series = make_unique<TimeSeriesProperty<T>>(log["name"].asString());
+  series->addValues(std::vector<DateAndTime>(times.begin(), times.end()),
+                    std::vector<T>(values.begin(), values.end()));
+  return std::move(series);
+}
+
+/// Restore a sample log, returns nullptr for a log type that is not known
+std::unique_ptr<Property> loadLog(const SnapshotReader &reader,
+                                  const Json::Value &log) {
+  const auto name = log["name"].asString();
+  const auto type = log["type"].asString();
+  std::unique_ptr<Property> property;
+  if (type == "series<double>") {
+    property = loadSeries<double, double>(reader, log);
+  } else if (type == "series<int>") {
+    property = loadSeries<int, int32_t>(reader, log);
+  } else if (type == "series<bool>") {
+    property = loadSeries<bool, uint8_t>(reader, log);
+  } else if (type == "series<string>") {
+    auto series = make_unique<TimeSeriesProperty<std::string>>(name);
+    const auto &times = log["times"];
+    const auto &values = log["values"];
+    for (Json::ArrayIndex i = 0; i < times.size(); ++i)
+      series->addValue(DateAndTime(times[i].asString()), values[i].asString());
+    property = std::move(series);
+  } else if (type == "double") {
+    property =
+        make_unique<PropertyWithValue<double>>(name, log["value"].asDouble());
+  } else if (type == "int") {
+    property = make_unique<PropertyWithValue<int>>(name, log["value"].asInt());
+  } else if (type == "string") {
+    property = make_unique<PropertyWithValue<std::string>>(
+        name, log["value"].asString());
+  } else if (type == "vector<double>") {
+    const auto values = reader.block<double>(log["values"]);
+    property = make_unique<ArrayProperty<double>>(
+        name, std::vector<double>(values.begin(), values.end()));
+  } else {
+    return nullptr;
+  }
+  property->setUnits(log["units"].asString());
+  return property;
+}
+
+/// Rebuild an algorithm history and its children
+AlgorithmHistory_sptr historyFromJson(const Json::Value &json) {
+  auto history = boost::make_shared<AlgorithmHistory>(
+      json["name"].asString(), json["version"].asInt(),
+      DateAndTime(json["date"].asString()), json["duration"].asDouble(),
+      json["count"].asUInt());
+  for (const auto &property : json["properties"])
+    history->addProperty(property["name"].asString(),
+                         property["value"].asString(),
+                         property["default"].asBool(),
+                         property["direction"].asUInt());
+  for (const auto &child : json["children"])
+    history->addChildHistory(historyFromJson(child));
+  return history;
+}
+
+/// Restore the vertical axis if it is not a spectra axis
+void loadVerticalAxis(const SnapshotReader &reader, const Json::Value &json,
+                      MatrixWorkspace &ws) {
+  const auto type = json["type"].asString();
+  std::unique_ptr<Axis> axis;
+  if (type == "numeric" || type == "binedge") {
+    const auto values = reader.block<double>(json["values"]);
+    const std::vector<double> points(values.begin(), values.end());
+    if (type == "numeric")
+      axis = make_unique<NumericAxis>(points);
+    else
+      axis = make_unique<BinEdgeAxis>(points);
+  } else if (type == "text") {
+    const auto &labels = json["labels"];
+    auto textAxis = make_unique<TextAxis>(labels.size());
+    for (Json::ArrayIndex i = 0; i < labels.size(); ++i)
+      textAxis->setLabel(i, labels[i].asString());
+    axis = std::move(textAxis);
+  }
+  if (!axis)
+    return;
+  axis->title() = json["title"].asString();
+  axis->setUnit(json["unit"].asString());
+  ws.replaceAxis(1, axis.release());
+}
+} // namespace
+
+/**
+ * Return the confidence with with this algorithm can load the file
+ * @param descriptor A descriptor for the file
+ * @returns An integer specifying the confidence level. 0 indicates it will not
+ * be used
+ */
+int LoadWorkspaceSnapshot::confidence(
+    Kernel::FileDescriptor &descriptor) const {
+  if (descriptor.isAscii())
+    return 0;
+  char magic[sizeof(MAGIC)] = {};
+  auto &stream = descriptor.data();
+  stream.read(magic, sizeof(magic));
+  if (stream && std::equal(std::begin(MAGIC), std::end(MAGIC), magic))
+    return 95;
+  return 0;
+}
+
+/**
+ * Initialise the algorithm
+ */
+void LoadWorkspaceSnapshot::init() {
+  declareProperty(make_unique<FileProperty>("Filename", "", FileProperty::Load,
+                                            ".snapshot"),
+                  "The name of the snapshot file to load.");
+  declareProperty(make_unique<WorkspaceProperty<>>("OutputWorkspace", "",
+                                                   Direction::Output),
+                  "The name to use for the output workspace");
+}
+
+/**
+ * Execute the algorithm
+ */
+void LoadWorkspaceSnapshot::exec() {
+  const SnapshotReader reader(getPropertyValue("Filename"));
+  const auto metadata = reader.metadata();
+  if (metadata["id"].asString() != "Workspace2D")
+    throw std::runtime_error("Snapshots of " + metadata["id"].asString() +
+                             " are not supported");
+  const size_t nhist = metadata["histograms"].asUInt();
+  if (nhist == 0)
+    throw std::runtime_error("The snapshot does not contain any spectra");
+
+  std::vector<cow_ptr<HistogramX>> xs;
+  for (const auto &index : metadata["x"]) {
+    const auto x = reader.block<double>(index);
+    xs.push_back(make_cow<HistogramX>(x.begin(), x.end()));
+  }
+  const auto xIndices = reader.block<uint32_t>(metadata["xIndices"]);
+  checkSize(xIndices, nhist);
+  if (std::any_of(xIndices.begin(), xIndices.end(),
+                  [&xs](uint32_t index) { return index >= xs.size(); }))
+    throw std::runtime_error("The snapshot refers to a missing X array");
+
+  // Spectra may have different lengths, find where each one starts
+  const auto yLengths = reader.block<uint64_t>(metadata["yLengths"]);
+  checkSize(yLengths, nhist);
+  std::vector<size_t> yOffsets(nhist + 1, 0);
+  std::partial_sum(yLengths.begin(), yLengths.end(), yOffsets.begin() + 1);
+  const auto y = reader.block<double>(metadata["y"]);
+  const auto e = reader.block<double>(metadata["e"]);
+  checkSize(y, yOffsets.back());
+  checkSize(e, yOffsets.back());
+
+  const bool hasDx = metadata.isMember("dxLengths");
+  std::vector<size_t> dxOffsets(nhist + 1, 0);
+  BlockView<uint64_t> dxLengths{nullptr, 0};
+  BlockView<double> dx{nullptr, 0};
+  if (hasDx) {
+    dxLengths = reader.block<uint64_t>(metadata["dxLengths"]);
+    checkSize(dxLengths, nhist);
+    std::partial_sum(dxLengths.begin(), dxLengths.end(),
+                     dxOffsets.begin() + 1);
+    dx = reader.block<double>(metadata["dx"]);
+    checkSize(dx, dxOffsets.back());
+  }
+
+  const bool distribution = metadata["distribution"].asBool();
+  auto histogram = [&](size_t i) {
+    const auto &x = xs[xIndices.data[i]];
+    const auto *yStart = y.data + yOffsets[i];
+    const auto *eStart = e.data + yOffsets[i];
+    const size_t n = yLengths.data[i];
+    auto result =
+        x->size() == n + 1
+            ? makeHistogram<BinEdges>(x, yStart, eStart, n, distribution)
+            : makeHistogram<Points>(x, yStart, eStart, n, distribution);
+    if (hasDx && dxLengths.data[i] > 0) {
+      const auto *dxStart = dx.data + dxOffsets[i];
+      result.setPointStandardDeviations(dxStart,
+                                        dxStart + dxLengths.data[i]);
+    }
+    return result;
+  };
+
+  // Copying out of the mapping is where the pages are read from disk
+  MatrixWorkspace_sptr ws =
+      DataObjects::create<Workspace2D>(nhist, histogram(0));
+  Progress progress(this, 0.0, 1.0, nhist + 2);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*ws))
+  for (int64_t i = 1; i < static_cast<int64_t>(nhist); ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    ws->setHistogram(i, histogram(i));
+    progress.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  for (const auto &masked : metadata["maskedBins"]) {
+    const size_t index = masked["index"].asUInt();
+    const auto &bins = masked["bins"];
+    const auto &weights = masked["weights"];
+    for (Json::ArrayIndex i = 0; i < bins.size(); ++i)
+      ws->flagMasked(index, bins[i].asUInt(), weights[i].asDouble());
+  }
+
+  ws->setTitle(metadata["title"].asString());
+  ws->setComment(metadata["comment"].asString());
+  ws->getAxis(0)->setUnit(metadata["unitX"].asString());
+  ws->setYUnit(metadata["yUnit"].asString());
+  ws->setYUnitLabel(metadata["yUnitLabel"].asString());
+  loadVerticalAxis(reader, metadata["verticalAxis"], *ws);
+
+  progress.report("Loading instrument");
+  const auto &instrument = metadata["instrument"];
+  if (instrument.isObject() &&
+      loadInstrument(ws, instrument["name"].asString(),
+                     instrument["xml"].asString())) {
+    ws->readParameterMap(instrument["parameters"].asString());
+    auto &detectorInfo = ws->mutableDetectorInfo();
+    for (const auto id :
+         reader.block<int32_t>(instrument["maskedDetectors"]))
+      detectorInfo.setMasked(detectorInfo.indexOf(id), true);
+  }
+
+  const auto spectrumNumbers =
+      reader.block<int32_t>(metadata["spectrumNumbers"]);
+  const auto detectorCounts =
+      reader.block<uint32_t>(metadata["detectorCounts"]);
+  const auto detectorIDs = reader.block<int32_t>(metadata["detectorIDs"]);
+  checkSize(spectrumNumbers, nhist);
+  checkSize(detectorCounts, nhist);
+  checkSize(detectorIDs, std::accumulate(detectorCounts.begin(),
+                                         detectorCounts.end(), size_t(0)));
+  const auto *ids = detectorIDs.data;
+  for (size_t i = 0; i < nhist; ++i) {
+    auto &spectrum = ws->getSpectrum(i);
+    spectrum.setSpectrumNo(spectrumNumbers.data[i]);
+    spectrum.setDetectorIDs(
+        std::set<detid_t>(ids, ids + detectorCounts.data[i]));
+    ids += detectorCounts.data[i];
+  }
+
+  progress.report("Loading logs");
+  auto &run = ws->mutableRun();
+  for (const auto &log : metadata["logs"]) {
+    auto property = loadLog(reader, log);
+    if (property)
+      run.addProperty(std::move(property), true);
+    else
+      g_log.warning() << "The log " << log["name"].asString()
+                      << " has an unknown type and has been skipped.\n";
+  }
+  for (const auto &history : metadata["history"])
+    ws->history().addHistory(historyFromJson(history));
+
+  setProperty("OutputWorkspace", ws);
+}
+
+/**
+ * Load the instrument by its definition, or by name if the definition was
+ * not stored
+ * @param ws :: The workspace to attach the instrument to
+ * @param name :: The name of the instrument
+ * @param xml :: The instrument definition, may be empty
+ * @return true if the instrument was loaded
+ */
+bool LoadWorkspaceSnapshot::loadInstrument(const MatrixWorkspace_sptr &ws,
+                                           const std::string &name,
+                                           const std::string &xml) {
+  auto loadInst = createChildAlgorithm("LoadInstrument");
+  try {
+    loadInst->setProperty<MatrixWorkspace_sptr>("Workspace", ws);
+    loadInst->setPropertyValue("InstrumentName", name);
+    if (!xml.empty())
+      loadInst->setPropertyValue("InstrumentXML", xml);
+    loadInst->setProperty("RewriteSpectraMap", OptionalBool(false));
+    loadInst->execute();
+  } catch (std::exception &e) {
+    g_log.warning() << "Unable to load the instrument " << name << ": "
+                    << e.what() << "\n";
+    return false;
+  }
+  return true;
+}
+
+} // namespace DataHandling
+} // namespace Mantid
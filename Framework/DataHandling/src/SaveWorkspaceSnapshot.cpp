@@ -0,0 +1,469 @@
+#include "MantidDataHandling/SaveWorkspaceSnapshot.h"
+#include "MantidDataHandling/WorkspaceSnapshotFormat.h"
+
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/BinEdgeAxis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Progress.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/PropertyHistory.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/Unit.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace Mantid {
+namespace DataHandling {
+
+// Register the algorithm into the algorithm factory
+DECLARE_ALGORITHM(SaveWorkspaceSnapshot)
+
+using namespace Kernel;
+using namespace API;
+using namespace WorkspaceSnapshotFormat;
+using Types::Core::DateAndTime;
+
+namespace {
+/// The size of the buffer between the data and the file
+constexpr size_t BUFFER_SIZE = 4 * 1024 * 1024;
+
+/**
+ * Writes the binary blocks of a snapshot sequentially through a large buffer
+ * and finishes the file with the block directory, metadata and header.
+ */
+class SnapshotWriter {
+public:
+  explicit SnapshotWriter(const std::string &filename)
+      : m_filename(filename), m_buffer(BUFFER_SIZE) {
+    // The buffer must be installed before the file is opened to take effect
+    m_file.rdbuf()->pubsetbuf(m_buffer.data(), m_buffer.size());
+    m_file.open(filename.c_str(),
+                std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!m_file)
+      throw Exception::FileError("Unable to create file: ", filename);
+    // Reserve the space for the header, it is written last
+    const Header header = {};
+    write(&header, sizeof(header));
+  }
+
+  /// Start a new block and return its index in the directory
+  Json::UInt beginBlock() {
+    pad();
+    m_blocks.push_back(Block{m_position, 0});
+    return static_cast<Json::UInt>(m_blocks.size() - 1);
+  }
+
+  /// Append count values to the current block
+  template <typename T> void append(const T *data, size_t count) {
+    const auto size = count * sizeof(T);
+    write(data, size);
+    m_blocks.back().size += size;
+  }
+
+  /// Write values as a block of their own and return its index
+  template <typename T> Json::UInt addBlock(const std::vector<T> &values) {
+    const auto index = beginBlock();
+    append(values.data(), values.size());
+    return index;
+  }
+
+  /// Write the directory, the metadata and the header and close the file
+  void finish(const Json::Value &metadata) {
+    Header header = {};
+    std::copy(std::begin(MAGIC), std::end(MAGIC), header.magic);
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+
+    pad();
+    header.directoryOffset = m_position;
+    header.blockCount = m_blocks.size();
+    write(m_blocks.data(), m_blocks.size() * sizeof(Block));
+
+    const std::string json = Json::FastWriter().write(metadata);
+    header.metadataOffset = m_position;
+    header.metadataSize = json.size();
+    write(json.data(), json.size());
+
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    m_file.close();
+    if (m_file.fail())
+      throw Exception::FileError("Unable to write file: ", m_filename);
+  }
+
+private:
+  void write(const void *data, size_t size) {
+    m_file.write(static_cast<const char *>(data), size);
+    m_position += size;
+  }
+
+  /// Move to the next ALIGNMENT boundary
+  void pad() {
+    static const char zeros[ALIGNMENT] = {};
+    write(zeros, (ALIGNMENT - m_position % ALIGNMENT) % ALIGNMENT);
+  }
+
+  const std::string m_filename;
+  std::vector<char> m_buffer;
+  std::ofstream m_file;
+  uint64_t m_position = 0;
+  std::vector<Block> m_blocks;
+};
+
+/// Write the X, Y, E and Dx arrays of every spectrum
+void writeData(SnapshotWriter &writer, const MatrixWorkspace &ws,
+               Json::Value &metadata) {
+  const size_t nhist = ws.getNumberHistograms();
+
+  // Most workspaces share one X array between many spectra, store it once
+  std::map<const HistogramData::HistogramX *, uint32_t> uniqueX;
+  std::vector<uint32_t> xIndices(nhist);
+  Json::Value xBlocks(Json::arrayValue);
+  for (size_t i = 0; i < nhist; ++i) {
+    const auto x = ws.sharedX(i);
+    auto found = uniqueX.find(x.get());
+    if (found == uniqueX.end()) {
+      found = uniqueX.emplace(x.get(), xBlocks.size()).first;
+      xBlocks.append(writer.addBlock(x->rawData()));
+    }
+    xIndices[i] = found->second;
+  }
+  metadata["x"] = xBlocks;
+  metadata["xIndices"] = writer.addBlock(xIndices);
+
+  std::vector<uint64_t> yLengths(nhist);
+  std::vector<uint64_t> dxLengths(nhist, 0);
+  bool hasDx(false);
+  for (size_t i = 0; i < nhist; ++i) {
+    yLengths[i] = ws.y(i).size();
+    if (ws.hasDx(i)) {
+      dxLengths[i] = ws.dx(i).size();
+      hasDx = true;
+    }
+  }
+  metadata["yLengths"] = writer.addBlock(yLengths);
+
+  metadata["y"] = writer.beginBlock();
+  for (size_t i = 0; i < nhist; ++i)
+    writer.append(ws.y(i).rawData().data(), yLengths[i]);
+  metadata["e"] = writer.beginBlock();
+  for (size_t i = 0; i < nhist; ++i)
+    writer.append(ws.e(i).rawData().data(), yLengths[i]);
+
+  if (hasDx) {
+    metadata["dxLengths"] = writer.addBlock(dxLengths);
+    metadata["dx"] = writer.beginBlock();
+    for (size_t i = 0; i < nhist; ++i) {
+      if (dxLengths[i] > 0)
+        writer.append(ws.dx(i).rawData().data(), dxLengths[i]);
+    }
+  }
+
+  Json::Value maskedBins(Json::arrayValue);
+  for (size_t i = 0; i < nhist; ++i) {
+    if (!ws.hasMaskedBins(i))
+      continue;
+    Json::Value spectrum;
+    spectrum["index"] = static_cast<Json::UInt>(i);
+    for (const auto &bin : ws.maskedBins(i)) {
+      spectrum["bins"].append(static_cast<Json::UInt>(bin.first));
+      spectrum["weights"].append(bin.second);
+    }
+    maskedBins.append(spectrum);
+  }
+  metadata["maskedBins"] = maskedBins;
+}
+
+/// Write the spectrum numbers and the detector IDs of each spectrum
+void writeSpectra(SnapshotWriter &writer, const MatrixWorkspace &ws,
+                  Json::Value &metadata) {
+  const size_t nhist = ws.getNumberHistograms();
+  std::vector<int32_t> spectrumNumbers(nhist);
+  std::vector<uint32_t> detectorCounts(nhist);
+  std::vector<int32_t> detectorIDs;
+  for (size_t i = 0; i < nhist; ++i) {
+    const auto &spectrum = ws.getSpectrum(i);
+    spectrumNumbers[i] = spectrum.getSpectrumNo();
+    const auto &ids = spectrum.getDetectorIDs();
+    detectorCounts[i] = static_cast<uint32_t>(ids.size());
+    detectorIDs.insert(detectorIDs.end(), ids.begin(), ids.end());
+  }
+  metadata["spectrumNumbers"] = writer.addBlock(spectrumNumbers);
+  metadata["detectorCounts"] = writer.addBlock(detectorCounts);
+  metadata["detectorIDs"] = writer.addBlock(detectorIDs);
+}
+
+/// Write the units and, if it is not a spectra axis, the vertical axis
+void writeAxes(SnapshotWriter &writer, const MatrixWorkspace &ws,
+               Json::Value &metadata) {
+  metadata["unitX"] = ws.getAxis(0)->unit()->unitID();
+  metadata["yUnit"] = ws.YUnit();
+  metadata["yUnitLabel"] = ws.YUnitLabel();
+  metadata["distribution"] = ws.isDistribution();
+
+  const auto *axis = ws.getAxis(1);
+  Json::Value vertical;
+  vertical["title"] = axis->title();
+  vertical["unit"] = axis->unit()->unitID();
+  if (axis->isSpectra()) {
+    vertical["type"] = "spectra";
+  } else if (axis->isNumeric()) {
+    const bool edges = dynamic_cast<const BinEdgeAxis *>(axis) != nullptr;
+    vertical["type"] = edges ? "binedge" : "numeric";
+    std::vector<double> values(axis->length());
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = (*axis)(i);
+    vertical["values"] = writer.addBlock(values);
+  } else if (axis->isText()) {
+    vertical["type"] = "text";
+    vertical["labels"] = Json::Value(Json::arrayValue);
+    for (size_t i = 0; i < axis->length(); ++i)
+      vertical["labels"].append(axis->label(i));
+  }
+  metadata["verticalAxis"] = vertical;
+}
+
+/// Write a reference to the instrument, its parameters and the masking
+void writeInstrument(SnapshotWriter &writer, const MatrixWorkspace &ws,
+                     Json::Value &metadata) {
+  const auto instrument = ws.getInstrument();
+  if (instrument->getName().empty())
+    return;
+  Json::Value json;
+  json["name"] = instrument->getName();
+  json["xml"] = instrument->baseInstrument()->getXmlText();
+  // Positions and rotations are held by ComponentInfo and DetectorInfo, the
+  // legacy map adds them back as parameters as Instrument::saveNexus does
+  json["parameters"] = instrument->makeLegacyParameterMap()->asString();
+
+  const auto &detectorInfo = ws.detectorInfo();
+  std::vector<int32_t> masked;
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    if (detectorInfo.isMasked(i))
+      masked.push_back(detectorInfo.detectorIDs()[i]);
+  }
+  json["maskedDetectors"] = writer.addBlock(masked);
+  metadata["instrument"] = json;
+}
+
+/// Store the times and values of a numeric time series as blocks
+template <typename T, typename Stored>
+bool writeSeries(SnapshotWriter &writer, const Property *property,
+                 const std::string &type, Json::Value &log) {
+  const auto *series = dynamic_cast<const TimeSeriesProperty<T> *>(property);
+  if (!series)
+    return false;
+  const auto times = series->timesAsVector();
+  std::vector<int64_t> nanoseconds(times.size());
+  std::transform(
+      times.begin(), times.end(), nanoseconds.begin(),
+      [](const DateAndTime &time) { return time.totalNanoseconds(); });
+  const auto values = series->valuesAsVector();
+  log["type"] = type;
+  log["times"] = writer.addBlock(nanoseconds);
+  log["values"] = writer.addBlock(std::vector<Stored>(values.begin(),
+                                                      values.end()));
+  return true;
+}
+
+/// Store a single value log directly in the metadata
+template <typename T>
+bool writeValue(const Property *property, const std::string &type,
+                Json::Value &log) {
+  const auto *value = dynamic_cast<const PropertyWithValue<T> *>(property);
+  if (!value)
+    return false;
+  log["type"] = type;
+  log["value"] = static_cast<T>(*value);
+  return true;
+}
+
+/// Write the sample logs, returns false for a log type that is not supported
+bool writeLog(SnapshotWriter &writer, const Property *property,
+              Json::Value &log) {
+  log["name"] = property->name();
+  log["units"] = property->units();
+  if (writeSeries<double, double>(writer, property, "series<double>", log) ||
+      writeSeries<int, int32_t>(writer, property, "series<int>", log) ||
+      writeSeries<bool, uint8_t>(writer, property, "series<bool>", log) ||
+      writeValue<double>(property, "double", log) ||
+      writeValue<int>(property, "int", log) ||
+      writeValue<std::string>(property, "string", log))
+    return true;
+  if (const auto *series =
+          dynamic_cast<const TimeSeriesProperty<std::string> *>(property)) {
+    log["type"] = "series<string>";
+    for (const auto &time : series->timesAsVector())
+      log["times"].append(time.toISO8601String());
+    for (const auto &value : series->valuesAsVector())
+      log["values"].append(value);
+    return true;
+  }
+  if (const auto *vector =
+          dynamic_cast<const PropertyWithValue<std::vector<double>> *>(
+              property)) {
+    log["type"] = "vector<double>";
+    log["values"] = writer.addBlock((*vector)());
+    return true;
+  }
+  return false;
+}
+
+/// Whether writeLog can store a log of this type
+bool isSupportedLog(const Property *property) {
+  return dynamic_cast<const TimeSeriesProperty<double> *>(property) ||
+         dynamic_cast<const TimeSeriesProperty<int> *>(property) ||
+         dynamic_cast<const TimeSeriesProperty<bool> *>(property) ||
+         dynamic_cast<const TimeSeriesProperty<std::string> *>(property) ||
+         dynamic_cast<const PropertyWithValue<double> *>(property) ||
+         dynamic_cast<const PropertyWithValue<int> *>(property) ||
+         dynamic_cast<const PropertyWithValue<std::string> *>(property) ||
+         dynamic_cast<const PropertyWithValue<std::vector<double>> *>(
+             property);
+}
+
+/// Describe the parts of the workspace other than logs that a snapshot
+/// cannot hold, if any
+std::string findUnsupported(const MatrixWorkspace &ws) {
+  const auto &sample = ws.sample();
+  bool hasEnvironment = true;
+  try {
+    sample.getEnvironment();
+  } catch (std::runtime_error &) {
+    hasEnvironment = false;
+  }
+  if (sample.size() > 1 || !sample.getName().empty() ||
+      sample.getShape().hasValidShape() ||
+      !sample.getMaterial().name().empty() || hasEnvironment ||
+      sample.hasOrientedLattice() || sample.hasCrystalStructure() ||
+      sample.getGeometryFlag() != 0 || sample.getThickness() != 0.0 ||
+      sample.getHeight() != 0.0 || sample.getWidth() != 0.0)
+    return "the sample";
+  if (ws.run().getGoniometer().isDefined())
+    return "the goniometer";
+  return "";
+}
+
+/// Convert an algorithm history and its children to JSON
+Json::Value historyToJson(const AlgorithmHistory &history) {
+  Json::Value json;
+  json["name"] = history.name();
+  json["version"] = history.version();
+  json["date"] = history.executionDate().toISO8601String();
+  json["duration"] = history.executionDuration();
+  json["count"] = static_cast<Json::UInt>(history.execCount());
+  json["properties"] = Json::Value(Json::arrayValue);
+  for (const auto &property : history.getProperties()) {
+    Json::Value prop;
+    prop["name"] = property->name();
+    prop["value"] = property->value();
+    prop["default"] = property->isDefault();
+    prop["direction"] = property->direction();
+    json["properties"].append(prop);
+  }
+  json["children"] = Json::Value(Json::arrayValue);
+  for (const auto &child : history.getChildHistories())
+    json["children"].append(historyToJson(*child));
+  return json;
+}
+} // namespace
+
+/**
+ * Initialise the algorithm
+ */
+void SaveWorkspaceSnapshot::init() {
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      "InputWorkspace", "", Direction::Input),
+                  "The name of the workspace to save.");
+  declareProperty(make_unique<FileProperty>("Filename", "", FileProperty::Save,
+                                            ".snapshot"),
+                  "The name of the snapshot file to write.");
+  declareProperty("SkipUnsupported", true,
+                  "Save the workspace without the parts a snapshot cannot "
+                  "hold: the sample, the goniometer and logs of unsupported "
+                  "types. If false the algorithm fails instead.");
+}
+
+/**
+ * Only plain histogram workspaces are supported
+ * @returns a map of property names to errors
+ */
+std::map<std::string, std::string> SaveWorkspaceSnapshot::validateInputs() {
+  std::map<std::string, std::string> errors;
+  MatrixWorkspace_const_sptr ws = getProperty("InputWorkspace");
+  if (ws && ws->id() != "Workspace2D")
+    errors["InputWorkspace"] = "Only Workspace2D can be saved as a snapshot.";
+  return errors;
+}
+
+/**
+ * Execute the algorithm
+ */
+void SaveWorkspaceSnapshot::exec() {
+  MatrixWorkspace_const_sptr ws = getProperty("InputWorkspace");
+  const bool skipUnsupported = getProperty("SkipUnsupported");
+  auto unsupported = findUnsupported(*ws);
+  if (!skipUnsupported) {
+    for (const auto *property : ws->run().getProperties()) {
+      if (unsupported.empty() && !isSupportedLog(property))
+        unsupported = "the log " + property->name();
+    }
+    if (!unsupported.empty())
+      throw std::runtime_error("A snapshot cannot hold " + unsupported +
+                               " of the workspace.");
+  } else if (!unsupported.empty()) {
+    g_log.warning() << "A snapshot cannot hold " << unsupported
+                    << " of the workspace, it has been skipped.\n";
+  }
+  SnapshotWriter writer(getPropertyValue("Filename"));
+  Progress progress(this, 0.0, 1.0, 4);
+
+  Json::Value metadata;
+  metadata["id"] = ws->id();
+  metadata["title"] = ws->getTitle();
+  metadata["comment"] = ws->getComment();
+  metadata["histograms"] =
+      static_cast<Json::UInt>(ws->getNumberHistograms());
+
+  writeData(writer, *ws, metadata);
+  progress.report("Writing spectra");
+  writeSpectra(writer, *ws, metadata);
+  writeAxes(writer, *ws, metadata);
+  progress.report("Writing instrument");
+  writeInstrument(writer, *ws, metadata);
+
+  progress.report("Writing logs");
+  metadata["logs"] = Json::Value(Json::arrayValue);
+  for (const auto *property : ws->run().getProperties()) {
+    Json::Value log;
+    if (writeLog(writer, property, log))
+      metadata["logs"].append(log);
+    else
+      g_log.warning() << "The log " << property->name()
+                      << " has a type that cannot be saved in a snapshot, it "
+                         "has been skipped.\n";
+  }
+
+  metadata["history"] = Json::Value(Json::arrayValue);
+  for (const auto &history : ws->getHistory().getAlgorithmHistories())
+    metadata["history"].append(historyToJson(*history));
+
+  progress.report("Writing metadata");
+  writer.finish(metadata);
+}
+
+} // namespace DataHandling
+} // namespace Mantid
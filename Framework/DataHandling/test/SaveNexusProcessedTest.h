@@ -32,6 +32,7 @@
 
 #include <nexus/NeXusFile.hpp>
 
+#include <cmath>
 #include <fstream>
 #include <cxxtest/TestSuite.h>
 
@@ -862,6 +863,49 @@ public:
     AnalysisDataService::Instance().remove("testSpace");
   }
 
+  void test_compressed_data_round_trip() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(50, 20);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      auto &y = ws->mutableY(i);
+      auto &e = ws->mutableE(i);
+      for (size_t j = 0; j < y.size(); ++j) {
+        y[j] = static_cast<double>(i * 100 + j);
+        e[j] = std::sqrt(y[j]);
+      }
+    }
+    const std::string file = "SaveNexusProcessedTest_compressed.nxs";
+    const auto loaded = boost::dynamic_pointer_cast<MatrixWorkspace>(
+        saveAndLoad(ws, file, true));
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+
+    TS_ASSERT_EQUALS(loaded->getNumberHistograms(), 50);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(loaded->y(i).rawData(), ws->y(i).rawData());
+      TS_ASSERT_EQUALS(loaded->e(i).rawData(), ws->e(i).rawData());
+    }
+  }
+
+  void test_compressed_events_spanning_several_chunks_round_trip() {
+    // More events than fit in one compressed chunk
+    auto ws = WorkspaceCreationHelper::createEventWorkspace(3, 10, 100000);
+    const std::string file = "SaveNexusProcessedTest_compressed_events.nxs";
+    const auto loaded = boost::dynamic_pointer_cast<EventWorkspace>(
+        saveAndLoad(ws, file, true));
+    TS_ASSERT(loaded);
+    if (!loaded)
+      return;
+
+    TS_ASSERT_EQUALS(loaded->getNumberEvents(), ws->getNumberEvents());
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(loaded->getSpectrum(i).getTofs(),
+                       ws->getSpectrum(i).getTofs());
+      TS_ASSERT_EQUALS(loaded->getSpectrum(i).getPulseTimes(),
+                       ws->getSpectrum(i).getPulseTimes());
+    }
+  }
+
   void test_nexus_spectraMap() {
     NexusTestHelper th(true);
     th.createFile("MatrixWorkspaceTest.nxs");
@@ -878,6 +922,36 @@ public:
   }
 
 private:
+  Workspace_sptr saveAndLoad(const MatrixWorkspace_sptr &ws,
+                             const std::string &file, bool compress) {
+    SaveNexusProcessed saveAlg;
+    saveAlg.initialize();
+    saveAlg.setProperty("InputWorkspace", ws);
+    saveAlg.setPropertyValue("Filename", file);
+    saveAlg.setProperty("CompressNexus", compress);
+    const std::string path = saveAlg.getPropertyValue("Filename");
+    if (Poco::File(path).exists())
+      Poco::File(path).remove();
+    TS_ASSERT_THROWS_NOTHING(saveAlg.execute());
+    TS_ASSERT(saveAlg.isExecuted());
+
+    LoadNexus loadAlg;
+    loadAlg.initialize();
+    loadAlg.setPropertyValue("Filename", path);
+    loadAlg.setPropertyValue("OutputWorkspace", "SaveNexusProcessedTest_out");
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+    TS_ASSERT(loadAlg.isExecuted());
+    if (clearfiles && Poco::File(path).exists())
+      Poco::File(path).remove();
+    auto &ads = AnalysisDataService::Instance();
+    Workspace_sptr loaded;
+    if (ads.doesExist("SaveNexusProcessedTest_out")) {
+      loaded = ads.retrieve("SaveNexusProcessedTest_out");
+      ads.remove("SaveNexusProcessedTest_out");
+    }
+    return loaded;
+  }
+
   void doTestColumnInfo(::NeXus::File &file, int type,
                         const std::string &interpret_as,
                         const std::string &name) {
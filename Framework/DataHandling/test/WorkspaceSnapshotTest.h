@@ -0,0 +1,318 @@
+#ifndef MANTID_DATAHANDLING_WORKSPACESNAPSHOTTEST_H_
+#define MANTID_DATAHANDLING_WORKSPACESNAPSHOTTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataHandling/LoadInstrument.h"
+#include "MantidDataHandling/LoadWorkspaceSnapshot.h"
+#include "MantidDataHandling/SaveWorkspaceSnapshot.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Crystal/OrientedLattice.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/FileDescriptor.h"
+#include "MantidKernel/OptionalBool.h"
+#include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/TemporaryFile.h>
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <fstream>
+
+using namespace Mantid::API;
+using namespace Mantid::DataHandling;
+using Mantid::Kernel::TimeSeriesProperty;
+
+class WorkspaceSnapshotTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static WorkspaceSnapshotTest *createSuite() {
+    return new WorkspaceSnapshotTest();
+  }
+  static void destroySuite(WorkspaceSnapshotTest *suite) { delete suite; }
+
+  WorkspaceSnapshotTest() { FrameworkManager::Instance(); }
+
+  void tearDown() override {
+    AnalysisDataService::Instance().clear();
+    if (Poco::File(m_filename).exists())
+      Poco::File(m_filename).remove();
+  }
+
+  void test_data_and_units_are_restored() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(3, 4, 1.0);
+    ws->mutableY(1)[2] = 42.0;
+    ws->mutableE(2)[0] = 0.5;
+    ws->setPointStandardDeviations(1, 4, 0.25);
+    ws->flagMasked(0, 1, 0.75);
+    ws->getAxis(0)->unit() =
+        Mantid::Kernel::UnitFactory::Instance().create("TOF");
+    ws->setYUnit("Counts");
+    ws->setTitle("Snapshot title");
+
+    const auto loaded = roundTrip(ws);
+
+    TS_ASSERT_EQUALS(loaded->id(), "Workspace2D");
+    TS_ASSERT_EQUALS(loaded->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(loaded->getTitle(), "Snapshot title");
+    TS_ASSERT_EQUALS(loaded->getAxis(0)->unit()->unitID(), "TOF");
+    TS_ASSERT_EQUALS(loaded->YUnit(), "Counts");
+    TS_ASSERT(loaded->isHistogramData());
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(loaded->x(i).rawData(), ws->x(i).rawData());
+      TS_ASSERT_EQUALS(loaded->y(i).rawData(), ws->y(i).rawData());
+      TS_ASSERT_EQUALS(loaded->e(i).rawData(), ws->e(i).rawData());
+      TS_ASSERT_EQUALS(loaded->getSpectrum(i).getSpectrumNo(),
+                       ws->getSpectrum(i).getSpectrumNo());
+    }
+    // The shared X array is only stored once and is shared again on load
+    TS_ASSERT_EQUALS(loaded->sharedX(0).get(), loaded->sharedX(2).get());
+    TS_ASSERT(!loaded->hasDx(0));
+    TS_ASSERT(loaded->hasDx(1));
+    TS_ASSERT_EQUALS(loaded->dx(1)[3], 0.25);
+    TS_ASSERT(loaded->hasMaskedBins(0));
+    TS_ASSERT_EQUALS(loaded->maskedBins(0).at(1), 0.75);
+    TS_ASSERT(!loaded->hasMaskedBins(1));
+  }
+
+  void test_logs_are_restored() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    auto series = new TimeSeriesProperty<double>("temperature");
+    series->addValue("2017-06-01T10:00:00", 1.5);
+    series->addValue("2017-06-01T10:00:10", 2.5);
+    series->setUnits("K");
+    ws->mutableRun().addProperty(series);
+    ws->mutableRun().addProperty("run_title", std::string("A title"));
+    ws->mutableRun().addProperty("run_number", 1234);
+
+    const auto loaded = roundTrip(ws);
+    const auto &run = loaded->run();
+
+    auto *temperature = dynamic_cast<TimeSeriesProperty<double> *>(
+        run.getProperty("temperature"));
+    TS_ASSERT(temperature);
+    if (!temperature)
+      return;
+    TS_ASSERT_EQUALS(temperature->units(), "K");
+    TS_ASSERT_EQUALS(temperature->valuesAsVector(), series->valuesAsVector());
+    TS_ASSERT_EQUALS(temperature->timesAsVector(), series->timesAsVector());
+    TS_ASSERT_EQUALS(run.getPropertyValueAsType<std::string>("run_title"),
+                     "A title");
+    TS_ASSERT_EQUALS(run.getPropertyValueAsType<int>("run_number"), 1234);
+  }
+
+  void test_instrument_and_masking_are_restored() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(10, 2);
+    loadMARI(ws);
+    const auto maskedID = ws->detectorInfo().detectorIDs()[3];
+    ws->mutableDetectorInfo().setMasked(3, true);
+
+    const auto loaded = roundTrip(ws);
+
+    TS_ASSERT_EQUALS(loaded->getInstrument()->getName(), "MARI");
+    const auto &detectorInfo = loaded->detectorInfo();
+    TS_ASSERT_EQUALS(detectorInfo.size(), ws->detectorInfo().size());
+    TS_ASSERT(detectorInfo.isMasked(detectorInfo.indexOf(maskedID)));
+    TS_ASSERT(!detectorInfo.isMasked(0));
+    for (size_t i = 0; i < 10; ++i)
+      TS_ASSERT_EQUALS(loaded->getSpectrum(i).getDetectorIDs(),
+                       ws->getSpectrum(i).getDetectorIDs());
+  }
+
+  void test_moved_detectors_are_restored() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(10, 2);
+    loadMARI(ws);
+    const Mantid::Kernel::V3D position(1.0, 2.0, 3.0);
+    ws->mutableDetectorInfo().setPosition(2, position);
+    const auto detectorID = ws->detectorInfo().detectorIDs()[2];
+
+    const auto loaded = roundTrip(ws);
+
+    const auto &detectorInfo = loaded->detectorInfo();
+    const auto index = detectorInfo.indexOf(detectorID);
+    TS_ASSERT_DELTA(detectorInfo.position(index).X(), position.X(), 1e-12);
+    TS_ASSERT_DELTA(detectorInfo.position(index).Y(), position.Y(), 1e-12);
+    TS_ASSERT_DELTA(detectorInfo.position(index).Z(), position.Z(), 1e-12);
+  }
+
+  void test_unsupported_content_fails_if_not_skipped() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    ws->mutableSample().setOrientedLattice(
+        new Mantid::Geometry::OrientedLattice(1.0, 2.0, 3.0));
+    SaveWorkspaceSnapshot saver;
+    saver.initialize();
+    saver.setChild(true);
+    saver.setProperty<MatrixWorkspace_sptr>("InputWorkspace", ws);
+    saver.setPropertyValue("Filename", "WorkspaceSnapshotTest.snapshot");
+    saver.setProperty("SkipUnsupported", false);
+    m_filename = saver.getPropertyValue("Filename");
+    TS_ASSERT_THROWS(saver.execute(), std::runtime_error);
+
+    // The default skips the lattice
+    saver.setProperty("SkipUnsupported", true);
+    TS_ASSERT_THROWS_NOTHING(saver.execute());
+    TS_ASSERT(saver.isExecuted());
+  }
+
+  void test_history_is_restored() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    auto history = boost::make_shared<AlgorithmHistory>("Rebin", 1);
+    history->addProperty("Params", "1,0.5,10", false);
+    ws->history().addHistory(history);
+
+    const auto loaded = roundTrip(ws);
+
+    const auto &histories = loaded->getHistory();
+    TS_ASSERT_EQUALS(histories.size(), 2);
+    TS_ASSERT_EQUALS(histories[0]->name(), "Rebin");
+    TS_ASSERT_EQUALS(histories[0]->getPropertyValue("Params"), "1,0.5,10");
+    TS_ASSERT_EQUALS(histories[1]->name(), "LoadWorkspaceSnapshot");
+  }
+
+  void test_event_workspaces_are_rejected() {
+    SaveWorkspaceSnapshot saver;
+    saver.initialize();
+    saver.setProperty<MatrixWorkspace_sptr>(
+        "InputWorkspace", WorkspaceCreationHelper::createEventWorkspace());
+    saver.setPropertyValue("Filename", "WorkspaceSnapshotTest.snapshot");
+    TS_ASSERT_THROWS(saver.execute(), std::runtime_error);
+  }
+
+  void test_confidence() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(1, 2);
+    save(ws);
+    LoadWorkspaceSnapshot loader;
+    Mantid::Kernel::FileDescriptor snapshot(m_filename);
+    TS_ASSERT_EQUALS(loader.confidence(snapshot), 95);
+
+    Poco::TemporaryFile text;
+    std::ofstream(text.path().c_str()) << "Not a snapshot\n";
+    Mantid::Kernel::FileDescriptor other(text.path());
+    TS_ASSERT_EQUALS(loader.confidence(other), 0);
+  }
+
+  void test_spilled_workspace_is_reloaded_from_a_snapshot() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(10, 3);
+    loadMARI(ws);
+    ws->mutableY(4)[1] = 42.0;
+    const Mantid::Kernel::V3D position(1.0, 2.0, 3.0);
+    ws->mutableDetectorInfo().setPosition(2, position);
+    const auto y = ws->y(4).rawData();
+
+    const auto files = spill(ws, "spilled");
+
+    TS_ASSERT_EQUALS(files.size(), 1);
+    TS_ASSERT(boost::ends_with(files.front(), ".snapshot"));
+    auto &ads = AnalysisDataService::Instance();
+    const auto loaded = ads.retrieveWS<MatrixWorkspace>("spilled");
+    TS_ASSERT(!ads.isSpilled("spilled"));
+    TS_ASSERT_EQUALS(loaded->id(), "Workspace2D");
+    TS_ASSERT_EQUALS(loaded->getName(), "spilled");
+    TS_ASSERT_EQUALS(loaded->y(4).rawData(), y);
+    TS_ASSERT_EQUALS(loaded->getInstrument()->getName(), "MARI");
+    TS_ASSERT_EQUALS(loaded->detectorInfo().position(2), position);
+    stopSpilling();
+  }
+
+  void test_spilled_workspace_with_a_lattice_is_reloaded_from_nexus() {
+    auto ws = WorkspaceCreationHelper::create2DWorkspaceBinned(2, 3);
+    ws->mutableSample().setOrientedLattice(
+        new Mantid::Geometry::OrientedLattice(1.0, 2.0, 3.0));
+    const auto y = ws->y(1).rawData();
+
+    const auto files = spill(ws, "spilled");
+
+    TS_ASSERT_EQUALS(files.size(), 1);
+    TS_ASSERT(boost::ends_with(files.front(), ".nxs"));
+    const auto loaded =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("spilled");
+    TS_ASSERT_EQUALS(loaded->y(1).rawData(), y);
+    TS_ASSERT(loaded->sample().hasOrientedLattice());
+    TS_ASSERT_DELTA(loaded->sample().getOrientedLattice().c(), 3.0, 1e-12);
+    stopSpilling();
+  }
+
+private:
+  /**
+   * Store a workspace and spill it by setting a tiny memory limit
+   * @return The files in the spill directory
+   */
+  std::vector<std::string> spill(MatrixWorkspace_sptr ws,
+                                 const std::string &name) {
+    auto &ads = AnalysisDataService::Instance();
+    ads.addOrReplace(name, ws);
+    // The service only spills workspaces that nothing else holds
+    ws.reset();
+    Poco::File(spillDirectory()).createDirectories();
+    ads.setSpillDirectory(spillDirectory());
+    ads.setMemoryLimit(1);
+    TS_ASSERT(ads.isSpilled(name));
+    std::vector<std::string> files;
+    Poco::File(spillDirectory()).list(files);
+    return files;
+  }
+
+  void stopSpilling() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.setMemoryLimit(0);
+    ads.setSpillDirectory("");
+    ads.clear();
+    Poco::File(spillDirectory()).remove(true);
+  }
+
+  std::string spillDirectory() const {
+    Poco::Path path(Poco::Path::temp());
+    path.pushDirectory("WorkspaceSnapshotTest_spill");
+    return path.toString();
+  }
+
+  void loadMARI(const MatrixWorkspace_sptr &ws) {
+    LoadInstrument loadInstrument;
+    loadInstrument.initialize();
+    loadInstrument.setPropertyValue("InstrumentName", "MARI");
+    loadInstrument.setProperty<MatrixWorkspace_sptr>("Workspace", ws);
+    loadInstrument.setProperty("RewriteSpectraMap",
+                               Mantid::Kernel::OptionalBool(true));
+    loadInstrument.execute();
+    TS_ASSERT(loadInstrument.isExecuted());
+  }
+
+  void save(const MatrixWorkspace_sptr &ws) {
+    AnalysisDataService::Instance().addOrReplace("snapshot_in", ws);
+    SaveWorkspaceSnapshot saver;
+    saver.initialize();
+    saver.setPropertyValue("InputWorkspace", "snapshot_in");
+    saver.setPropertyValue("Filename", "WorkspaceSnapshotTest.snapshot");
+    TS_ASSERT_THROWS_NOTHING(saver.execute());
+    TS_ASSERT(saver.isExecuted());
+    m_filename = saver.getPropertyValue("Filename");
+  }
+
+  MatrixWorkspace_sptr roundTrip(const MatrixWorkspace_sptr &ws) {
+    save(ws);
+    LoadWorkspaceSnapshot loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", m_filename);
+    loader.setPropertyValue("OutputWorkspace", "snapshot_out");
+    TS_ASSERT_THROWS_NOTHING(loader.execute());
+    TS_ASSERT(loader.isExecuted());
+    return AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        "snapshot_out");
+  }
+
+  std::string m_filename = "WorkspaceSnapshotTest.snapshot";
+};
+
+#endif /* MANTID_DATAHANDLING_WORKSPACESNAPSHOTTEST_H_ */
@@ -5,6 +5,7 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitConversionPlan.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
@@ -4603,10 +4604,10 @@ template <class T>
 void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
                                           const double &factor,
                                           const double &power) {
-  for (auto &event : events) {
-    // Output unit = factor * (input) ^ power
-    event.m_tof = factor * std::pow(event.m_tof, power);
-  }
+  // Output unit = factor * (input) ^ power
+  Kernel::UnitConversionPlan::applyPowerLaw(
+      factor, power, events.begin(), events.end(),
+      [](T &event) -> double & { return event.m_tof; });
 }
 
 //--------------------------------------------------------------------------
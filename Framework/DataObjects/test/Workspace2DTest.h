@@ -56,6 +56,23 @@ public:
     ws.swap(cloned);
   }
 
+  void test_clone_shares_data_until_a_spectrum_is_modified() {
+    auto ws = boost::make_shared<Workspace2D>();
+    ws->initialize(3, 4, 4);
+    Workspace2D_sptr cloned(ws->clone());
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(&cloned->y(i), &ws->y(i));
+      TS_ASSERT_EQUALS(&cloned->e(i), &ws->e(i));
+      TS_ASSERT_EQUALS(cloned->getSpectrum(i).getSpectrumNo(),
+                       static_cast<specnum_t>(i + 1));
+    }
+    cloned->mutableY(1)[0] = 2.0;
+    TS_ASSERT_EQUALS(ws->y(1)[0], 0.0);
+    TS_ASSERT_EQUALS(&cloned->y(0), &ws->y(0));
+    TS_ASSERT_EQUALS(&cloned->y(2), &ws->y(2));
+    TS_ASSERT_DIFFERS(&cloned->y(1), &ws->y(1));
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -2,6 +2,8 @@
 #define MANTID_GEOMETRY_COMPONENTINFO_H_
 
 #include "MantidGeometry/DllConfig.h"
+#include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <boost/shared_ptr.hpp>
@@ -15,6 +17,7 @@ class V3D;
 
 namespace Geometry {
 class BoundingBox;
+class DetectorNeighbourIndex;
 class IComponent;
 class Object;
 }
@@ -63,6 +66,12 @@ private:
   /// Shapes for each component
   boost::shared_ptr<std::vector<boost::shared_ptr<const Geometry::Object>>>
       m_shapes;
+  /// Lazily built spatial index over the detectors, shared between copies
+  mutable boost::shared_ptr<const DetectorNeighbourIndex> m_neighbourIndex;
+  /// Version of the detector positions m_neighbourIndex was built from
+  mutable uint64_t m_neighbourIndexVersion{0};
+  /// Guards m_neighbourIndex and m_neighbourIndexVersion
+  mutable std::mutex m_neighbourIndexMutex;
 
   BoundingBox componentBoundingBox(const size_t index,
                                    const BoundingBox *reference) const;
@@ -90,6 +99,9 @@ public:
   Kernel::Quat relativeRotation(const size_t componentIndex) const;
   void setPosition(size_t componentIndex, const Kernel::V3D &newPosition);
   void setRotation(size_t componentIndex, const Kernel::Quat &newRotation);
+  void setPositionsAndRotations(const std::vector<size_t> &componentIndices,
+                                const std::vector<Kernel::V3D> &newPositions,
+                                const std::vector<Kernel::Quat> &newRotations);
   size_t parent(const size_t componentIndex) const;
   bool hasParent(const size_t componentIndex) const;
   Kernel::V3D sourcePosition() const;
@@ -114,6 +126,7 @@ public:
   BoundingBox boundingBox(const size_t componentIndex,
                           const BoundingBox *reference = nullptr) const;
   bool isStructuredBank(const size_t componentIndex) const;
+  boost::shared_ptr<const DetectorNeighbourIndex> neighbourIndex() const;
   friend class Instrument;
 };
 
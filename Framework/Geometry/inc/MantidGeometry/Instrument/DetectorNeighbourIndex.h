@@ -0,0 +1,105 @@
+#ifndef MANTID_GEOMETRY_DETECTORNEIGHBOURINDEX_H_
+#define MANTID_GEOMETRY_DETECTORNEIGHBOURINDEX_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class ComponentInfo;
+
+/** DetectorNeighbourIndex : Spatial index over the detectors of an instrument
+  answering nearest-neighbour and radius queries by detector index.
+
+  The index is built once from the detector positions held in a ComponentInfo
+  and is immutable afterwards. ComponentInfo caches it and hands out the same
+  instance to every workspace sharing those positions, so algorithms should
+  obtain it through ComponentInfo::neighbourIndex() rather than construct one.
+
+  Queries use a balanced k-d tree over all detectors. In addition, detectors
+  belonging to structured banks (RectangularDetector/StructuredDetector) can
+  be queried by their grid topology, which needs no search at all.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL DetectorNeighbourIndex {
+public:
+  explicit DetectorNeighbourIndex(const ComponentInfo &componentInfo);
+
+  /// Returns the number of detectors in the index
+  size_t size() const { return m_positions.size() / 3; }
+  Kernel::V3D position(const size_t detectorIndex) const;
+  bool matches(const ComponentInfo &componentInfo) const;
+
+  std::vector<size_t>
+  nearest(const size_t detectorIndex, const size_t k,
+          const std::vector<bool> *excluded = nullptr,
+          const Kernel::V3D &scale = Kernel::V3D(1.0, 1.0, 1.0)) const;
+  std::vector<std::vector<size_t>>
+  nearest(const std::vector<size_t> &detectorIndices, const size_t k,
+          const std::vector<bool> *excluded = nullptr,
+          const Kernel::V3D &scale = Kernel::V3D(1.0, 1.0, 1.0)) const;
+  std::vector<size_t>
+  withinRadius(const size_t detectorIndex, const double radius,
+               const std::vector<bool> *excluded = nullptr) const;
+  std::vector<std::vector<size_t>>
+  withinRadius(const std::vector<size_t> &detectorIndices, const double radius,
+               const std::vector<bool> *excluded = nullptr) const;
+
+  bool isInGrid(const size_t detectorIndex) const;
+  std::vector<size_t> gridNeighbours(const size_t detectorIndex,
+                                     const size_t halfWidthX,
+                                     const size_t halfWidthY) const;
+
+private:
+  /// A rectangular block of detectors
+  struct GridBank {
+    /// Detector indices column by column, pixel (x, y) is at x * nY + y
+    std::vector<size_t> detectors;
+    size_t nX;
+    size_t nY;
+  };
+
+  void buildTree(const size_t begin, const size_t end);
+  void checkIndex(const size_t detectorIndex) const;
+
+  /// Detector positions stored as x0,y0,z0,x1,...
+  std::vector<double> m_positions;
+  /// Detector indices arranged as an implicit balanced k-d tree
+  std::vector<size_t> m_tree;
+  /// Split axis of the node stored at each position of m_tree
+  std::vector<uint8_t> m_splitAxis;
+  /// Structured banks found in the instrument
+  std::vector<GridBank> m_banks;
+  /// Bank of each detector, -1 if it is not part of a structured bank
+  std::vector<int32_t> m_bankOfDetector;
+  /// Position of each detector in GridBank::detectors of its bank
+  std::vector<size_t> m_gridOffset;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_DETECTORNEIGHBOURINDEX_H_ */
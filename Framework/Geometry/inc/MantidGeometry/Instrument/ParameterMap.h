@@ -10,6 +10,7 @@
 #include "tbb/concurrent_unordered_map.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <typeinfo>
 
@@ -77,9 +78,9 @@ public:
   ParameterMap(const ParameterMap &other);
   ~ParameterMap();
   /// Returns true if the map is empty, false otherwise
-  inline bool empty() const { return m_map.empty(); }
+  inline bool empty() const { return map()->empty(); }
   /// Return the size of the map
-  inline int size() const { return static_cast<int>(m_map.size()); }
+  inline int size() const { return static_cast<int>(map()->size()); }
   /// Return string to be used in the map
   static const std::string &pos();
   static const std::string &posx();
@@ -106,16 +107,10 @@ public:
   bool operator==(const ParameterMap &rhs) const;
 
   /// Clears the map
-  inline void clear() {
-    m_map.clear();
-    clearPositionSensitiveCaches();
-  }
+  void clear();
   /// method swaps two parameter maps contents  each other. All caches contents
   /// is nullified (TO DO: it can be efficiently swapped too)
-  void swap(ParameterMap &other) {
-    m_map.swap(other.m_map);
-    clearPositionSensitiveCaches();
-  }
+  void swap(ParameterMap &other);
   /// Clear any parameters with the given name
   void clearParametersByName(const std::string &name);
 
@@ -251,8 +246,9 @@ public:
                          const std::string &name) const {
     std::vector<T> retval;
 
+    const auto map = this->map();
     pmap_cit it;
-    for (it = m_map.begin(); it != m_map.end(); ++it) {
+    for (it = map->begin(); it != map->end(); ++it) {
       if (compName == it->first->getName()) {
         boost::shared_ptr<Parameter> param = get(it->first, name);
         if (param)
@@ -330,12 +326,12 @@ public:
   /// adds a parameter filename that has been loaded
   void addParameterFilename(const std::string &filename);
 
-  /// access iterators. begin;
-  pmap_it begin() { return m_map.begin(); }
-  pmap_cit begin() const { return m_map.begin(); }
-  /// access iterators. end;
-  pmap_it end() { return m_map.end(); }
-  pmap_cit end() const { return m_map.end(); }
+  /// access iterators. begin; the non-const version unshares the map
+  pmap_it begin() { return mutableMap().begin(); }
+  pmap_cit begin() const { return map()->begin(); }
+  /// access iterators. end; the non-const version unshares the map
+  pmap_it end() { return mutableMap().end(); }
+  pmap_cit end() const { return map()->end(); }
 
   bool hasDetectorInfo(const Instrument *instrument) const;
   bool hasComponentInfo(const Instrument *instrument) const;
@@ -354,19 +350,27 @@ private:
 
   /// Assignment operator
   ParameterMap &operator=(ParameterMap *rhs);
+  /// Returns the current parameters, safe while another thread modifies them
+  boost::shared_ptr<const pmap> map() const {
+    return boost::atomic_load(&m_map);
+  }
+  pmap &mutableMap();
   /// internal function to get position of the parameter in the parameter map
-  component_map_it positionOf(const IComponent *comp, const char *name,
-                              const char *type);
+  component_map_it positionOf(pmap &map, const IComponent *comp,
+                              const char *name, const char *type) const;
   /// const version of the internal function to get position of the parameter in
   /// the parameter map
-  component_map_cit positionOf(const IComponent *comp, const char *name,
-                               const char *type) const;
+  component_map_cit positionOf(const pmap &map, const IComponent *comp,
+                               const char *name, const char *type) const;
 
   /// internal list of parameter files loaded
   std::vector<std::string> m_parameterFileNames;
 
-  /// internal parameter map instance
-  pmap m_map;
+  /// internal parameter map instance, shared between copies until one of
+  /// them is modified. Readers load it atomically, see map().
+  boost::shared_ptr<pmap> m_map;
+  /// Serialises replacing m_map when it is unshared, cleared or swapped
+  std::mutex m_mapMutex;
   /// internal cache map instance for cached position values
   std::unique_ptr<Kernel::Cache<const ComponentID, Kernel::V3D>> m_cacheLocMap;
   /// internal cache map instance for cached rotation values
@@ -27,6 +27,7 @@ class GeometryHandler;
 class Rule;
 class Surface;
 class Track;
+class TriangleMesh;
 class vtkGeometryCacheReader;
 class vtkGeometryCacheWriter;
 
@@ -138,6 +139,11 @@ public:
   // solid angle via ray tracing
   double rayTraceSolidAngle(const Kernel::V3D &observer) const;
 
+  /// Use a compiled triangle mesh for interceptSurface and solidAngle
+  bool setMeshAcceleration(const bool enable);
+  /// Returns true if a compiled triangle mesh is in use
+  bool hasMeshAcceleration() const { return m_mesh != nullptr; }
+
   /// Calculates the volume of this object.
   double volume() const;
 
@@ -198,6 +204,9 @@ private:
   void calcBoundingBoxByGeometry();
 
   int searchForObject(Kernel::V3D &) const;
+  int interceptMesh(Geometry::Track &) const;
+  bool meshPrimitive(std::vector<double> &vertices,
+                     std::vector<int> &faces) const;
   double getTriangleSolidAngle(const Kernel::V3D &a, const Kernel::V3D &b,
                                const Kernel::V3D &c,
                                const Kernel::V3D &observer) const;
@@ -257,6 +266,8 @@ private:
   std::string m_id;
   /// material composition
   std::unique_ptr<Kernel::Material> m_material;
+  /// Optional compiled triangle mesh, shared between copies of the shape
+  boost::shared_ptr<const TriangleMesh> m_mesh;
 
 protected:
   std::vector<const Surface *>
@@ -8,7 +8,7 @@
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Objects/Object.h"
 #include "MantidKernel/Tolerance.h"
-#include <list>
+#include <vector>
 
 namespace Mantid {
 //----------------------------------------------------------------------
@@ -138,13 +138,15 @@ struct IntersectionPoint {
 /**
 * Defines a track as a start point and a direction. Intersections are
 * stored as ordered lists of links from the start point to the exit point.
+* Links and points are held in flat, contiguous storage as a track rarely
+* has more than a handful of them.
 *
 * @author S. Ansell
 */
 class MANTID_GEOMETRY_DLL Track {
 public:
-  using LType = std::list<Link>;
-  using PType = std::list<IntersectionPoint>;
+  using LType = std::vector<Link>;
+  using PType = std::vector<IntersectionPoint>;
 
 public:
   /// Default constructor
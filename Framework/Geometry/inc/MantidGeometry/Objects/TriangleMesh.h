@@ -0,0 +1,72 @@
+#ifndef MANTID_GEOMETRY_TRIANGLEMESH_H_
+#define MANTID_GEOMETRY_TRIANGLEMESH_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+#include <cstddef>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/** TriangleMesh : A compiled, read-only triangle representation of a closed
+  shape used to accelerate ray intersection and solid angle calculations.
+
+  The triangles are stored as a structure of arrays (first vertex and the two
+  edges leaving it) so that the per-triangle kernels run as flat, branch-free
+  loops that the compiler can vectorize. A mesh is built once per shape and is
+  immutable afterwards, so it can be shared between copies of an Object and
+  used from multiple threads.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL TriangleMesh {
+public:
+  TriangleMesh(const std::vector<double> &vertices,
+               const std::vector<int> &faces);
+  TriangleMesh(const int nPoints, const double *vertices, const int nFaces,
+               const int *faces);
+
+  /// Returns the number of triangles in the mesh
+  size_t numberOfTriangles() const { return m_v0x.size(); }
+
+  void intersectionDistances(const Kernel::V3D &start,
+                             const Kernel::V3D &direction,
+                             std::vector<double> &distances) const;
+  double solidAngle(const Kernel::V3D &observer) const;
+
+private:
+  void compile(const int nPoints, const double *vertices, const int nFaces,
+               const int *faces);
+
+  /// First vertex of each triangle
+  std::vector<double> m_v0x, m_v0y, m_v0z;
+  /// Edge from the first to the second vertex of each triangle
+  std::vector<double> m_e1x, m_e1y, m_e1z;
+  /// Edge from the first to the third vertex of each triangle
+  std::vector<double> m_e2x, m_e2y, m_e2z;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_TRIANGLEMESH_H_ */
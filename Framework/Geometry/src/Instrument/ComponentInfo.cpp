@@ -1,4 +1,5 @@
 #include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorNeighbourIndex.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidGeometry/Objects/Object.h"
 #include "MantidGeometry/IComponent.h"
@@ -6,6 +7,7 @@
 #include "MantidKernel/EigenConversionHelpers.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/make_unique.h"
+#include <boost/make_shared.hpp>
 #include <exception>
 #include <string>
 #include <Eigen/Geometry>
@@ -81,7 +83,11 @@ ComponentInfo::ComponentInfo(const ComponentInfo &other)
     : m_componentInfo(
           Kernel::make_unique<Beamline::ComponentInfo>(*other.m_componentInfo)),
       m_componentIds(other.m_componentIds),
-      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes) {}
+      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes) {
+  std::lock_guard<std::mutex> lock(other.m_neighbourIndexMutex);
+  m_neighbourIndex = other.m_neighbourIndex;
+  m_neighbourIndexVersion = other.m_neighbourIndexVersion;
+}
 
 // Defined as default in source for forward declaration with std::unique_ptr.
 ComponentInfo::~ComponentInfo() = default;
@@ -166,6 +172,32 @@ void ComponentInfo::setRotation(const size_t componentIndex,
                                Kernel::toQuaterniond(newRotation));
 }
 
+/**
+ * Set the absolute positions and rotations of several components at once.
+ * Each affected subtree is transformed in a single pass and the batch is
+ * validated up front, so it either applies completely or not at all. Prefer
+ * this to repeated setPosition/setRotation calls when moving many components,
+ * e.g. in calibration.
+ * @param componentIndices : Indices of the components to update
+ * @param newPositions : Absolute positions, one per component index
+ * @param newRotations : Absolute rotations, one per component index
+ */
+void ComponentInfo::setPositionsAndRotations(
+    const std::vector<size_t> &componentIndices,
+    const std::vector<Kernel::V3D> &newPositions,
+    const std::vector<Kernel::Quat> &newRotations) {
+  std::vector<Eigen::Vector3d> positions;
+  positions.reserve(newPositions.size());
+  for (const auto &position : newPositions)
+    positions.push_back(Kernel::toVector3d(position));
+  std::vector<Eigen::Quaterniond> rotations;
+  rotations.reserve(newRotations.size());
+  for (const auto &rotation : newRotations)
+    rotations.push_back(Kernel::toQuaterniond(rotation));
+  m_componentInfo->setPositionsAndRotations(componentIndices, positions,
+                                            rotations);
+}
+
 const Object &ComponentInfo::shape(const size_t componentIndex) const {
   return *(*m_shapes)[componentIndex];
 }
@@ -329,5 +361,24 @@ bool ComponentInfo::isStructuredBank(const size_t componentIndex) const {
   return m_componentInfo->isStructuredBank(componentIndex);
 }
 
+/**
+ * Returns a spatial index over the detectors for neighbour searches. The index
+ * is built on first use and shared with copies of this ComponentInfo, e.g.
+ * between workspaces with the same instrument. It is rebuilt if any detector
+ * has moved since it was built. Scanning instruments are not supported, the
+ * index holds the positions of the first time index only.
+ */
+boost::shared_ptr<const DetectorNeighbourIndex>
+ComponentInfo::neighbourIndex() const {
+  std::lock_guard<std::mutex> lock(m_neighbourIndexMutex);
+  // Detectors may also be moved via DetectorInfo, which changes the version
+  const auto version = m_componentInfo->detectorPositionsVersion();
+  if (!m_neighbourIndex || version != m_neighbourIndexVersion) {
+    m_neighbourIndex = boost::make_shared<const DetectorNeighbourIndex>(*this);
+    m_neighbourIndexVersion = version;
+  }
+  return m_neighbourIndex;
+}
+
 } // namespace Geometry
 } // namespace Mantid
@@ -0,0 +1,389 @@
+#include "MantidGeometry/Instrument/DetectorNeighbourIndex.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Candidate neighbour: squared distance and detector index. Ties in distance
+/// are broken by the lower detector index so results are deterministic.
+using Candidate = std::pair<double, size_t>;
+
+/// State shared by the recursive k-d tree searches
+struct Search {
+  const double *positions;
+  const size_t *tree;
+  const uint8_t *splitAxis;
+  const std::vector<bool> *excluded;
+  double query[3];
+  double invScale[3];
+
+  bool accept(const size_t detectorIndex, const double distanceSq) const {
+    // As with ANN, points coincident with the query are not reported
+    return distanceSq > 0.0 &&
+           !(excluded && (*excluded)[detectorIndex]);
+  }
+
+  double scaledDistanceSq(const size_t detectorIndex) const {
+    const double *p = positions + 3 * detectorIndex;
+    double distanceSq(0.0);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const double delta = (p[axis] - query[axis]) * invScale[axis];
+      distanceSq += delta * delta;
+    }
+    return distanceSq;
+  }
+
+  double scaledPlaneOffset(const size_t node) const {
+    const size_t axis = splitAxis[node];
+    return (query[axis] - positions[3 * tree[node] + axis]) * invScale[axis];
+  }
+
+  void nearest(const size_t begin, const size_t end, const size_t k,
+               std::priority_queue<Candidate> &best) const {
+    if (begin >= end)
+      return;
+    const size_t mid = begin + (end - begin) / 2;
+    const size_t detectorIndex = tree[mid];
+    const double distanceSq = scaledDistanceSq(detectorIndex);
+    if (accept(detectorIndex, distanceSq)) {
+      const Candidate candidate(distanceSq, detectorIndex);
+      if (best.size() < k) {
+        best.push(candidate);
+      } else if (candidate < best.top()) {
+        best.pop();
+        best.push(candidate);
+      }
+    }
+    if (end - begin == 1)
+      return;
+    const double offset = scaledPlaneOffset(mid);
+    const bool leftFirst = offset < 0.0;
+    nearest(leftFirst ? begin : mid + 1, leftFirst ? mid : end, k, best);
+    if (best.size() < k || offset * offset <= best.top().first)
+      nearest(leftFirst ? mid + 1 : begin, leftFirst ? end : mid, k, best);
+  }
+
+  void withinRadius(const size_t begin, const size_t end,
+                    const double radiusSq,
+                    std::vector<Candidate> &found) const {
+    if (begin >= end)
+      return;
+    const size_t mid = begin + (end - begin) / 2;
+    const size_t detectorIndex = tree[mid];
+    const double distanceSq = scaledDistanceSq(detectorIndex);
+    if (distanceSq <= radiusSq && accept(detectorIndex, distanceSq))
+      found.emplace_back(distanceSq, detectorIndex);
+    if (end - begin == 1)
+      return;
+    const double offset = scaledPlaneOffset(mid);
+    if (offset <= 0.0 || offset * offset <= radiusSq)
+      withinRadius(begin, mid, radiusSq, found);
+    if (offset >= 0.0 || offset * offset <= radiusSq)
+      withinRadius(mid + 1, end, radiusSq, found);
+  }
+};
+
+std::vector<size_t> toIndices(std::vector<Candidate> &candidates) {
+  std::sort(candidates.begin(), candidates.end());
+  std::vector<size_t> indices;
+  indices.reserve(candidates.size());
+  for (const auto &candidate : candidates)
+    indices.push_back(candidate.second);
+  return indices;
+}
+}
+
+/**
+ * Build the index from the current detector positions
+ * @param componentInfo :: ComponentInfo of the instrument. Its detectors must
+ * not be scanning.
+ */
+DetectorNeighbourIndex::DetectorNeighbourIndex(
+    const ComponentInfo &componentInfo) {
+  size_t nDetectors(0);
+  while (nDetectors < componentInfo.size() &&
+         componentInfo.isDetector(nDetectors))
+    ++nDetectors;
+
+  m_positions.reserve(3 * nDetectors);
+  for (size_t i = 0; i < nDetectors; ++i) {
+    const auto pos = componentInfo.position(i);
+    m_positions.push_back(pos.X());
+    m_positions.push_back(pos.Y());
+    m_positions.push_back(pos.Z());
+  }
+
+  m_tree.resize(nDetectors);
+  for (size_t i = 0; i < nDetectors; ++i)
+    m_tree[i] = i;
+  m_splitAxis.resize(nDetectors, 0);
+  buildTree(0, nDetectors);
+
+  // Structured banks hold one assembly per column with the pixels of the
+  // column in order of y. The subtree lists the detectors in that order
+  // whatever their IDs, so the grid does not depend on how IDs were filled.
+  m_bankOfDetector.resize(nDetectors, -1);
+  m_gridOffset.resize(nDetectors, 0);
+  for (size_t i = nDetectors; i < componentInfo.size(); ++i) {
+    if (!componentInfo.isStructuredBank(i))
+      continue;
+    auto detectors = componentInfo.detectorsInSubtree(i);
+    // The subtree holds the detectors, the columns and the bank itself
+    const size_t nComponents = componentInfo.componentsInSubtree(i).size();
+    if (detectors.empty() || nComponents <= detectors.size() + 1)
+      continue;
+    const size_t nX = nComponents - detectors.size() - 1;
+    if (detectors.size() % nX != 0)
+      continue;
+    const auto bankIndex = static_cast<int32_t>(m_banks.size());
+    for (size_t offset = 0; offset < detectors.size(); ++offset) {
+      m_bankOfDetector[detectors[offset]] = bankIndex;
+      m_gridOffset[detectors[offset]] = offset;
+    }
+    const size_t nY = detectors.size() / nX;
+    m_banks.push_back({std::move(detectors), nX, nY});
+  }
+}
+
+/// Returns the position of the detector at the time the index was built
+Kernel::V3D DetectorNeighbourIndex::position(const size_t detectorIndex) const {
+  checkIndex(detectorIndex);
+  const double *p = m_positions.data() + 3 * detectorIndex;
+  return Kernel::V3D(p[0], p[1], p[2]);
+}
+
+/**
+ * Check whether the index is still valid for the given ComponentInfo, i.e.
+ * it has the same detectors at the same positions. This compares every
+ * position, ComponentInfo::neighbourIndex() tracks moves more cheaply.
+ * @param componentInfo :: The ComponentInfo to compare against
+ * @return True if the index can be used with componentInfo
+ */
+bool DetectorNeighbourIndex::matches(const ComponentInfo &componentInfo) const {
+  const size_t nDetectors = size();
+  if (componentInfo.size() < nDetectors ||
+      (nDetectors > 0 && !componentInfo.isDetector(nDetectors - 1)) ||
+      (componentInfo.size() > nDetectors &&
+       componentInfo.isDetector(nDetectors)))
+    return false;
+  for (size_t i = 0; i < nDetectors; ++i) {
+    const auto pos = componentInfo.position(i);
+    const double *p = m_positions.data() + 3 * i;
+    if (pos.X() != p[0] || pos.Y() != p[1] || pos.Z() != p[2])
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Find the k nearest detectors to a detector
+ * @param detectorIndex :: Index of the detector to search around
+ * @param k :: Maximum number of neighbours to return
+ * @param excluded :: Optional flags, one per detector, of detectors that must
+ * not be returned, e.g. monitors or masked detectors
+ * @param scale :: Distances along each axis are divided by this before
+ * comparing, e.g. to measure them in units of pixel size
+ * @return Detector indices ordered by increasing distance. Detectors at the
+ * same position as the query are not returned.
+ */
+std::vector<size_t>
+DetectorNeighbourIndex::nearest(const size_t detectorIndex, const size_t k,
+                                const std::vector<bool> *excluded,
+                                const Kernel::V3D &scale) const {
+  return nearest(std::vector<size_t>(1, detectorIndex), k, excluded, scale)
+      .front();
+}
+
+/**
+ * Find the k nearest detectors to each of the given detectors. The queries
+ * run in parallel.
+ * @param detectorIndices :: Indices of the detectors to search around
+ * @param k :: Maximum number of neighbours to return per detector
+ * @param excluded :: Optional flags, one per detector, of detectors that must
+ * not be returned
+ * @param scale :: Distances along each axis are divided by this before
+ * comparing
+ * @return For each query, detector indices ordered by increasing distance
+ */
+std::vector<std::vector<size_t>> DetectorNeighbourIndex::nearest(
+    const std::vector<size_t> &detectorIndices, const size_t k,
+    const std::vector<bool> *excluded, const Kernel::V3D &scale) const {
+  if (excluded && excluded->size() != size())
+    throw std::invalid_argument("DetectorNeighbourIndex::nearest - excluded "
+                                "flags do not match the number of detectors");
+  if (scale.X() <= 0.0 || scale.Y() <= 0.0 || scale.Z() <= 0.0)
+    throw std::invalid_argument(
+        "DetectorNeighbourIndex::nearest - scale must be positive");
+  for (const auto detectorIndex : detectorIndices)
+    checkIndex(detectorIndex);
+
+  std::vector<std::vector<size_t>> results(detectorIndices.size());
+  const auto nQueries = static_cast<int64_t>(detectorIndices.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nQueries; ++i) {
+    Search search{m_positions.data(),
+                  m_tree.data(),
+                  m_splitAxis.data(),
+                  excluded,
+                  {0.0, 0.0, 0.0},
+                  {1.0 / scale.X(), 1.0 / scale.Y(), 1.0 / scale.Z()}};
+    const double *q = m_positions.data() + 3 * detectorIndices[i];
+    std::copy(q, q + 3, search.query);
+    std::priority_queue<Candidate> best;
+    if (k > 0)
+      search.nearest(0, m_tree.size(), k, best);
+    std::vector<Candidate> found;
+    found.reserve(best.size());
+    while (!best.empty()) {
+      found.push_back(best.top());
+      best.pop();
+    }
+    results[i] = toIndices(found);
+  }
+  return results;
+}
+
+/**
+ * Find all detectors within a given distance of a detector
+ * @param detectorIndex :: Index of the detector to search around
+ * @param radius :: The maximum distance
+ * @param excluded :: Optional flags, one per detector, of detectors that must
+ * not be returned
+ * @return Detector indices ordered by increasing distance. Detectors at the
+ * same position as the query are not returned.
+ */
+std::vector<size_t>
+DetectorNeighbourIndex::withinRadius(const size_t detectorIndex,
+                                     const double radius,
+                                     const std::vector<bool> *excluded) const {
+  return withinRadius(std::vector<size_t>(1, detectorIndex), radius, excluded)
+      .front();
+}
+
+/**
+ * Find all detectors within a given distance of each of the given detectors.
+ * The queries run in parallel.
+ * @param detectorIndices :: Indices of the detectors to search around
+ * @param radius :: The maximum distance
+ * @param excluded :: Optional flags, one per detector, of detectors that must
+ * not be returned
+ * @return For each query, detector indices ordered by increasing distance
+ */
+std::vector<std::vector<size_t>> DetectorNeighbourIndex::withinRadius(
+    const std::vector<size_t> &detectorIndices, const double radius,
+    const std::vector<bool> *excluded) const {
+  if (excluded && excluded->size() != size())
+    throw std::invalid_argument("DetectorNeighbourIndex::withinRadius - "
+                                "excluded flags do not match the number of "
+                                "detectors");
+  if (radius < 0.0)
+    throw std::invalid_argument(
+        "DetectorNeighbourIndex::withinRadius - radius must not be negative");
+  for (const auto detectorIndex : detectorIndices)
+    checkIndex(detectorIndex);
+
+  std::vector<std::vector<size_t>> results(detectorIndices.size());
+  const auto nQueries = static_cast<int64_t>(detectorIndices.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nQueries; ++i) {
+    Search search{m_positions.data(), m_tree.data(), m_splitAxis.data(),
+                  excluded,           {0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+    const double *q = m_positions.data() + 3 * detectorIndices[i];
+    std::copy(q, q + 3, search.query);
+    std::vector<Candidate> found;
+    search.withinRadius(0, m_tree.size(), radius * radius, found);
+    results[i] = toIndices(found);
+  }
+  return results;
+}
+
+/// Returns true if the detector is part of a structured bank
+bool DetectorNeighbourIndex::isInGrid(const size_t detectorIndex) const {
+  checkIndex(detectorIndex);
+  return m_bankOfDetector[detectorIndex] >= 0;
+}
+
+/**
+ * Find the detectors in a rectangular window of a structured bank using the
+ * grid topology, no distances are computed.
+ * @param detectorIndex :: Index of the detector at the centre of the window
+ * @param halfWidthX :: Number of pixels either side along the bank's x axis
+ * @param halfWidthY :: Number of pixels either side along the bank's y axis
+ * @return Detector indices in the window ordered by x then y, including
+ * detectorIndex itself, clipped at the edges of the bank
+ * @throw std::invalid_argument if the detector is not in a structured bank
+ */
+std::vector<size_t>
+DetectorNeighbourIndex::gridNeighbours(const size_t detectorIndex,
+                                       const size_t halfWidthX,
+                                       const size_t halfWidthY) const {
+  if (!isInGrid(detectorIndex))
+    throw std::invalid_argument("DetectorNeighbourIndex::gridNeighbours - "
+                                "detector is not part of a structured bank");
+  const auto &bank = m_banks[m_bankOfDetector[detectorIndex]];
+  const size_t x = m_gridOffset[detectorIndex] / bank.nY;
+  const size_t y = m_gridOffset[detectorIndex] % bank.nY;
+  const size_t xMin = x > halfWidthX ? x - halfWidthX : 0;
+  const size_t xMax = std::min(x + halfWidthX, bank.nX - 1);
+  const size_t yMin = y > halfWidthY ? y - halfWidthY : 0;
+  const size_t yMax = std::min(y + halfWidthY, bank.nY - 1);
+  std::vector<size_t> neighbours;
+  neighbours.reserve((xMax - xMin + 1) * (yMax - yMin + 1));
+  for (size_t ix = xMin; ix <= xMax; ++ix)
+    for (size_t iy = yMin; iy <= yMax; ++iy)
+      neighbours.push_back(bank.detectors[ix * bank.nY + iy]);
+  return neighbours;
+}
+
+/**
+ * Arrange m_tree[begin, end) as a balanced k-d tree: the median along the
+ * axis of largest spread is stored in the middle and the two halves are
+ * arranged recursively.
+ */
+void DetectorNeighbourIndex::buildTree(const size_t begin, const size_t end) {
+  if (end - begin <= 1)
+    return;
+  double low[3], high[3];
+  for (size_t axis = 0; axis < 3; ++axis)
+    low[axis] = high[axis] = m_positions[3 * m_tree[begin] + axis];
+  for (size_t i = begin + 1; i < end; ++i) {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const double value = m_positions[3 * m_tree[i] + axis];
+      low[axis] = std::min(low[axis], value);
+      high[axis] = std::max(high[axis], value);
+    }
+  }
+  uint8_t splitAxis(0);
+  for (uint8_t axis = 1; axis < 3; ++axis)
+    if (high[axis] - low[axis] > high[splitAxis] - low[splitAxis])
+      splitAxis = axis;
+
+  const size_t mid = begin + (end - begin) / 2;
+  const double *positions = m_positions.data();
+  std::nth_element(m_tree.begin() + begin, m_tree.begin() + mid,
+                   m_tree.begin() + end,
+                   [positions, splitAxis](const size_t a, const size_t b) {
+                     return positions[3 * a + splitAxis] <
+                            positions[3 * b + splitAxis];
+                   });
+  m_splitAxis[mid] = splitAxis;
+  buildTree(begin, mid);
+  buildTree(mid + 1, end);
+}
+
+/// Throw if the detector index is out of range
+void DetectorNeighbourIndex::checkIndex(const size_t detectorIndex) const {
+  if (detectorIndex >= size())
+    throw std::out_of_range(
+        "DetectorNeighbourIndex - detector index out of range");
+}
+
+} // namespace Geometry
+} // namespace Mantid
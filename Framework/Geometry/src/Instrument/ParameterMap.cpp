@@ -10,6 +10,7 @@
 #include <cstring>
 #include <nexus/NeXusFile.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/make_shared.hpp>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -56,19 +57,19 @@ void checkIsNotMaskingParameter(const std::string &name) {
  * Default constructor
  */
 ParameterMap::ParameterMap()
-    : m_cacheLocMap(
+    : m_map(boost::make_shared<pmap>()),
+      m_cacheLocMap(
           Kernel::make_unique<Kernel::Cache<const ComponentID, Kernel::V3D>>()),
       m_cacheRotMap(Kernel::make_unique<
           Kernel::Cache<const ComponentID, Kernel::Quat>>()) {}
 
 ParameterMap::ParameterMap(const ParameterMap &other)
-    : m_parameterFileNames(other.m_parameterFileNames), m_map(other.m_map),
+    : m_parameterFileNames(other.m_parameterFileNames),
+      m_map(boost::atomic_load(&other.m_map)),
       m_cacheLocMap(
-          Kernel::make_unique<Kernel::Cache<const ComponentID, Kernel::V3D>>(
-              *other.m_cacheLocMap)),
-      m_cacheRotMap(
-          Kernel::make_unique<Kernel::Cache<const ComponentID, Kernel::Quat>>(
-              *other.m_cacheRotMap)),
+          Kernel::make_unique<Kernel::Cache<const ComponentID, Kernel::V3D>>()),
+      m_cacheRotMap(Kernel::make_unique<
+          Kernel::Cache<const ComponentID, Kernel::Quat>>()),
       m_instrument(other.m_instrument) {
   if (m_instrument)
     std::tie(m_componentInfo, m_detectorInfo) =
@@ -78,6 +79,47 @@ ParameterMap::ParameterMap(const ParameterMap &other)
 // Defined as default in source for forward declaration with std::unique_ptr.
 ParameterMap::~ParameterMap() = default;
 
+/// Clears the map
+void ParameterMap::clear() {
+  {
+    std::lock_guard<std::mutex> lock(m_mapMutex);
+    boost::atomic_store(&m_map, boost::make_shared<pmap>());
+  }
+  clearPositionSensitiveCaches();
+}
+
+/// Swaps the contents of two parameter maps. The caches of this map are
+/// cleared.
+void ParameterMap::swap(ParameterMap &other) {
+  if (this == &other)
+    return;
+  {
+    std::lock(m_mapMutex, other.m_mapMutex);
+    std::lock_guard<std::mutex> lock(m_mapMutex, std::adopt_lock);
+    std::lock_guard<std::mutex> otherLock(other.m_mapMutex, std::adopt_lock);
+    auto map = boost::atomic_load(&m_map);
+    boost::atomic_store(&m_map, boost::atomic_load(&other.m_map));
+    boost::atomic_store(&other.m_map, std::move(map));
+  }
+  clearPositionSensitiveCaches();
+}
+
+/**
+ * Returns the parameters for modification, copying them first if they are
+ * shared with another ParameterMap. Readers on other threads keep the
+ * parameters they loaded through map(), so the copy never frees data they
+ * are using.
+ * @return The parameters owned by this map alone
+ */
+ParameterMap::pmap &ParameterMap::mutableMap() {
+  std::lock_guard<std::mutex> lock(m_mapMutex);
+  // Only writers replace m_map and they hold the lock, so it can be read
+  // directly here
+  if (!m_map.unique())
+    boost::atomic_store(&m_map, boost::make_shared<pmap>(*m_map));
+  return *m_map;
+}
+
 /**
 * Return string to be inserted into the parameter map
 */
@@ -143,14 +185,16 @@ bool ParameterMap::operator==(const ParameterMap &rhs) const {
   // asString method turns the ComponentIDs to full-qualified name identifiers
   // so we will use the same approach to compare them
 
-  auto thisEnd = this->m_map.cend();
-  auto rhsEnd = rhs.m_map.cend();
-  for (auto thisIt = this->m_map.begin(); thisIt != thisEnd; ++thisIt) {
+  const auto thisMap = this->map();
+  const auto rhsMap = rhs.map();
+  auto thisEnd = thisMap->cend();
+  auto rhsEnd = rhsMap->cend();
+  for (auto thisIt = thisMap->begin(); thisIt != thisEnd; ++thisIt) {
     const IComponent *comp = static_cast<IComponent *>(thisIt->first);
     const std::string fullName = comp->getFullName();
     const auto &param = thisIt->second;
     bool match(false);
-    for (auto rhsIt = rhs.m_map.cbegin(); rhsIt != rhsEnd; ++rhsIt) {
+    for (auto rhsIt = rhsMap->cbegin(); rhsIt != rhsEnd; ++rhsIt) {
       const IComponent *rhsComp = static_cast<IComponent *>(rhsIt->first);
       const std::string rhsFullName = rhsComp->getFullName();
       if (fullName == rhsFullName && (*param) == (*rhsIt->second)) {
@@ -173,9 +217,10 @@ bool ParameterMap::operator==(const ParameterMap &rhs) const {
 */
 const std::string ParameterMap::getDescription(const std::string &compName,
                                                const std::string &name) const {
+  const auto map = this->map();
   pmap_cit it;
   std::string result;
-  for (it = m_map.begin(); it != m_map.end(); ++it) {
+  for (it = map->begin(); it != map->end(); ++it) {
     if (compName == it->first->getName()) {
       boost::shared_ptr<Parameter> param = get(it->first, name);
       if (param) {
@@ -197,9 +242,10 @@ const std::string ParameterMap::getDescription(const std::string &compName,
 const std::string
 ParameterMap::getShortDescription(const std::string &compName,
                                   const std::string &name) const {
+  const auto map = this->map();
   pmap_cit it;
   std::string result;
-  for (it = m_map.begin(); it != m_map.end(); ++it) {
+  for (it = map->begin(); it != map->end(); ++it) {
     if (compName == it->first->getName()) {
       boost::shared_ptr<Parameter> param = get(it->first, name);
       if (param) {
@@ -240,14 +286,16 @@ const std::string ParameterMap::diff(const ParameterMap &rhs,
   // so we will use the same approach to compare them
 
   std::stringstream strOutput;
-  auto thisEnd = this->m_map.cend();
-  auto rhsEnd = rhs.m_map.cend();
-  for (auto thisIt = this->m_map.cbegin(); thisIt != thisEnd; ++thisIt) {
+  const auto thisMap = this->map();
+  const auto rhsMap = rhs.map();
+  auto thisEnd = thisMap->cend();
+  auto rhsEnd = rhsMap->cend();
+  for (auto thisIt = thisMap->cbegin(); thisIt != thisEnd; ++thisIt) {
     const IComponent *comp = static_cast<IComponent *>(thisIt->first);
     const std::string fullName = comp->getFullName();
     const auto &param = thisIt->second;
     bool match(false);
-    for (auto rhsIt = rhs.m_map.cbegin(); rhsIt != rhsEnd; ++rhsIt) {
+    for (auto rhsIt = rhsMap->cbegin(); rhsIt != rhsEnd; ++rhsIt) {
       const IComponent *rhsComp = static_cast<IComponent *>(rhsIt->first);
       const std::string rhsFullName = rhsComp->getFullName();
       if (fullName == rhsFullName && (*param) == (*rhsIt->second)) {
@@ -264,7 +312,7 @@ const std::string ParameterMap::diff(const ParameterMap &rhs,
                 << " and value: " << (*param).asString() << '\n';
       bool componentWithSameNameRHS = false;
       bool parameterWithSameNameRHS = false;
-      for (auto rhsIt = rhs.m_map.cbegin(); rhsIt != rhsEnd; ++rhsIt) {
+      for (auto rhsIt = rhsMap->cbegin(); rhsIt != rhsEnd; ++rhsIt) {
         const IComponent *rhsComp = static_cast<IComponent *>(rhsIt->first);
         const std::string rhsFullName = rhsComp->getFullName();
         if (fullName == rhsFullName) {
@@ -296,10 +344,11 @@ const std::string ParameterMap::diff(const ParameterMap &rhs,
  */
 void ParameterMap::clearParametersByName(const std::string &name) {
   checkIsNotMaskingParameter(name);
+  auto &map = mutableMap();
   // Key is component ID so have to search through whole lot
-  for (auto itr = m_map.begin(); itr != m_map.end();) {
+  for (auto itr = map.begin(); itr != map.end();) {
     if (itr->second->name() == name) {
-      PARALLEL_CRITICAL(unsafe_erase) { itr = m_map.unsafe_erase(itr); }
+      PARALLEL_CRITICAL(unsafe_erase) { itr = map.unsafe_erase(itr); }
     } else {
       ++itr;
     }
@@ -317,12 +366,13 @@ void ParameterMap::clearParametersByName(const std::string &name) {
 void ParameterMap::clearParametersByName(const std::string &name,
                                          const IComponent *comp) {
   checkIsNotMaskingParameter(name);
-  if (!m_map.empty()) {
+  if (!empty()) {
+    auto &map = mutableMap();
     const ComponentID id = comp->getComponentID();
-    auto itrs = m_map.equal_range(id);
+    auto itrs = map.equal_range(id);
     for (auto it = itrs.first; it != itrs.second;) {
       if (it->second->name() == name) {
-        PARALLEL_CRITICAL(unsafe_erase) { it = m_map.unsafe_erase(it); }
+        PARALLEL_CRITICAL(unsafe_erase) { it = map.unsafe_erase(it); }
       } else {
         ++it;
       }
@@ -374,13 +424,14 @@ void ParameterMap::add(const IComponent *comp,
   if (pDescription)
     par->setDescription(*pDescription);
 
-  auto existing_par = positionOf(comp, par->name().c_str(), "");
+  auto &map = mutableMap();
+  auto existing_par = positionOf(map, comp, par->name().c_str(), "");
   // As this is only an add method it should really throw if it already
   // exists.
   // However, this is old behavior and many things rely on this actually be
   // an
   // add/replace-style function
-  if (existing_par != m_map.end()) {
+  if (existing_par != map.end()) {
     boost::atomic_store(&(existing_par->second), par);
   } else {
 // When using Clang & Linux, TBB 4.4 doesn't detect C++11 features.
@@ -391,9 +442,9 @@ void ParameterMap::add(const IComponent *comp,
 #define CLANG_ON_LINUX false
 #endif
 #if TBB_VERSION_MAJOR >= 4 && TBB_VERSION_MINOR >= 4 && !CLANG_ON_LINUX
-    m_map.emplace(comp->getComponentID(), par);
+    map.emplace(comp->getComponentID(), par);
 #else
-    m_map.insert(std::make_pair(comp->getComponentID(), par));
+    map.insert(std::make_pair(comp->getComponentID(), par));
 #endif
   }
 }
@@ -630,9 +681,9 @@ void ParameterMap::forceUnsafeSetMasked(const IComponent *comp, bool value) {
 #define CLANG_ON_LINUX false
 #endif
 #if TBB_VERSION_MAJOR >= 4 && TBB_VERSION_MINOR >= 4 && !CLANG_ON_LINUX
-  m_map.emplace(comp->getComponentID(), param);
+  mutableMap().emplace(comp->getComponentID(), param);
 #else
-  m_map.insert(std::make_pair(comp->getComponentID(), param));
+  mutableMap().insert(std::make_pair(comp->getComponentID(), param));
 #endif
 }
 
@@ -732,10 +783,11 @@ bool ParameterMap::contains(const IComponent *comp, const std::string &name,
 bool ParameterMap::contains(const IComponent *comp, const char *name,
                             const char *type) const {
   checkIsNotMaskingParameter(name);
-  if (m_map.empty())
+  const auto map = this->map();
+  if (map->empty())
     return false;
   const ComponentID id = comp->getComponentID();
-  std::pair<pmap_cit, pmap_cit> components = m_map.equal_range(id);
+  std::pair<pmap_cit, pmap_cit> components = map->equal_range(id);
   bool anytype = (strlen(type) == 0);
   for (auto itr = components.first; itr != components.second; ++itr) {
     const auto &param = itr->second;
@@ -755,13 +807,14 @@ bool ParameterMap::contains(const IComponent *comp, const char *name,
 bool ParameterMap::contains(const IComponent *comp,
                             const Parameter &parameter) const {
   checkIsNotMaskingParameter(parameter.name());
-  if (m_map.empty() || !comp)
+  const auto map = this->map();
+  if (map->empty() || !comp)
     return false;
 
   const ComponentID id = comp->getComponentID();
-  auto it_found = m_map.find(id);
-  if (it_found != m_map.end()) {
-    auto itrs = m_map.equal_range(id);
+  auto it_found = map->find(id);
+  if (it_found != map->end()) {
+    auto itrs = map->equal_range(id);
     for (auto itr = itrs.first; itr != itrs.second; ++itr) {
       const Parameter_sptr &param = itr->second;
       if (*param == parameter)
@@ -801,30 +854,33 @@ boost::shared_ptr<Parameter> ParameterMap::get(const IComponent *comp,
   if (!comp)
     return result;
 
-  auto itr = positionOf(comp, name, type);
-  if (itr != m_map.end())
+  const auto map = this->map();
+  auto itr = positionOf(*map, comp, name, type);
+  if (itr != map->end())
     result = boost::atomic_load(&itr->second);
   return result;
 }
 
 /**Return an iterator pointing to a named parameter of a given type.
+ * @param map :: The parameters to search, from mutableMap()
  * @param comp :: Component to which parameter is related
  * @param name :: Parameter name
  * @param type :: An optional type string. If empty, any type is returned
  * @returns The iterator parameter of the given type if it exists or a NULL
  * shared pointer if not
 */
-component_map_it ParameterMap::positionOf(const IComponent *comp,
-                                          const char *name, const char *type) {
-  auto result = m_map.end();
+component_map_it ParameterMap::positionOf(pmap &map, const IComponent *comp,
+                                          const char *name,
+                                          const char *type) const {
+  auto result = map.end();
   if (!comp)
     return result;
   const bool anytype = (strlen(type) == 0);
-  if (!m_map.empty()) {
+  if (!map.empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
+    auto it_found = map.find(id);
+    if (it_found != map.end()) {
+      auto itrs = map.equal_range(id);
       for (auto itr = itrs.first; itr != itrs.second; ++itr) {
         const auto &param = itr->second;
         if (strcasecmp(param->nameAsCString(), name) == 0 &&
@@ -839,24 +895,26 @@ component_map_it ParameterMap::positionOf(const IComponent *comp,
 }
 
 /**Return a const iterator pointing to a named parameter of a given type.
+ * @param map :: The parameters to search, from map()
  * @param comp :: Component to which parameter is related
  * @param name :: Parameter name
  * @param type :: An optional type string. If empty, any type is returned
  * @returns The iterator parameter of the given type if it exists or a NULL
  * shared pointer if not
 */
-component_map_cit ParameterMap::positionOf(const IComponent *comp,
+component_map_cit ParameterMap::positionOf(const pmap &map,
+                                           const IComponent *comp,
                                            const char *name,
                                            const char *type) const {
-  auto result = m_map.end();
+  auto result = map.end();
   if (!comp)
     return result;
   const bool anytype = (strlen(type) == 0);
-  if (!m_map.empty()) {
+  if (!map.empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end()) {
-      auto itrs = m_map.equal_range(id);
+    auto it_found = map.find(id);
+    if (it_found != map.end()) {
+      auto itrs = map.equal_range(id);
       for (auto itr = itrs.first; itr != itrs.second; ++itr) {
         const auto &param = itr->second;
         if (strcasecmp(param->nameAsCString(), name) == 0 &&
@@ -878,11 +936,12 @@ component_map_cit ParameterMap::positionOf(const IComponent *comp,
 Parameter_sptr ParameterMap::getByType(const IComponent *comp,
                                        const std::string &type) const {
   Parameter_sptr result;
-  if (!m_map.empty()) {
+  const auto map = this->map();
+  if (!map->empty()) {
     const ComponentID id = comp->getComponentID();
-    auto it_found = m_map.find(id);
-    if (it_found != m_map.end() && it_found->first) {
-      auto itrs = m_map.equal_range(id);
+    auto it_found = map->find(id);
+    if (it_found != map->end() && it_found->first) {
+      auto itrs = map->equal_range(id);
       for (auto itr = itrs.first; itr != itrs.second; ++itr) {
         const auto &param = itr->second;
         if (strcasecmp(param->type().c_str(), type.c_str()) == 0) {
@@ -985,12 +1044,13 @@ std::string ParameterMap::getString(const IComponent *comp,
 std::set<std::string> ParameterMap::names(const IComponent *comp) const {
   std::set<std::string> paramNames;
   const ComponentID id = comp->getComponentID();
-  auto it_found = m_map.find(id);
-  if (it_found == m_map.end()) {
+  const auto map = this->map();
+  auto it_found = map->find(id);
+  if (it_found == map->end()) {
     return paramNames;
   }
 
-  auto itrs = m_map.equal_range(id);
+  auto itrs = map->equal_range(id);
   for (auto it = itrs.first; it != itrs.second; ++it) {
     paramNames.insert(it->second->name());
   }
@@ -1006,7 +1066,7 @@ std::set<std::string> ParameterMap::names(const IComponent *comp) const {
  */
 std::string ParameterMap::asString() const {
   std::stringstream out;
-  for (const auto &mappair : m_map) {
+  for (const auto &mappair : *map()) {
     const boost::shared_ptr<Parameter> &p = mappair.second;
     if (p && mappair.first) {
       const IComponent *comp = dynamic_cast<const IComponent *>(mappair.first);
@@ -1082,9 +1142,9 @@ void ParameterMap::copyFromParameterMap(const IComponent *oldComp,
     Parameter_sptr thisParameter = oldPMap->get(oldComp, oldParameterName);
 // Insert the fetched parameter in the m_map
 #if TBB_VERSION_MAJOR >= 4 && TBB_VERSION_MINOR >= 4 && !CLANG_ON_LINUX
-    m_map.emplace(newComp->getComponentID(), std::move(thisParameter));
+    mutableMap().emplace(newComp->getComponentID(), std::move(thisParameter));
 #else
-    m_map.insert(
+    mutableMap().insert(
         std::make_pair(newComp->getComponentID(), std::move(thisParameter)));
 #endif
   }
@@ -2,6 +2,7 @@
 
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Objects/TriangleMesh.h"
 #include "MantidGeometry/Rendering/CacheGeometryHandler.h"
 #include "MantidGeometry/Rendering/GeometryHandler.h"
 #include "MantidGeometry/Rendering/GluGeometryHandler.h"
@@ -43,6 +44,113 @@ using Kernel::Material;
 using Kernel::V3D;
 using Kernel::Quat;
 
+namespace {
+/// The number of facets around the axis of a meshed cylinder or sphere
+constexpr int MESH_SLICES = 64;
+/// The number of bands from pole to pole of a meshed sphere
+constexpr int MESH_STACKS = 32;
+
+/// Append a vertex to a flat array of coordinates
+void addVertex(std::vector<double> &vertices, const V3D &point) {
+  vertices.insert(vertices.end(), {point.X(), point.Y(), point.Z()});
+}
+
+/// Append the two triangles of the quadrilateral a, b, c, d
+void addQuad(std::vector<int> &faces, const int a, const int b, const int c,
+             const int d) {
+  faces.insert(faces.end(), {a, b, c, a, c, d});
+}
+
+/**
+ * Triangulate a hexahedron
+ * @param corners :: The bottom face followed by the top face, in the same
+ * order around both faces
+ * @param vertices :: [Out] The vertex coordinates
+ * @param faces :: [Out] The vertex indices of the triangles
+ */
+void meshHexahedron(const std::vector<V3D> &corners,
+                    std::vector<double> &vertices, std::vector<int> &faces) {
+  for (const auto &corner : corners)
+    addVertex(vertices, corner);
+  addQuad(faces, 0, 1, 2, 3);
+  addQuad(faces, 4, 5, 6, 7);
+  for (int i = 0; i < 4; ++i)
+    addQuad(faces, i, (i + 1) % 4, (i + 1) % 4 + 4, i + 4);
+}
+
+/**
+ * Triangulate a cylinder by inscribing a prism
+ * @param base :: The centre of the bottom face
+ * @param axis :: The unit axis
+ * @param radius :: The radius
+ * @param height :: The height
+ * @param vertices :: [Out] The vertex coordinates
+ * @param faces :: [Out] The vertex indices of the triangles
+ */
+void meshCylinder(const V3D &base, const V3D &axis, const double radius,
+                  const double height, std::vector<double> &vertices,
+                  std::vector<int> &faces) {
+  // Two unit vectors perpendicular to the axis and to each other
+  V3D u = axis.cross_prod(std::abs(axis.X()) < 0.9 ? V3D(1.0, 0.0, 0.0)
+                                                    : V3D(0.0, 1.0, 0.0));
+  u.normalize();
+  const V3D v = axis.cross_prod(u);
+  for (const double z : {0.0, height}) {
+    for (int i = 0; i < MESH_SLICES; ++i) {
+      const double phi = 2.0 * M_PI * i / MESH_SLICES;
+      addVertex(vertices, base + u * (radius * std::cos(phi)) +
+                              v * (radius * std::sin(phi)) + axis * z);
+    }
+  }
+  const int bottom = 2 * MESH_SLICES;
+  const int top = bottom + 1;
+  addVertex(vertices, base);
+  addVertex(vertices, base + axis * height);
+  for (int i = 0; i < MESH_SLICES; ++i) {
+    const int next = (i + 1) % MESH_SLICES;
+    addQuad(faces, i, next, next + MESH_SLICES, i + MESH_SLICES);
+    faces.insert(faces.end(), {bottom, next, i, top, i + MESH_SLICES,
+                               next + MESH_SLICES});
+  }
+}
+
+/**
+ * Triangulate a sphere by inscribing a polyhedron of latitude and longitude
+ * bands
+ * @param centre :: The centre
+ * @param radius :: The radius
+ * @param vertices :: [Out] The vertex coordinates
+ * @param faces :: [Out] The vertex indices of the triangles
+ */
+void meshSphere(const V3D &centre, const double radius,
+                std::vector<double> &vertices, std::vector<int> &faces) {
+  // The poles are the first and last vertices, the rings are in between
+  addVertex(vertices, centre + V3D(0.0, 0.0, radius));
+  for (int stack = 1; stack < MESH_STACKS; ++stack) {
+    const double theta = M_PI * stack / MESH_STACKS;
+    for (int i = 0; i < MESH_SLICES; ++i) {
+      const double phi = 2.0 * M_PI * i / MESH_SLICES;
+      addVertex(vertices, centre + V3D(radius * std::sin(theta) * std::cos(phi),
+                                       radius * std::sin(theta) * std::sin(phi),
+                                       radius * std::cos(theta)));
+    }
+  }
+  const int south = 1 + (MESH_STACKS - 1) * MESH_SLICES;
+  addVertex(vertices, centre - V3D(0.0, 0.0, radius));
+  const auto ring = [](const int stack, const int i) {
+    return 1 + (stack - 1) * MESH_SLICES + i % MESH_SLICES;
+  };
+  for (int i = 0; i < MESH_SLICES; ++i) {
+    faces.insert(faces.end(), {0, ring(1, i), ring(1, i + 1)});
+    for (int stack = 1; stack < MESH_STACKS - 1; ++stack)
+      addQuad(faces, ring(stack, i), ring(stack + 1, i),
+              ring(stack + 1, i + 1), ring(stack, i + 1));
+    faces.insert(faces.end(), {south, ring(MESH_STACKS - 1, i + 1),
+                               ring(MESH_STACKS - 1, i)});
+  }
+}
+} // namespace
+
 /**
 *  Default constuctor
 */
@@ -92,6 +200,7 @@ Object &Object::operator=(const Object &A) {
     m_shapeXML = A.m_shapeXML;
     m_id = A.m_id;
     m_material = Kernel::make_unique<Material>(A.material());
+    m_mesh = A.m_mesh;
 
     if (TopRule)
       createSurfaceList();
@@ -267,6 +376,7 @@ int Object::hasComplement() const {
 * @retval 0 :: successfully populated all the whole Object.
 */
 int Object::populate(const std::map<int, boost::shared_ptr<Surface>> &Smap) {
+  m_mesh.reset();
   std::deque<Rule *> Rst;
   Rst.push_back(TopRule.get());
   while (!Rst.empty()) {
@@ -670,6 +780,7 @@ void Object::write(std::ostream &OX) const {
 */
 int Object::procString(const std::string &Line) {
   TopRule = nullptr;
+  m_mesh.reset();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0; // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
@@ -753,6 +864,9 @@ int Object::procString(const std::string &Line) {
 * @return Number of segments added
 */
 int Object::interceptSurface(Geometry::Track &UT) const {
+  if (m_mesh)
+    return interceptMesh(UT);
+
   int cnt = UT.count(); // Number of intersections original track
   // Loop over all the surfaces.
   LineIntersectVisit LI(UT.startPoint(), UT.direction());
@@ -778,6 +892,31 @@ int Object::interceptSurface(Geometry::Track &UT) const {
   return (UT.count() - cnt);
 }
 
+/**
+* Fill the track using the compiled triangle mesh. The mesh is closed so the
+* crossings alternate between entry and exit points, and the track starts
+* inside the mesh if it crosses it an odd number of times. The rules are not
+* used as they disagree with the mesh near curved surfaces.
+* @param UT :: Initial track
+* @return Number of segments added
+*/
+int Object::interceptMesh(Geometry::Track &UT) const {
+  int cnt = UT.count(); // Number of intersections original track
+  std::vector<double> distances;
+  m_mesh->intersectionDistances(UT.startPoint(), UT.direction(), distances);
+  if (distances.empty())
+    return 0;
+  bool inside = distances.size() % 2 == 1;
+  for (const auto distance : distances) {
+    UT.addPoint(inside ? -1 : 1, UT.startPoint() + UT.direction() * distance,
+                *this);
+    inside = !inside;
+  }
+  UT.buildLink();
+  // Return number of track segments added
+  return (UT.count() - cnt);
+}
+
 /**
 * Calculate if a point PT is a valid point on the track
 * @param Pt :: Point to calculate from.
@@ -809,6 +948,13 @@ int Object::calcValidType(const Kernel::V3D &Pt,
 * shape.
 */
 double Object::solidAngle(const Kernel::V3D &observer) const {
+  if (m_mesh) {
+    const BoundingBox &boundingBox = this->getBoundingBox();
+    if (boundingBox.isNonNull() && boundingBox.isPointInside(observer) &&
+        isValid(observer))
+      return isOnSide(observer) ? 2.0 * M_PI : 4.0 * M_PI;
+    return m_mesh->solidAngle(observer);
+  }
   if (this->NumberOfTriangles() > 30000)
     return rayTraceSolidAngle(observer);
   return triangleSolidAngle(observer);
@@ -948,6 +1094,81 @@ double Object::rayTraceSolidAngle(const Kernel::V3D &observer) const {
   return sum;
 }
 
+/**
+* Switch the compiled triangle-mesh representation on or off. When on,
+* interceptSurface and solidAngle work on the triangulation of the shape
+* rather than evaluating the rules over the surfaces, trading the exactness of
+* curved surfaces for speed. The mesh is built once here and shared with any
+* copies of this object; changing the shape discards it.
+* @param enable :: If true build the mesh, otherwise discard it
+* @return True if a mesh is now in use, false if disabled or if the shape
+* could not be triangulated
+*/
+bool Object::setMeshAcceleration(const bool enable) {
+  if (!enable) {
+    m_mesh.reset();
+    return false;
+  }
+  if (m_mesh)
+    return true;
+  const int nTriangles = this->NumberOfTriangles();
+  if (nTriangles > 0) {
+    m_mesh = boost::make_shared<const TriangleMesh>(
+        this->NumberOfPoints(), this->getTriangleVertices(), nTriangles,
+        this->getTriangleFaces());
+    return true;
+  }
+  // The known primitives are drawn directly rather than triangulated
+  std::vector<double> vertices;
+  std::vector<int> faces;
+  if (!meshPrimitive(vertices, faces))
+    return false;
+  m_mesh = boost::make_shared<const TriangleMesh>(vertices, faces);
+  return true;
+}
+
+/**
+* Triangulate the shape if it is one of the primitives of the
+* GluGeometryHandler. Cones are not supported.
+* @param vertices :: [Out] The vertex coordinates
+* @param faces :: [Out] The vertex indices of the triangles
+* @return True if the shape was triangulated
+*/
+bool Object::meshPrimitive(std::vector<double> &vertices,
+                           std::vector<int> &faces) const {
+  int type(0);
+  std::vector<V3D> points;
+  double radius(0.0), height(0.0);
+  this->GetObjectGeom(type, points, radius, height);
+  switch (static_cast<GluGeometryHandler::GeometryType>(type)) {
+  case GluGeometryHandler::GeometryType::CUBOID: {
+    // The corners are left-front-bottom, left-front-top, left-back-bottom
+    // and right-front-bottom
+    const V3D up = points[1] - points[0];
+    const V3D back = points[2] - points[0];
+    const V3D right = points[3] - points[0];
+    const V3D &origin = points[0];
+    meshHexahedron({origin + back, origin, origin + right,
+                    origin + right + back, origin + back + up, origin + up,
+                    origin + right + up, origin + right + up + back},
+                   vertices, faces);
+    return true;
+  }
+  case GluGeometryHandler::GeometryType::HEXAHEDRON:
+    meshHexahedron(points, vertices, faces);
+    return true;
+  case GluGeometryHandler::GeometryType::SPHERE:
+    meshSphere(points[0], radius, vertices, faces);
+    return true;
+  case GluGeometryHandler::GeometryType::CYLINDER:
+  case GluGeometryHandler::GeometryType::SEGMENTED_CYLINDER:
+    meshCylinder(points[0], points[1], radius, height, vertices, faces);
+    return true;
+  default:
+    return false;
+  }
+}
+
 /**
 * Find the solid angle of a triangle defined by vectors a,b,c from point
 *"observer"
@@ -2058,6 +2279,7 @@ void Object::setGeometryHandler(boost::shared_ptr<GeometryHandler> h) {
   if (h == nullptr)
     return;
   handle = h;
+  m_mesh.reset();
 }
 
 /**
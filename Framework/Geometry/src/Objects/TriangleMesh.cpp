@@ -0,0 +1,176 @@
+#include "MantidGeometry/Objects/TriangleMesh.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Geometry {
+
+using Kernel::V3D;
+
+namespace {
+/// Relative slack on the barycentric coordinates so that rays passing
+/// exactly through a shared edge are not lost between the two triangles
+constexpr double BARYCENTRIC_SLACK = 1e-10;
+/// Determinants smaller than this are treated as rays parallel to the plane
+constexpr double PARALLEL_TOLERANCE = 1e-14;
+}
+
+/**
+ * Construct a mesh from flat vertex and face arrays
+ * @param vertices :: Vertex coordinates stored as x0,y0,z0,x1,y1,z1,...
+ * @param faces :: Vertex indices for each triangle stored as i0,j0,k0,...
+ * @throw std::invalid_argument if the arrays are not whole triples or a face
+ * refers to a vertex that does not exist
+ */
+TriangleMesh::TriangleMesh(const std::vector<double> &vertices,
+                           const std::vector<int> &faces) {
+  if (vertices.size() % 3 != 0 || faces.size() % 3 != 0) {
+    throw std::invalid_argument(
+        "TriangleMesh - vertices and faces must be given as triples");
+  }
+  compile(static_cast<int>(vertices.size() / 3), vertices.data(),
+          static_cast<int>(faces.size() / 3), faces.data());
+}
+
+/**
+ * Construct a mesh from the raw arrays exposed by a GeometryHandler
+ * @param nPoints :: The number of vertices
+ * @param vertices :: Vertex coordinates stored as x0,y0,z0,x1,y1,z1,...
+ * @param nFaces :: The number of triangles
+ * @param faces :: Vertex indices for each triangle stored as i0,j0,k0,...
+ */
+TriangleMesh::TriangleMesh(const int nPoints, const double *vertices,
+                           const int nFaces, const int *faces) {
+  compile(nPoints, vertices, nFaces, faces);
+}
+
+/**
+ * Find the distances along a ray at which it crosses the surface of the mesh.
+ * Hits on shared edges are reported once.
+ * @param start :: The start point of the ray
+ * @param direction :: The unit direction of the ray
+ * @param distances :: [Out] Sorted, positive crossing distances. The vector is
+ * used as scratch space so reusing it between calls avoids reallocation.
+ */
+void TriangleMesh::intersectionDistances(const V3D &start,
+                                         const V3D &direction,
+                                         std::vector<double> &distances) const {
+  const size_t nTriangles = numberOfTriangles();
+  distances.resize(nTriangles);
+  const double ox(start.X()), oy(start.Y()), oz(start.Z());
+  const double dx(direction.X()), dy(direction.Y()), dz(direction.Z());
+  const double *v0x(m_v0x.data()), *v0y(m_v0y.data()), *v0z(m_v0z.data());
+  const double *e1x(m_e1x.data()), *e1y(m_e1y.data()), *e1z(m_e1z.data());
+  const double *e2x(m_e2x.data()), *e2y(m_e2y.data()), *e2z(m_e2z.data());
+  double *out = distances.data();
+  // Moller-Trumbore written without branches so that it vectorizes
+  for (size_t i = 0; i < nTriangles; ++i) {
+    const double px = dy * e2z[i] - dz * e2y[i];
+    const double py = dz * e2x[i] - dx * e2z[i];
+    const double pz = dx * e2y[i] - dy * e2x[i];
+    const double det = e1x[i] * px + e1y[i] * py + e1z[i] * pz;
+    const bool valid = std::abs(det) > PARALLEL_TOLERANCE;
+    const double invDet = 1.0 / (valid ? det : 1.0);
+    const double sx = ox - v0x[i];
+    const double sy = oy - v0y[i];
+    const double sz = oz - v0z[i];
+    const double u = (sx * px + sy * py + sz * pz) * invDet;
+    const double qx = sy * e1z[i] - sz * e1y[i];
+    const double qy = sz * e1x[i] - sx * e1z[i];
+    const double qz = sx * e1y[i] - sy * e1x[i];
+    const double v = (dx * qx + dy * qy + dz * qz) * invDet;
+    const double t = (e2x[i] * qx + e2y[i] * qy + e2z[i] * qz) * invDet;
+    const bool hit = valid && u >= -BARYCENTRIC_SLACK &&
+                     v >= -BARYCENTRIC_SLACK &&
+                     u + v <= 1.0 + BARYCENTRIC_SLACK && t > 0.0;
+    out[i] = hit ? t : -1.0;
+  }
+  distances.erase(std::remove_if(distances.begin(), distances.end(),
+                                 [](const double d) { return d <= 0.0; }),
+                  distances.end());
+  std::sort(distances.begin(), distances.end());
+  distances.erase(std::unique(distances.begin(), distances.end(),
+                              [](const double a, const double b) {
+                                return std::abs(a - b) < Kernel::Tolerance;
+                              }),
+                  distances.end());
+}
+
+/**
+ * Compute the solid angle subtended by the mesh at the given point. As with
+ * Object::triangleSolidAngle the triangle orientation is not relied upon, the
+ * absolute contributions are summed and halved, which is exact for convex
+ * shapes viewed from outside.
+ * @param observer :: The point from which the solid angle is required
+ * @return The solid angle in steradians
+ */
+double TriangleMesh::solidAngle(const V3D &observer) const {
+  const size_t nTriangles = numberOfTriangles();
+  const double ox(observer.X()), oy(observer.Y()), oz(observer.Z());
+  const double *v0x(m_v0x.data()), *v0y(m_v0y.data()), *v0z(m_v0z.data());
+  const double *e1x(m_e1x.data()), *e1y(m_e1y.data()), *e1z(m_e1z.data());
+  const double *e2x(m_e2x.data()), *e2y(m_e2y.data()), *e2z(m_e2z.data());
+  double total(0.0);
+  // Van Oosterom & Strackee: tan(O/2) = [a,b,c]/(abc+(a.b)c+(a.c)b+(b.c)a)
+  for (size_t i = 0; i < nTriangles; ++i) {
+    const double ax = v0x[i] - ox, ay = v0y[i] - oy, az = v0z[i] - oz;
+    const double bx = ax + e1x[i], by = ay + e1y[i], bz = az + e1z[i];
+    const double cx = ax + e2x[i], cy = ay + e2y[i], cz = az + e2z[i];
+    const double moda = std::sqrt(ax * ax + ay * ay + az * az);
+    const double modb = std::sqrt(bx * bx + by * by + bz * bz);
+    const double modc = std::sqrt(cx * cx + cy * cy + cz * cz);
+    const double ab = ax * bx + ay * by + az * bz;
+    const double ac = ax * cx + ay * cy + az * cz;
+    const double bc = bx * cx + by * cy + bz * cz;
+    const double tripleProduct = ax * (by * cz - bz * cy) +
+                                 ay * (bz * cx - bx * cz) +
+                                 az * (bx * cy - by * cx);
+    const double denom = moda * modb * modc + modc * ab + modb * ac + moda * bc;
+    total += (denom != 0.0) ? std::abs(2.0 * std::atan2(tripleProduct, denom))
+                            : 0.0;
+  }
+  return 0.5 * total;
+}
+
+/**
+ * Convert the indexed representation to per-triangle vertex/edge arrays
+ * @param nPoints :: The number of vertices
+ * @param vertices :: Vertex coordinates stored as x0,y0,z0,x1,y1,z1,...
+ * @param nFaces :: The number of triangles
+ * @param faces :: Vertex indices for each triangle stored as i0,j0,k0,...
+ */
+void TriangleMesh::compile(const int nPoints, const double *vertices,
+                           const int nFaces, const int *faces) {
+  const size_t nTriangles = nFaces > 0 ? static_cast<size_t>(nFaces) : 0;
+  for (auto *component : {&m_v0x, &m_v0y, &m_v0z, &m_e1x, &m_e1y, &m_e1z,
+                          &m_e2x, &m_e2y, &m_e2z}) {
+    component->reserve(nTriangles);
+  }
+  for (size_t i = 0; i < nTriangles; ++i) {
+    const int *face = faces + 3 * i;
+    for (size_t j = 0; j < 3; ++j) {
+      if (face[j] < 0 || face[j] >= nPoints) {
+        throw std::invalid_argument(
+            "TriangleMesh - face refers to a vertex outside of the mesh");
+      }
+    }
+    const double *p0 = vertices + 3 * face[0];
+    const double *p1 = vertices + 3 * face[1];
+    const double *p2 = vertices + 3 * face[2];
+    m_v0x.push_back(p0[0]);
+    m_v0y.push_back(p0[1]);
+    m_v0z.push_back(p0[2]);
+    m_e1x.push_back(p1[0] - p0[0]);
+    m_e1y.push_back(p1[1] - p0[1]);
+    m_e1z.push_back(p1[2] - p0[2]);
+    m_e2x.push_back(p2[0] - p0[0]);
+    m_e2y.push_back(p2[1] - p0[1]);
+    m_e2z.push_back(p2[2] - p0[2]);
+  }
+}
+
+} // namespace Geometry
+} // namespace Mantid
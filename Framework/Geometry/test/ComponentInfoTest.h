@@ -454,6 +454,30 @@ public:
     TS_ASSERT_DELTA(boundingBoxRoot.minPoint().Y(),
                     boundingBoxBank2.minPoint().Y(), 1e-9);
   }
+
+  void test_setPositionsAndRotations_moves_bank_in_one_call() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentRectangular(
+        2 /*2 banks*/, 4 /*4 by 4*/);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &batch = *std::get<0>(wrappers);
+    auto otherWrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &single = *std::get<0>(otherWrappers);
+
+    const size_t bankIndex = batch.root() - 3;
+    TS_ASSERT(batch.isStructuredBank(bankIndex));
+    const V3D newPosition = batch.position(bankIndex) + V3D(0.1, -0.2, 0.3);
+    const Quat newRotation(30.0, V3D(0, 1, 0));
+
+    batch.setPositionsAndRotations({bankIndex}, {newPosition}, {newRotation});
+    single.setPosition(bankIndex, newPosition);
+    single.setRotation(bankIndex, newRotation);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+      TS_ASSERT_DELTA((batch.position(i) - single.position(i)).norm(), 0.0,
+                      1e-12);
+      TS_ASSERT(batch.rotation(i) == single.rotation(i));
+    }
+  }
 };
 
 #endif /* MANTID_GEOMETRY_COMPONENTINFOTEST_H_ */
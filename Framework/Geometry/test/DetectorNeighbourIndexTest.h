@@ -0,0 +1,282 @@
+#ifndef MANTID_GEOMETRY_DETECTORNEIGHBOURINDEXTEST_H_
+#define MANTID_GEOMETRY_DETECTORNEIGHBOURINDEXTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorNeighbourIndex.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidKernel/V3D.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using Mantid::Geometry::ComponentInfo;
+using Mantid::Geometry::DetectorInfo;
+using Mantid::Geometry::DetectorNeighbourIndex;
+using Mantid::Geometry::InstrumentVisitor;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// Two 5x5 rectangular banks, pixel spacing 8 mm, 5 m apart along the beam
+std::tuple<std::unique_ptr<ComponentInfo>, std::unique_ptr<DetectorInfo>>
+makeRectangularInstrument() {
+  auto instrument =
+      ComponentCreationHelper::createTestInstrumentRectangular(2, 5);
+  return InstrumentVisitor::makeWrappers(*instrument, nullptr);
+}
+
+/// A single 4x3 rectangular bank with IDs increasing along x first
+std::tuple<std::unique_ptr<ComponentInfo>, std::unique_ptr<DetectorInfo>>
+makeBankFilledAlongX() {
+  using namespace Mantid::Geometry;
+  auto instrument = boost::make_shared<Instrument>("fill_by_x");
+  auto pixelShape = ComponentCreationHelper::createCuboid(0.004);
+  auto bank = new RectangularDetector("bank");
+  bank->initialize(pixelShape, 4, 0.0, 0.008, 3, 0.0, 0.008, 1, false, 4);
+  for (int x = 0; x < 4; ++x)
+    for (int y = 0; y < 3; ++y)
+      instrument->markAsDetector(bank->getAtXY(x, y).get());
+  instrument->add(bank);
+  return InstrumentVisitor::makeWrappers(*instrument, nullptr);
+}
+
+/// Detector index of pixel (x, y) of a 5x5 bank
+size_t pixel(const size_t bank, const size_t x, const size_t y) {
+  return bank * 25 + x * 5 + y;
+}
+}
+
+class DetectorNeighbourIndexTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DetectorNeighbourIndexTest *createSuite() {
+    return new DetectorNeighbourIndexTest();
+  }
+  static void destroySuite(DetectorNeighbourIndexTest *suite) { delete suite; }
+
+  void test_size_and_positions() {
+    auto wrappers = makeRectangularInstrument();
+    const auto &componentInfo = *std::get<0>(wrappers);
+    DetectorNeighbourIndex index(componentInfo);
+    TS_ASSERT_EQUALS(index.size(), 50);
+    for (size_t i = 0; i < index.size(); ++i)
+      TS_ASSERT_EQUALS(index.position(i), componentInfo.position(i));
+    TS_ASSERT_THROWS(index.position(50), std::out_of_range);
+  }
+
+  void test_nearest_excludes_self_and_is_sorted() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    const auto centre = pixel(0, 2, 2);
+    const auto neighbours = index.nearest(centre, 8);
+    TS_ASSERT_EQUALS(neighbours.size(), 8);
+    TS_ASSERT(std::find(neighbours.begin(), neighbours.end(), centre) ==
+              neighbours.end());
+    // The four edge-sharing pixels come first, lowest index first on ties
+    const std::vector<size_t> closest = {pixel(0, 1, 2), pixel(0, 2, 1),
+                                         pixel(0, 2, 3), pixel(0, 3, 2)};
+    TS_ASSERT(std::equal(closest.begin(), closest.end(), neighbours.begin()));
+    for (size_t i = 4; i < neighbours.size(); ++i)
+      TS_ASSERT_DELTA(index.position(neighbours[i])
+                          .distance(index.position(centre)),
+                      0.008 * std::sqrt(2.0), 1e-12);
+  }
+
+  void test_nearest_matches_brute_force() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    for (size_t i = 0; i < index.size(); ++i) {
+      std::vector<std::pair<double, size_t>> expected;
+      for (size_t j = 0; j < index.size(); ++j) {
+        const double distance = index.position(i).distance(index.position(j));
+        if (i != j)
+          expected.emplace_back(distance * distance, j);
+      }
+      std::sort(expected.begin(), expected.end());
+      const auto neighbours = index.nearest(i, 10);
+      TS_ASSERT_EQUALS(neighbours.size(), 10);
+      for (size_t n = 0; n < neighbours.size(); ++n)
+        TS_ASSERT_EQUALS(neighbours[n], expected[n].second);
+    }
+  }
+
+  void test_nearest_with_exclusion() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    std::vector<bool> excluded(index.size(), false);
+    excluded[pixel(0, 1, 2)] = true;
+    const auto neighbours = index.nearest(pixel(0, 2, 2), 3, &excluded);
+    const std::vector<size_t> expected = {pixel(0, 2, 1), pixel(0, 2, 3),
+                                          pixel(0, 3, 2)};
+    TS_ASSERT_EQUALS(neighbours, expected);
+    excluded.pop_back();
+    TS_ASSERT_THROWS(index.nearest(pixel(0, 2, 2), 3, &excluded),
+                     std::invalid_argument);
+  }
+
+  void test_nearest_with_scale() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    // Shrinking distances along y makes the y neighbours closest
+    const auto neighbours =
+        index.nearest(pixel(0, 2, 2), 4, nullptr, V3D(1.0, 10.0, 1.0));
+    const std::vector<size_t> expected = {pixel(0, 2, 1), pixel(0, 2, 3),
+                                          pixel(0, 2, 0), pixel(0, 2, 4)};
+    TS_ASSERT_EQUALS(neighbours, expected);
+    TS_ASSERT_THROWS(index.nearest(0, 4, nullptr, V3D(1.0, 0.0, 1.0)),
+                     std::invalid_argument);
+  }
+
+  void test_bulk_nearest_matches_single_queries() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    std::vector<size_t> queries(index.size());
+    for (size_t i = 0; i < queries.size(); ++i)
+      queries[i] = i;
+    const auto results = index.nearest(queries, 6);
+    TS_ASSERT_EQUALS(results.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i)
+      TS_ASSERT_EQUALS(results[i], index.nearest(queries[i], 6));
+  }
+
+  void test_within_radius() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    const auto centre = pixel(0, 2, 2);
+    TS_ASSERT(index.withinRadius(centre, 0.003).empty());
+    TS_ASSERT_EQUALS(index.withinRadius(centre, 0.009).size(), 4);
+    TS_ASSERT_EQUALS(index.withinRadius(centre, 0.012).size(), 8);
+    // The whole bank but not the other bank 5 m away
+    TS_ASSERT_EQUALS(index.withinRadius(centre, 1.0).size(), 24);
+    TS_ASSERT_EQUALS(index.withinRadius(centre, 10.0).size(), 49);
+    TS_ASSERT_THROWS(index.withinRadius(centre, -1.0), std::invalid_argument);
+  }
+
+  void test_grid_neighbours() {
+    auto wrappers = makeRectangularInstrument();
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    for (size_t i = 0; i < index.size(); ++i)
+      TS_ASSERT(index.isInGrid(i));
+    const std::vector<size_t> window = {
+        pixel(1, 1, 1), pixel(1, 1, 2), pixel(1, 1, 3),
+        pixel(1, 2, 1), pixel(1, 2, 2), pixel(1, 2, 3),
+        pixel(1, 3, 1), pixel(1, 3, 2), pixel(1, 3, 3)};
+    TS_ASSERT_EQUALS(index.gridNeighbours(pixel(1, 2, 2), 1, 1), window);
+    // Clipped at the corner of the bank
+    const std::vector<size_t> corner = {pixel(1, 0, 0), pixel(1, 0, 1),
+                                        pixel(1, 1, 0), pixel(1, 1, 1)};
+    TS_ASSERT_EQUALS(index.gridNeighbours(pixel(1, 0, 0), 1, 1), corner);
+    TS_ASSERT_EQUALS(index.gridNeighbours(pixel(0, 0, 0), 10, 0).size(), 5);
+  }
+
+  void test_grid_neighbours_with_ids_filled_along_x() {
+    auto wrappers = makeBankFilledAlongX();
+    const auto &componentInfo = *std::get<0>(wrappers);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    DetectorNeighbourIndex index(componentInfo);
+    TS_ASSERT_EQUALS(index.size(), 12);
+    // Detector indices follow the IDs, pixel (x, y) has ID 1 + x + 4 * y
+    const auto centre = detectorInfo.indexOf(1 + 1 + 4 * 1);
+    const auto window = index.gridNeighbours(centre, 1, 1);
+    TS_ASSERT_EQUALS(window.size(), 9);
+    for (const auto neighbour : window) {
+      const auto offset =
+          componentInfo.position(neighbour) - componentInfo.position(centre);
+      TS_ASSERT_LESS_THAN_EQUALS(std::abs(offset.X()), 0.008 + 1e-9);
+      TS_ASSERT_LESS_THAN_EQUALS(std::abs(offset.Y()), 0.008 + 1e-9);
+    }
+    // A full row along x at y = 0
+    const auto row = index.gridNeighbours(detectorInfo.indexOf(1), 3, 0);
+    const std::vector<size_t> expected = {
+        detectorInfo.indexOf(1), detectorInfo.indexOf(2),
+        detectorInfo.indexOf(3), detectorInfo.indexOf(4)};
+    TS_ASSERT_EQUALS(row, expected);
+  }
+
+  void test_grid_neighbours_throws_for_unstructured_detectors() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument, nullptr);
+    DetectorNeighbourIndex index(*std::get<0>(wrappers));
+    TS_ASSERT(!index.isInGrid(0));
+    TS_ASSERT_THROWS(index.gridNeighbours(0, 1, 1), std::invalid_argument);
+  }
+
+  void test_matches_detects_moved_detectors() {
+    auto wrappers = makeRectangularInstrument();
+    auto &componentInfo = *std::get<0>(wrappers);
+    DetectorNeighbourIndex index(componentInfo);
+    TS_ASSERT(index.matches(componentInfo));
+    componentInfo.setPosition(3, componentInfo.position(3) + V3D(0, 0, 1));
+    TS_ASSERT(!index.matches(componentInfo));
+  }
+
+  void test_component_info_caches_and_shares_index() {
+    auto wrappers = makeRectangularInstrument();
+    auto &componentInfo = *std::get<0>(wrappers);
+    const auto index = componentInfo.neighbourIndex();
+    TS_ASSERT_EQUALS(componentInfo.neighbourIndex(), index);
+    ComponentInfo copy(componentInfo);
+    TS_ASSERT_EQUALS(copy.neighbourIndex(), index);
+    // Moving a detector in the copy leaves the original index in place
+    copy.setPosition(0, copy.position(0) + V3D(0, 0, 1));
+    const auto moved = copy.neighbourIndex();
+    TS_ASSERT_DIFFERS(moved, index);
+    TS_ASSERT_EQUALS(moved->position(0), copy.position(0));
+    TS_ASSERT_EQUALS(componentInfo.neighbourIndex(), index);
+  }
+
+  void test_component_info_rebuilds_index_after_detector_info_moves() {
+    auto wrappers = makeRectangularInstrument();
+    const auto &componentInfo = *std::get<0>(wrappers);
+    auto &detectorInfo = *std::get<1>(wrappers);
+    const auto index = componentInfo.neighbourIndex();
+    detectorInfo.setPosition(7, detectorInfo.position(7) + V3D(0, 1, 0));
+    const auto moved = componentInfo.neighbourIndex();
+    TS_ASSERT_DIFFERS(moved, index);
+    TS_ASSERT_EQUALS(moved->position(7), detectorInfo.position(7));
+    TS_ASSERT(moved->matches(componentInfo));
+    TS_ASSERT_EQUALS(componentInfo.neighbourIndex(), moved);
+  }
+};
+
+class DetectorNeighbourIndexTestPerformance : public CxxTest::TestSuite {
+public:
+  static DetectorNeighbourIndexTestPerformance *createSuite() {
+    return new DetectorNeighbourIndexTestPerformance();
+  }
+  static void destroySuite(DetectorNeighbourIndexTestPerformance *suite) {
+    delete suite;
+  }
+
+  DetectorNeighbourIndexTestPerformance()
+      : m_wrappers(InstrumentVisitor::makeWrappers(
+            *ComponentCreationHelper::createTestInstrumentRectangular(4, 256),
+            nullptr)) {}
+
+  void test_build_index() {
+    DetectorNeighbourIndex index(*std::get<0>(m_wrappers));
+    TS_ASSERT_EQUALS(index.size(), 4 * 256 * 256);
+  }
+
+  void test_nearest_for_all_detectors() {
+    DetectorNeighbourIndex index(*std::get<0>(m_wrappers));
+    std::vector<size_t> queries(index.size());
+    for (size_t i = 0; i < queries.size(); ++i)
+      queries[i] = i;
+    const auto results = index.nearest(queries, 8);
+    TS_ASSERT_EQUALS(results.size(), queries.size());
+  }
+
+private:
+  std::tuple<std::unique_ptr<ComponentInfo>, std::unique_ptr<DetectorInfo>>
+      m_wrappers;
+};
+
+#endif /* MANTID_GEOMETRY_DETECTORNEIGHBOURINDEXTEST_H_ */
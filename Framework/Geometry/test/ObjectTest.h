@@ -23,6 +23,7 @@
 #include <ostream>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <ctime>
 
 #include "boost/shared_ptr.hpp"
@@ -852,6 +853,100 @@ public:
                     M_PI * 2.0 / 3.0, satol);
   }
 
+  void testMeshAccelerationUnavailableWithoutTriangulation() {
+    Object shape;
+    TS_ASSERT(!shape.setMeshAcceleration(true));
+    TS_ASSERT(!shape.hasMeshAcceleration());
+  }
+
+  void testMeshAccelerationMatchesRulesForCube() {
+    Object_sptr geom_obj = createUnitCube();
+    setUnitCubeTriangulation(*geom_obj);
+    Track rulesTrack(V3D(-2.0, 0.1, 0.2), V3D(1, 0, 0));
+    geom_obj->interceptSurface(rulesTrack);
+    const double rulesSolidAngle = geom_obj->solidAngle(V3D(1.0, 0.0, 0.0));
+
+    TS_ASSERT(geom_obj->setMeshAcceleration(true));
+    TS_ASSERT(geom_obj->hasMeshAcceleration());
+    Track meshTrack(V3D(-2.0, 0.1, 0.2), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(meshTrack), 1);
+    TS_ASSERT_EQUALS(meshTrack.count(), rulesTrack.count());
+    TS_ASSERT_DELTA(meshTrack.front().distFromStart,
+                    rulesTrack.front().distFromStart, 1e-10);
+    TS_ASSERT_DELTA(meshTrack.front().distInsideObject, 1.0, 1e-10);
+    TS_ASSERT_DELTA(geom_obj->solidAngle(V3D(1.0, 0.0, 0.0)), rulesSolidAngle,
+                    1e-3);
+    // Points inside are still classified using the rules
+    TS_ASSERT_DELTA(geom_obj->solidAngle(V3D(0.0, 0.0, 0.0)), 4.0 * M_PI,
+                    1e-10);
+
+    // Copies share the compiled mesh
+    Object copy(*geom_obj);
+    TS_ASSERT(copy.hasMeshAcceleration());
+
+    TS_ASSERT(!geom_obj->setMeshAcceleration(false));
+    TS_ASSERT(!geom_obj->hasMeshAcceleration());
+  }
+
+  void testMeshAccelerationTrackStartingInside() {
+    Object_sptr geom_obj = createUnitCube();
+    setUnitCubeTriangulation(*geom_obj);
+    TS_ASSERT(geom_obj->setMeshAcceleration(true));
+    Track track(V3D(0.0, 0.1, 0.2), V3D(0, 0, 1));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(track), 1);
+    TS_ASSERT_EQUALS(track.front().entryPoint, V3D(0.0, 0.1, 0.2));
+    TS_ASSERT_DELTA(track.front().exitPoint.Z(), 0.5, 1e-10);
+  }
+
+  void testMeshAccelerationForPrimitiveShapes() {
+    auto sphere = ComponentCreationHelper::createSphere(1.0);
+    const double exactSolidAngle = sphere->solidAngle(V3D(3.0, 0.0, 0.0));
+    TS_ASSERT(sphere->setMeshAcceleration(true));
+    TS_ASSERT(sphere->hasMeshAcceleration());
+    Track sphereTrack(V3D(-3.0, 0.0, 0.0), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(sphere->interceptSurface(sphereTrack), 1);
+    TS_ASSERT_DELTA(sphereTrack.front().distInsideObject, 2.0, 1e-10);
+    TS_ASSERT_DELTA(sphere->solidAngle(V3D(3.0, 0.0, 0.0)), exactSolidAngle,
+                    5e-3);
+
+    // An axis antiparallel to z must still give a closed mesh
+    auto cylinder = ComponentCreationHelper::createCappedCylinder(
+        0.5, 2.0, V3D(0.0, 0.0, 0.0), V3D(0.0, 0.0, -1.0), "cyl");
+    TS_ASSERT(cylinder->setMeshAcceleration(true));
+    Track axialTrack(V3D(0.0, 0.0, 1.0), V3D(0, 0, -1));
+    TS_ASSERT_EQUALS(cylinder->interceptSurface(axialTrack), 1);
+    TS_ASSERT_DELTA(axialTrack.front().entryPoint.Z(), 0.0, 1e-10);
+    TS_ASSERT_DELTA(axialTrack.front().exitPoint.Z(), -2.0, 1e-10);
+    TS_ASSERT_DELTA(axialTrack.front().distInsideObject, 2.0, 1e-10);
+
+    auto cuboid = ComponentCreationHelper::createCuboid(0.5, 1.0, 2.0);
+    Track rulesTrack(V3D(-3.0, 0.1, 0.2), V3D(1, 0, 0));
+    cuboid->interceptSurface(rulesTrack);
+    TS_ASSERT(cuboid->setMeshAcceleration(true));
+    Track meshTrack(V3D(-3.0, 0.1, 0.2), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cuboid->interceptSurface(meshTrack), 1);
+    TS_ASSERT_DELTA(meshTrack.front().distFromStart,
+                    rulesTrack.front().distFromStart, 1e-10);
+    TS_ASSERT_DELTA(meshTrack.front().distInsideObject,
+                    rulesTrack.front().distInsideObject, 1e-10);
+  }
+
+  void testMeshAccelerationTrackParityComesFromTheMesh() {
+    // A point just inside the sphere but outside its faceted mesh
+    auto sphere = ComponentCreationHelper::createSphere(1.0);
+    TS_ASSERT(sphere->setMeshAcceleration(true));
+    const double angle = M_PI / 64.0;
+    const V3D start(0.9995 * std::cos(angle), 0.9995 * std::sin(angle), 0.001);
+    TS_ASSERT(sphere->isValid(start));
+    V3D direction = start * -1.0;
+    direction.normalize();
+    Track track(start, direction);
+    TS_ASSERT_EQUALS(sphere->interceptSurface(track), 1);
+    TS_ASSERT_EQUALS(track.count(), 1);
+    TS_ASSERT_DIFFERS(track.front().entryPoint, start);
+    TS_ASSERT_DELTA(track.front().distInsideObject, 2.0, 1e-2);
+  }
+
   /** Add a scale factor */
   void testSolidAngleCubeTriangles_WithScaleFactor() {
     Object_sptr geom_obj = createUnitCube();
@@ -1310,6 +1405,23 @@ private:
     return retVal;
   }
 
+  /// Give the unit cube an explicit triangulation so that tests do not depend
+  /// on OpenCascade being available
+  void setUnitCubeTriangulation(Object &cube) {
+    const double vertices[] = {-0.5, -0.5, -0.5, 0.5,  -0.5, -0.5,
+                               0.5,  0.5,  -0.5, -0.5, 0.5,  -0.5,
+                               -0.5, -0.5, 0.5,  0.5,  -0.5, 0.5,
+                               0.5,  0.5,  0.5,  -0.5, 0.5,  0.5};
+    const int faces[] = {0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4,
+                         3, 7, 6, 3, 6, 2, 0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5};
+    // The handler takes ownership of the arrays
+    auto *points = new double[24];
+    std::copy(std::begin(vertices), std::end(vertices), points);
+    auto *triangles = new int[36];
+    std::copy(std::begin(faces), std::end(faces), triangles);
+    cube.getGeometryHandler()->setGeometryCache(8, 12, points, triangles);
+  }
+
   Object_sptr createCuboid(std::vector<std::string> &planes) {
     std::string C1 = planes[0];
     std::string C2 = planes[1];
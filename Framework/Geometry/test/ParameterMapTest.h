@@ -8,6 +8,7 @@
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/V3D.h"
 #include <cxxtest/TestSuite.h>
 
@@ -501,6 +502,47 @@ public:
     TSM_ASSERT("Cleared parameter map should be empty", pmap.empty())
   }
 
+  void test_Modifying_A_Copy_Leaves_The_Original_Untouched() {
+    ParameterMap pmap;
+    pmap.addDouble(m_testInstrument.get(), "first", 5.4);
+    pmap.addDouble(m_testInstrument.get(), "second", 10.3);
+    ParameterMap added(pmap), cleared(pmap), clearedByName(pmap);
+    TS_ASSERT_EQUALS(added, pmap);
+
+    added.addDouble(m_testInstrument.get(), "third", 1.0);
+    cleared.clear();
+    clearedByName.clearParametersByName("first");
+
+    TS_ASSERT_EQUALS(added.size(), 3);
+    TS_ASSERT_EQUALS(cleared.size(), 0);
+    TS_ASSERT_EQUALS(clearedByName.size(), 1);
+    TS_ASSERT_EQUALS(pmap.size(), 2);
+    TS_ASSERT(!pmap.contains(m_testInstrument.get(), "third"));
+    TS_ASSERT_DELTA(pmap.get(m_testInstrument.get(), "first")->value<double>(),
+                    5.4, 1e-12);
+  }
+
+  void test_Reading_While_A_Shared_Map_Is_Unshared() {
+    ParameterMap pmap;
+    const IComponent *comp = m_testInstrument.get();
+    pmap.addDouble(comp, "first", 5.4);
+    ParameterMap copy(pmap);
+
+    // One iteration unshares the copy while the others read it
+    std::vector<double> values(200, 0.0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+      if (i == 100)
+        copy.addDouble(comp, "second", 1.0);
+      values[i] = copy.get(comp, "first")->value<double>();
+    }
+
+    for (const auto value : values)
+      TS_ASSERT_DELTA(value, 5.4, 1e-12);
+    TS_ASSERT_EQUALS(copy.size(), 2);
+    TS_ASSERT_EQUALS(pmap.size(), 1);
+  }
+
   void test_lookup_via_type_returns_null_if_fails() {
     // Add a parameter for the first component of the instrument
     IComponent_sptr comp = m_testInstrument->getChild(0);
@@ -0,0 +1,138 @@
+#ifndef MANTID_GEOMETRY_TRIANGLEMESHTEST_H_
+#define MANTID_GEOMETRY_TRIANGLEMESHTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/TriangleMesh.h"
+#include "MantidKernel/V3D.h"
+
+#include <cmath>
+#include <stdexcept>
+
+using Mantid::Geometry::TriangleMesh;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// Axis-aligned cube of side 1 centred on the origin as 12 triangles
+TriangleMesh createUnitCubeMesh() {
+  std::vector<double> vertices = {
+      -0.5, -0.5, -0.5, 0.5, -0.5, -0.5, 0.5, 0.5, -0.5, -0.5, 0.5, -0.5,
+      -0.5, -0.5, 0.5,  0.5, -0.5, 0.5,  0.5, 0.5, 0.5,  -0.5, 0.5, 0.5};
+  std::vector<int> faces = {0, 2, 1, 0, 3, 2, 4, 5, 6, 4, 6, 7,
+                            0, 1, 5, 0, 5, 4, 3, 7, 6, 3, 6, 2,
+                            0, 4, 7, 0, 7, 3, 1, 2, 6, 1, 6, 5};
+  return TriangleMesh(vertices, faces);
+}
+}
+
+class TriangleMeshTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TriangleMeshTest *createSuite() { return new TriangleMeshTest(); }
+  static void destroySuite(TriangleMeshTest *suite) { delete suite; }
+
+  void test_constructor_rejects_incomplete_triples() {
+    TS_ASSERT_THROWS(TriangleMesh({0., 0., 0., 1.}, {0, 0, 0}),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(TriangleMesh({0., 0., 0.}, {0, 0}),
+                     std::invalid_argument);
+  }
+
+  void test_constructor_rejects_out_of_range_face() {
+    TS_ASSERT_THROWS(TriangleMesh({0., 0., 0., 1., 0., 0., 0., 1., 0.},
+                                  {0, 1, 3}),
+                     std::invalid_argument);
+  }
+
+  void test_number_of_triangles() {
+    TS_ASSERT_EQUALS(createUnitCubeMesh().numberOfTriangles(), 12);
+  }
+
+  void test_ray_through_cube_gives_entry_and_exit() {
+    const auto mesh = createUnitCubeMesh();
+    std::vector<double> distances;
+    mesh.intersectionDistances(V3D(-2.0, 0.1, 0.2), V3D(1.0, 0.0, 0.0),
+                               distances);
+    TS_ASSERT_EQUALS(distances.size(), 2);
+    TS_ASSERT_DELTA(distances[0], 1.5, 1e-12);
+    TS_ASSERT_DELTA(distances[1], 2.5, 1e-12);
+  }
+
+  void test_ray_through_shared_edge_is_counted_once() {
+    const auto mesh = createUnitCubeMesh();
+    std::vector<double> distances;
+    // Passes along the diagonal splitting the -x and +x faces into triangles
+    mesh.intersectionDistances(V3D(-2.0, 0.0, 0.0), V3D(1.0, 0.0, 0.0),
+                               distances);
+    TS_ASSERT_EQUALS(distances.size(), 2);
+  }
+
+  void test_ray_starting_inside_only_sees_exit() {
+    const auto mesh = createUnitCubeMesh();
+    std::vector<double> distances;
+    mesh.intersectionDistances(V3D(0.0, 0.1, 0.2), V3D(0.0, 0.0, 1.0),
+                               distances);
+    TS_ASSERT_EQUALS(distances.size(), 1);
+    TS_ASSERT_DELTA(distances[0], 0.3, 1e-12);
+  }
+
+  void test_ray_pointing_away_misses() {
+    const auto mesh = createUnitCubeMesh();
+    std::vector<double> distances;
+    mesh.intersectionDistances(V3D(-2.0, 0.1, 0.2), V3D(-1.0, 0.0, 0.0),
+                               distances);
+    TS_ASSERT(distances.empty());
+    mesh.intersectionDistances(V3D(-2.0, 2.0, 0.2), V3D(1.0, 0.0, 0.0),
+                               distances);
+    TS_ASSERT(distances.empty());
+  }
+
+  void test_solid_angle_of_cube_face_on() {
+    const auto mesh = createUnitCubeMesh();
+    // From the centre of a face at distance 0.5 the cube subtends 4pi/6
+    TS_ASSERT_DELTA(mesh.solidAngle(V3D(1.0, 0.0, 0.0)), 2.0 * M_PI / 3.0,
+                    1e-10);
+    TS_ASSERT_DELTA(mesh.solidAngle(V3D(0.0, 0.0, -1.0)), 2.0 * M_PI / 3.0,
+                    1e-10);
+  }
+
+  void test_solid_angle_falls_with_distance() {
+    const auto mesh = createUnitCubeMesh();
+    const double distance = 100.0;
+    // Far away the cube looks like a unit square
+    TS_ASSERT_DELTA(mesh.solidAngle(V3D(0.0, distance, 0.0)),
+                    1.0 / std::pow(distance - 0.5, 2), 1e-7);
+  }
+};
+
+class TriangleMeshTestPerformance : public CxxTest::TestSuite {
+public:
+  static TriangleMeshTestPerformance *createSuite() {
+    return new TriangleMeshTestPerformance();
+  }
+  static void destroySuite(TriangleMeshTestPerformance *suite) { delete suite; }
+
+  TriangleMeshTestPerformance() : m_mesh(createUnitCubeMesh()) {}
+
+  void test_intersection_distances() {
+    std::vector<double> distances;
+    for (size_t i = 0; i < 1000000; ++i) {
+      m_mesh.intersectionDistances(V3D(-2.0, 0.1, 0.2), V3D(1.0, 0.0, 0.0),
+                                   distances);
+    }
+  }
+
+  void test_solid_angle() {
+    double total(0.0);
+    for (size_t i = 0; i < 1000000; ++i) {
+      total += m_mesh.solidAngle(V3D(1.0, 0.0, 0.0));
+    }
+    TS_ASSERT(total > 0.0);
+  }
+
+private:
+  const TriangleMesh m_mesh;
+};
+
+#endif /* MANTID_GEOMETRY_TRIANGLEMESHTEST_H_ */
@@ -10,6 +10,7 @@
 #endif
 #include <Poco/NotificationCenter.h>
 #include <Poco/Notification.h>
+#include <Poco/RWLock.h>
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/ConfigService.h"
@@ -223,7 +224,7 @@ public:
     bool success = false;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      Poco::ScopedWriteRWLock lock(m_mutex);
       // At the moment, you can't overwrite an object (i.e. pass in a name
       // that's already in the map with a pointer to a different object).
       // Also, there's nothing to stop the same object from being added
@@ -253,53 +254,62 @@ public:
                             const boost::shared_ptr<T> &Tobject) {
     checkForNullPointer(Tobject);
 
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
     // find if the Tobject already exists
-    auto it = datamap.find(name);
-    if (it != datamap.end()) {
-      lock.unlock();
-      g_log.debug("Data Object '" + name + "' replaced in data service.\n");
-
-      notificationCenter.postNotification(
-          new BeforeReplaceNotification(name, it->second, Tobject));
-
-      lock.lock();
-      it->second = Tobject;
-      lock.unlock();
+    boost::shared_ptr<T> existing;
+    {
+      Poco::ScopedReadRWLock lock(m_mutex);
+      auto it = datamap.find(name);
+      if (it != datamap.end())
+        existing = it->second;
+    }
+    if (!existing) {
+      DataService::add(name, Tobject);
+      return;
+    }
 
+    g_log.debug("Data Object '" + name + "' replaced in data service.\n");
+    notificationCenter.postNotification(
+        new BeforeReplaceNotification(name, existing, Tobject));
+    bool replaced = true;
+    {
+      Poco::ScopedWriteRWLock lock(m_mutex);
+      // The object may have been removed while the service was unlocked
+      auto it = datamap.find(name);
+      if (it != datamap.end()) {
+        it->second = Tobject;
+      } else {
+        datamap.emplace(name, Tobject);
+        replaced = false;
+      }
+    }
+    if (replaced)
       notificationCenter.postNotification(
           new AfterReplaceNotification(name, Tobject));
-    } else {
-      // Avoid double-locking
-      lock.unlock();
-      DataService::add(name, Tobject);
-    }
+    else
+      notificationCenter.postNotification(new AddNotification(name, Tobject));
   }
 
   //--------------------------------------------------------------------------
   /** Remove an object from the service.
    * @param name :: name of the object */
   void remove(const std::string &name) {
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
-    auto it = datamap.find(name);
-    if (it == datamap.end()) {
-      lock.unlock();
-      g_log.debug(" remove '" + name + "' cannot be found");
-      return;
-    }
     // The map is shared across threads so the item is erased from the map
     // before unlocking the mutex and is held in a local stack variable.
     // This protects it from being modified by another thread.
-    auto data = std::move(it->second);
-    datamap.erase(it);
-
-    // Do NOT use "it" iterator after this point. Other threads may modify the
-    // map
-    lock.unlock();
+    boost::shared_ptr<T> data;
+    {
+      // Make DataService access thread-safe
+      Poco::ScopedWriteRWLock lock(m_mutex);
+      auto it = datamap.find(name);
+      if (it != datamap.end()) {
+        data = std::move(it->second);
+        datamap.erase(it);
+      }
+    }
+    if (!data) {
+      g_log.debug(" remove '" + name + "' cannot be found");
+      return;
+    }
     notificationCenter.postNotification(new PreDeleteNotification(name, data));
     data.reset(); // DataService now has no references to the object
     g_log.information("Data Object '" + name + "' deleted from data service.");
@@ -310,6 +320,8 @@ public:
   /** Rename an object within the service.
    * @param oldName :: The old name of the object
    * @param newName :: The new name of the object
+   * @throw Exception::NotFoundError if the object is removed by another
+   * thread or an observer before it is renamed
    */
   void rename(const std::string &oldName, const std::string &newName) {
     checkForEmptyName(newName);
@@ -319,44 +331,46 @@ public:
       return;
     }
 
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
-    auto existingNameIter = datamap.find(oldName);
-    if (existingNameIter == datamap.end()) {
-      lock.unlock();
+    boost::shared_ptr<T> existingNameObject;
+    boost::shared_ptr<T> targetNameObject;
+    {
+      // Make DataService access thread-safe
+      Poco::ScopedReadRWLock lock(m_mutex);
+      auto existingNameIter = datamap.find(oldName);
+      if (existingNameIter != datamap.end()) {
+        existingNameObject = existingNameIter->second;
+        auto targetNameIter = datamap.find(newName);
+        if (targetNameIter != datamap.end())
+          targetNameObject = targetNameIter->second;
+      }
+    }
+    if (!existingNameObject) {
       g_log.warning(" rename '" + oldName + "' cannot be found");
       return;
     }
 
-    auto existingNameObject = std::move(existingNameIter->second);
-    auto targetNameIter = datamap.find(newName);
-
     // If we are overriding send a notification for observers
-    if (targetNameIter != datamap.end()) {
-      auto targetNameObject = targetNameIter->second;
+    if (targetNameObject) {
       // As we are renaming the existing name turns into the new name
       notificationCenter.postNotification(new BeforeReplaceNotification(
           newName, targetNameObject, existingNameObject));
     }
-
-    datamap.erase(existingNameIter);
-
-    if (targetNameIter != datamap.end()) {
-      targetNameIter->second = std::move(existingNameObject);
+    {
+      Poco::ScopedWriteRWLock lock(m_mutex);
+      // The object may have been removed or replaced while the service was
+      // unlocked, so it is looked up again
+      auto existingNameIter = datamap.find(oldName);
+      if (existingNameIter == datamap.end())
+        throw Kernel::Exception::NotFoundError(
+            " rename : Data Object was removed while being renamed", oldName);
+      existingNameObject = std::move(existingNameIter->second);
+      datamap.erase(existingNameIter);
+      datamap[newName] = existingNameObject;
+    }
+    if (targetNameObject) {
       notificationCenter.postNotification(
-          new AfterReplaceNotification(newName, targetNameIter->second));
-    } else {
-      if (!(datamap.emplace(newName, std::move(existingNameObject)).second)) {
-        // should never happen
-        lock.unlock();
-        std::string error =
-            " add : Unable to insert Data Object : '" + newName + "'";
-        g_log.error(error);
-        throw std::runtime_error(error);
-      }
+          new AfterReplaceNotification(newName, existingNameObject));
     }
-    lock.unlock();
     g_log.information("Data Object '" + oldName + "' renamed to '" + newName +
                       "'");
     notificationCenter.postNotification(
@@ -366,11 +380,15 @@ public:
   //--------------------------------------------------------------------------
   /// Empty the service
   void clear() {
+    // The objects are released after the lock so that their destructors
+    // may use the service
+    svcmap cleared;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
-      datamap.clear();
+      Poco::ScopedWriteRWLock lock(m_mutex);
+      datamap.swap(cleared);
     }
+    cleared.clear();
     notificationCenter.postNotification(new ClearNotification());
     g_log.debug() << typeid(this).name() << " cleared.\n";
   }
@@ -383,7 +401,7 @@ public:
    * @param name :: name of the object */
   boost::shared_ptr<T> retrieve(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    Poco::ScopedReadRWLock _lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it != datamap.end()) {
@@ -399,16 +417,17 @@ public:
   /// Check to see if a data object exists in the store
   bool doesExist(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    Poco::ScopedReadRWLock _lock(m_mutex);
     auto it = datamap.find(name);
     return it != datamap.end();
   }
 
   /// Return the number of objects stored by the data service
   size_t size() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    const bool showingHidden = showingHiddenObjects();
+    Poco::ScopedReadRWLock _lock(m_mutex);
 
-    if (showingHiddenObjects()) {
+    if (showingHidden) {
       return datamap.size();
     } else {
       size_t count = 0;
@@ -446,14 +465,14 @@ public:
     // Use the scoping of an if to handle our lock for duration
     if (hiddenState == DataServiceHidden::Include) {
       // Getting hidden items
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      Poco::ScopedReadRWLock _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         foundNames.push_back(item.first);
       }
       // Lock released at end of scope here
     } else {
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      Poco::ScopedReadRWLock _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         if (!isHiddenDataServiceObject(item.first)) {
@@ -474,9 +493,8 @@ public:
 
   /// Get a vector of the pointers to the data objects stored by the service
   std::vector<boost::shared_ptr<T>> getObjects() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
     const bool showingHidden = showingHiddenObjects();
+    Poco::ScopedReadRWLock _lock(m_mutex);
     std::vector<boost::shared_ptr<T>> objects;
     objects.reserve(datamap.size());
     for (auto it = datamap.begin(); it != datamap.end(); ++it) {
@@ -519,6 +537,32 @@ protected:
   DataService(const std::string &name) : svcName(name), g_log(svcName) {}
   virtual ~DataService() = default;
 
+  /**
+   * Replace a stored object by another one standing for the same data,
+   * without posting notifications.
+   * @param name :: The name of the object
+   * @param expected :: The object that must currently be stored
+   * @param replacement :: The object to store instead
+   * @param unshared :: If true, only replace the object if nothing but the
+   * service and the caller hold it
+   * @return true if the object was replaced
+   */
+  bool replaceQuietly(const std::string &name,
+                      const boost::shared_ptr<T> &expected,
+                      const boost::shared_ptr<T> &replacement,
+                      const bool unshared) {
+    checkForNullPointer(replacement);
+    Poco::ScopedWriteRWLock lock(m_mutex);
+    auto it = datamap.find(name);
+    if (it == datamap.end() || it->second != expected)
+      return false;
+    // No new references can be taken while the lock is held
+    if (unshared && expected.use_count() > 2)
+      return false;
+    it->second = replacement;
+    return true;
+  }
+
 private:
   void checkForEmptyName(const std::string &name) {
     if (name.empty()) {
@@ -541,8 +585,10 @@ private:
   const std::string svcName;
   /// Map of objects in the data service
   svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
+  /// Lookups share the lock and only modifications take it exclusively. It is
+  /// never held while notifications are posted so observers may use the
+  /// service.
+  mutable Poco::RWLock m_mutex;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
@@ -0,0 +1,94 @@
+#ifndef MANTID_KERNEL_FOURIERTRANSFORM_H_
+#define MANTID_KERNEL_FOURIERTRANSFORM_H_
+/*
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+
+#include "MantidKernel/DllConfig.h"
+#include <cstddef>
+#include <memory>
+
+namespace Mantid {
+namespace Kernel {
+// Keep the gsl types out of here
+struct RealFourierTransformPlan;
+struct ComplexFourierTransformPlan;
+struct RealFourierTransformScratch;
+struct ComplexFourierTransformScratch;
+
+/**
+  In-place fast Fourier transforms of real data of a fixed size, with the
+  results in the GSL halfcomplex format.
+
+  The trigonometric tables (the plan) of a size are computed once and shared
+  by every transform of that size in the process, so creating a transform
+  for a size that has been used before is cheap. An object also owns the
+  scratch space of its transforms, so it must not be used by several threads
+  at once; create one per thread instead.
+*/
+class MANTID_KERNEL_DLL RealFourierTransform {
+public:
+  explicit RealFourierTransform(const size_t n);
+  // Implemented in cpp so the unique_ptr member doesn't need to
+  // see the full scratch implementation
+  ~RealFourierTransform();
+
+  /// The number of real values in a transform
+  size_t size() const { return m_n; }
+  void forward(double *data, const size_t count = 1);
+  void backward(double *data, const size_t count = 1);
+  void inverse(double *data, const size_t count = 1);
+
+private:
+  const size_t m_n;
+  std::shared_ptr<const RealFourierTransformPlan> m_plan;
+  std::unique_ptr<RealFourierTransformScratch> m_scratch;
+};
+
+/**
+  In-place fast Fourier transforms of complex data of a fixed size, stored as
+  interleaved real and imaginary parts. Plans are shared in the same way as
+  by RealFourierTransform.
+*/
+class MANTID_KERNEL_DLL ComplexFourierTransform {
+public:
+  explicit ComplexFourierTransform(const size_t n);
+  ~ComplexFourierTransform();
+
+  /// The number of complex values in a transform
+  size_t size() const { return m_n; }
+  void forward(double *data, const size_t count = 1);
+  void inverse(double *data, const size_t count = 1);
+
+private:
+  const size_t m_n;
+  std::shared_ptr<const ComplexFourierTransformPlan> m_plan;
+  std::unique_ptr<ComplexFourierTransformScratch> m_scratch;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_FOURIERTRANSFORM_H_ */
@@ -0,0 +1,61 @@
+#ifndef MANTID_KERNEL_MEMORYMAPPEDFILE_H_
+#define MANTID_KERNEL_MEMORYMAPPEDFILE_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <string>
+
+namespace Mantid {
+namespace Kernel {
+
+/** MemoryMappedFile : Maps a whole file read-only into memory. The pages are
+  read from disk when they are first accessed, so reading the mapped data
+  sequentially costs no read calls and no intermediate buffers.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL MemoryMappedFile {
+public:
+  explicit MemoryMappedFile(const std::string &filename);
+  ~MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile &) = delete;
+  MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+  /// The start of the mapped file
+  const char *data() const { return m_data; }
+  /// The size of the file in bytes
+  size_t size() const { return m_size; }
+
+private:
+  const char *m_data = nullptr;
+  size_t m_size = 0;
+#ifdef _WIN32
+  void *m_file = nullptr;
+  void *m_mapping = nullptr;
+#endif
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_MEMORYMAPPEDFILE_H_ */
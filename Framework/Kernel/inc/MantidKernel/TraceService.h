@@ -0,0 +1,135 @@
+#ifndef MANTID_KERNEL_TRACESERVICE_H_
+#define MANTID_KERNEL_TRACESERVICE_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** TraceService : Records a timeline of spans, such as algorithm executions,
+  and counters, such as the memory used, and exports it in the Chrome
+  trace-event format that can be viewed with chrome://tracing.
+
+  Recording is disabled by default and costs a single atomic load per span
+  while disabled. If the tracing.filename configuration key is set, recording
+  is enabled on startup and the trace is saved to that file on shutdown.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL TraceServiceImpl {
+public:
+  /// Named numeric values attached to an event
+  typedef std::vector<std::pair<std::string, double>> Arguments;
+
+  /// Returns true if events are being recorded
+  bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+  /// Start or stop recording events
+  void setEnabled(const bool enabled);
+  /// The current time in microseconds since the service was created
+  int64_t now() const;
+  /// Record a span that started at the given time and ends now
+  void addSpan(const std::string &name, const std::string &category,
+               const int64_t start, const Arguments &args = Arguments());
+  /// Record the value of a counter at the current time
+  void addCounter(const std::string &name, const double value);
+  /// The number of recorded events
+  size_t size() const;
+  /// Discard the recorded events
+  void clear();
+  /// The recorded events in the Chrome trace-event JSON format
+  std::string toChromeTrace() const;
+  /// Save the recorded events in the Chrome trace-event JSON format
+  void saveChromeTrace(const std::string &filename) const;
+  /// Save the trace to the configured file and stop recording
+  void shutdown();
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<TraceServiceImpl>;
+
+  /// A recorded span or counter
+  struct Event {
+    std::string name;
+    std::string category;
+    char phase;
+    int64_t timestamp;
+    int64_t duration;
+    int thread;
+    Arguments args;
+  };
+
+  TraceServiceImpl();
+  ~TraceServiceImpl() = default;
+  TraceServiceImpl(const TraceServiceImpl &) = delete;
+  TraceServiceImpl &operator=(const TraceServiceImpl &) = delete;
+
+  static int currentThread();
+  void addEvent(Event event);
+
+  /// Reference point of the timestamps
+  const std::chrono::steady_clock::time_point m_origin;
+  std::atomic<bool> m_enabled;
+  /// File written on shutdown, empty if none
+  std::string m_filename;
+  std::vector<Event> m_events;
+  mutable std::mutex m_mutex;
+};
+
+EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
+    Mantid::Kernel::SingletonHolder<TraceServiceImpl>;
+typedef Mantid::Kernel::SingletonHolder<TraceServiceImpl> TraceService;
+
+/** TraceSpan : Records a span in the TraceService covering its lifetime,
+  together with the memory high-water mark of the process at its end. Nothing
+  is recorded if the service was disabled when the span was created.
+*/
+class MANTID_KERNEL_DLL TraceSpan {
+public:
+  TraceSpan(const std::string &name, const std::string &category);
+  ~TraceSpan();
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+  /// Returns true if the span will be recorded
+  bool isRecording() const { return m_recording; }
+  void addArgument(const std::string &name, const double value);
+
+private:
+  const bool m_recording;
+  std::string m_name;
+  std::string m_category;
+  int64_t m_start = 0;
+  TraceServiceImpl::Arguments m_args;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_TRACESERVICE_H_ */
@@ -186,6 +186,14 @@ public:
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
+  /** Describe the conversion to TOF for the current initialization as
+   * tof = factor * x^power, if it has that form.
+   * @param factor :: Returns the constant factor
+   * @param power :: Returns the power applied to the value
+   * @return true if the conversion is a pure power law
+   */
+  virtual bool tofPowerLaw(double &factor, double &power) const;
+
   /// some units can be converted from TOF only in the range of TOF ;
   /// This function returns minimal TOF value still reversibly convertible into
   /// the unit.
@@ -303,6 +311,7 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -320,6 +329,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -347,6 +357,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -394,6 +405,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -444,6 +456,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -466,6 +479,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -574,6 +588,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -593,6 +608,7 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  bool tofPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
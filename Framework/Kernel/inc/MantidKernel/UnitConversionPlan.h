@@ -0,0 +1,144 @@
+#ifndef MANTID_KERNEL_UNITCONVERSIONPLAN_H_
+#define MANTID_KERNEL_UNITCONVERSIONPLAN_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/Unit.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** UnitConversionPlan : Precomputed per-spectrum coefficients for converting
+  X values from one unit to another.
+
+  The geometry of every spectrum is supplied once with setSpectrum(). Where
+  both units are power laws of time-of-flight for that geometry the whole
+  conversion collapses to output = factor * input^power, which is applied in
+  a single loop without any virtual calls. The remaining spectra are converted
+  through time-of-flight exactly as Unit::toTOF/fromTOF would do.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL UnitConversionPlan {
+public:
+  UnitConversionPlan(const Unit &source, const Unit &destination,
+                     const size_t size);
+
+  /// Number of spectra in the plan
+  size_t size() const { return m_geometry.size(); }
+  void setSpectrum(const size_t index, const double l1, const double l2,
+                   const double twoTheta, const int emode,
+                   const double efixed, const double delta = 0.0);
+  bool isPowerLaw(const size_t index) const;
+  /// Factor of the power law of spectrum index, if isPowerLaw(index)
+  double factor(const size_t index) const { return m_factor[index]; }
+  /// Power of the power law of spectrum index, if isPowerLaw(index)
+  double power(const size_t index) const { return m_power[index]; }
+  void initialize(const size_t index, Unit &source, Unit &destination) const;
+
+  /** Convert the values in [first, last) of spectrum index in place. Safe to
+   * call concurrently for different spectra.
+   * @param index :: The spectrum index
+   * @param first :: Iterator to the first value to convert
+   * @param last :: Iterator past the last value to convert
+   */
+  template <class Iterator>
+  void convert(const size_t index, Iterator first, Iterator last) const {
+    if (isPowerLaw(index)) {
+      applyPowerLaw(m_factor[index], m_power[index], first, last,
+                    [](double &x) -> double & { return x; });
+      return;
+    }
+    std::unique_ptr<Unit> source(m_source->clone());
+    std::unique_ptr<Unit> destination(m_destination->clone());
+    initialize(index, *source, *destination);
+    for (; first != last; ++first)
+      *first = destination->singleFromTOF(source->singleToTOF(*first));
+  }
+
+  /** Apply value = factor * value^power to every element of [first, last).
+   * The common powers are evaluated without std::pow and the power is
+   * resolved once outside of the loop.
+   * @param factor :: The constant factor
+   * @param power :: The power to raise the values to
+   * @param first :: Iterator to the first element
+   * @param last :: Iterator past the last element
+   * @param value :: Callable returning a reference to the value of an element
+   */
+  template <class Iterator, class Accessor>
+  static void applyPowerLaw(const double factor, const double power,
+                            Iterator first, Iterator last, Accessor value) {
+    if (power == 1.0) {
+      for (; first != last; ++first)
+        value(*first) *= factor;
+    } else if (power == -1.0) {
+      for (; first != last; ++first)
+        value(*first) = factor / value(*first);
+    } else if (power == 2.0) {
+      for (; first != last; ++first) {
+        double &x = value(*first);
+        x = factor * x * x;
+      }
+    } else if (power == -2.0) {
+      for (; first != last; ++first) {
+        double &x = value(*first);
+        x = factor / (x * x);
+      }
+    } else if (power == 0.5) {
+      for (; first != last; ++first)
+        value(*first) = factor * std::sqrt(value(*first));
+    } else if (power == -0.5) {
+      for (; first != last; ++first)
+        value(*first) = factor / std::sqrt(value(*first));
+    } else {
+      for (; first != last; ++first)
+        value(*first) = factor * std::pow(value(*first), power);
+    }
+  }
+
+private:
+  /// The geometry a spectrum is converted with
+  struct SpectrumGeometry {
+    double l1;
+    double l2;
+    double twoTheta;
+    int emode;
+    double efixed;
+    double delta;
+  };
+
+  std::unique_ptr<Unit> m_source;
+  std::unique_ptr<Unit> m_destination;
+  std::vector<SpectrumGeometry> m_geometry;
+  /// Power law factors, one per spectrum
+  std::vector<double> m_factor;
+  /// Power law powers, one per spectrum. NaN if not a power law
+  std::vector<double> m_power;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_UNITCONVERSIONPLAN_H_ */
@@ -0,0 +1,211 @@
+#include "MantidKernel/Math/ArrayFunctions.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace Mantid {
+namespace Kernel {
+namespace Math {
+namespace {
+/// Below this exp() returns zero
+constexpr double EXP_MIN_ARG = -708.0;
+/// Above this exp() returns infinity
+constexpr double EXP_MAX_ARG = 709.78;
+/// 1/ln(2)
+constexpr double LOG2E = 1.4426950408889634074;
+/// ln(2) split into a part with an exact product by small integers and the
+/// remainder
+constexpr double LN2_HI = 6.93145751953125e-1;
+constexpr double LN2_LO = 1.42860682030941723212e-6;
+/// Adding this rounds a double of magnitude below 2^51 to an integer and
+/// leaves it in the low bits of the mantissa
+constexpr double ROUNDING_SHIFT = 6755399441055744.0; // 1.5 * 2^52
+/// 1/sqrt(pi)
+constexpr double ONE_OVER_SQRT_PI = 5.6418958354775628695e-1;
+/// The boundaries of the three regions of Cody's approximations of erfc
+constexpr double ERF_SMALL = 0.46875;
+constexpr double ERF_LARGE = 4.0;
+
+/**
+ * exp(x) with the Cephes rational approximation on [-ln(2)/2, ln(2)/2].
+ * The power of two is built directly in the exponent bits so that the
+ * function compiles to straight-line code.
+ */
+inline double expKernel(const double x) {
+  const bool underflow = x < EXP_MIN_ARG;
+  const bool overflow = x > EXP_MAX_ARG;
+  const bool isNaN = x != x;
+  double clamped = underflow ? EXP_MIN_ARG : x;
+  clamped = overflow ? EXP_MAX_ARG : clamped;
+  const double shifted = clamped * LOG2E + ROUNDING_SHIFT;
+  const double k = shifted - ROUNDING_SHIFT;
+  const double r = (clamped - k * LN2_HI) - k * LN2_LO;
+  const double rr = r * r;
+  const double p =
+      r * ((1.26177193074810590878e-4 * rr + 3.02994407707441961300e-2) * rr +
+           9.99999999999999999910e-1);
+  const double q = ((3.00198505138664455042e-6 * rr +
+                     2.52448340349684104192e-3) *
+                        rr +
+                    2.27265548208155028766e-1) *
+                       rr +
+                   2.00000000000000000009e0;
+  const double e = 1.0 + 2.0 * p / (q - p);
+  // 2^(k-1): k - 1 is in [-1022, 1023] so the exponent is always normal
+  std::uint64_t bits;
+  std::memcpy(&bits, &shifted, sizeof(bits));
+  bits = (bits + 1022) << 52;
+  double scale;
+  std::memcpy(&scale, &bits, sizeof(scale));
+  double result = (2.0 * e) * scale;
+  result = underflow ? 0.0 : result;
+  result = overflow ? std::numeric_limits<double>::infinity() : result;
+  return isNaN ? x : result;
+}
+
+/**
+ * erf(y) for |y| <= 0.46875 with the rational approximation of W. J. Cody,
+ * Math. Comp. 23 (1969) 631.
+ */
+inline double erfSmall(const double y) {
+  const double ysq = y * y;
+  double num = 1.85777706184603153e-1 * ysq;
+  double den = ysq;
+  num = (num + 3.16112374387056560e00) * ysq;
+  den = (den + 2.36012909523441209e01) * ysq;
+  num = (num + 1.13864154151050156e02) * ysq;
+  den = (den + 2.44024637934444173e02) * ysq;
+  num = (num + 3.77485237685302021e02) * ysq;
+  den = (den + 1.28261652607737228e03) * ysq;
+  return y * (num + 3.20937758913846947e03) / (den + 2.84423683343917062e03);
+}
+
+/**
+ * erfcx(y) for y > 0.46875 with Cody's approximations. Both regions are
+ * evaluated and the right one is selected.
+ */
+inline double erfcxLarge(const double y) {
+  const bool isMedium = y <= ERF_LARGE;
+  // 0.46875 < y <= 4
+  double num = 2.15311535474403846e-8 * y;
+  double den = y;
+  num = (num + 5.64188496988670089e-1) * y;
+  den = (den + 1.57449261107098347e01) * y;
+  num = (num + 8.88314979438837594e00) * y;
+  den = (den + 1.17693950891312499e02) * y;
+  num = (num + 6.61191906371416295e01) * y;
+  den = (den + 5.37181101862009858e02) * y;
+  num = (num + 2.98635138197400131e02) * y;
+  den = (den + 1.62138957456669019e03) * y;
+  num = (num + 8.81952221241769090e02) * y;
+  den = (den + 3.29079923573345963e03) * y;
+  num = (num + 1.71204761263407058e03) * y;
+  den = (den + 4.36261909014324716e03) * y;
+  num = (num + 2.05107837782607147e03) * y;
+  den = (den + 3.43936767414372164e03) * y;
+  const double medium =
+      (num + 1.23033935479799725e03) / (den + 1.23033935480374942e03);
+
+  // y > 4: an asymptotic expansion in 1/y^2
+  const double z = 1.0 / (y * y);
+  num = 1.63153871373020978e-2 * z;
+  den = z;
+  num = (num + 3.05326634961232344e-1) * z;
+  den = (den + 2.56852019228982242e00) * z;
+  num = (num + 3.60344899949804439e-1) * z;
+  den = (den + 1.87295284992346725e00) * z;
+  num = (num + 1.25781726111229246e-1) * z;
+  den = (den + 5.27905102951428412e-1) * z;
+  num = (num + 1.60837851487422766e-2) * z;
+  den = (den + 6.05183413124413191e-2) * z;
+  const double large =
+      (ONE_OVER_SQRT_PI -
+       z * (num + 6.58749161529837803e-4) / (den + 2.33520497626869185e-3)) /
+      y;
+
+  return isMedium ? medium : large;
+}
+
+/// erfcx(x) for any x, using erfcx(-y) = 2 exp(y^2) - erfcx(y)
+inline double erfcxKernel(const double x) {
+  const bool negative = x < 0.0;
+  const double y = negative ? -x : x;
+  const bool isSmall = y <= ERF_SMALL;
+  const double expYsq = expKernel(y * y);
+  const double small = expYsq * (1.0 - erfSmall(y));
+  const double large = erfcxLarge(y);
+  const double value = isSmall ? small : large;
+  return negative ? 2.0 * expYsq - value : value;
+}
+
+/// exp(a) * erfc(b), using erfc(-y) = 2 - erfc(y)
+inline double expErfcKernel(const double a, const double b) {
+  const bool negative = b < 0.0;
+  const double y = negative ? -b : b;
+  const bool isSmall = y <= ERF_SMALL;
+  const double expA = expKernel(a);
+  const double small = expA * (1.0 - erfSmall(y));
+  // exp(a) * erfc(y) = exp(a - y^2) * erfcx(y)
+  const double large = expKernel(a - y * y) * erfcxLarge(y);
+  const double tail = isSmall ? small : large;
+  return negative ? 2.0 * expA - tail : tail;
+}
+} // namespace
+
+/**
+ * Calculate the exponential of an array.
+ * @param x :: The arguments
+ * @param out :: The results
+ * @param n :: The size of the arrays
+ */
+void vectorExp(const double *x, double *out, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = expKernel(x[i]);
+  }
+}
+
+/**
+ * Calculate the scaled complementary error function exp(x^2) * erfc(x) of
+ * an array.
+ * @param x :: The arguments
+ * @param out :: The results
+ * @param n :: The size of the arrays
+ */
+void vectorErfcx(const double *x, double *out, const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = erfcxKernel(x[i]);
+  }
+}
+
+/**
+ * Calculate exp(a) * erfc(b) for arrays of arguments. The result is finite
+ * whenever it is representable, even if exp(a) overflows.
+ * @param a :: The arguments of the exponential
+ * @param b :: The arguments of the complementary error function
+ * @param out :: The results
+ * @param n :: The size of the arrays
+ */
+void vectorExpErfc(const double *a, const double *b, double *out,
+                   const size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = expErfcKernel(a[i], b[i]);
+  }
+}
+
+/**
+ * @param x :: The argument
+ * @return exp(x^2) * erfc(x)
+ */
+double erfcx(const double x) { return erfcxKernel(x); }
+
+/**
+ * @param a :: The argument of the exponential
+ * @param b :: The argument of the complementary error function
+ * @return exp(a) * erfc(b)
+ */
+double expErfc(const double a, const double b) { return expErfcKernel(a, b); }
+
+} // namespace Math
+} // namespace Kernel
+} // namespace Mantid
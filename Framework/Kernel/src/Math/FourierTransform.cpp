@@ -0,0 +1,182 @@
+//-----------------------------------------------------------------------------
+// Includes
+//-----------------------------------------------------------------------------
+#include "MantidKernel/Math/FourierTransform.h"
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_real.h>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace Mantid {
+namespace Kernel {
+
+//-----------------------------------------------------------------------------
+// Plans and scratch space - keep the gsl stuff out of the headers
+//-----------------------------------------------------------------------------
+///@cond
+struct RealFourierTransformPlan {
+  explicit RealFourierTransformPlan(const size_t n)
+      : real(gsl_fft_real_wavetable_alloc(n)),
+        halfcomplex(gsl_fft_halfcomplex_wavetable_alloc(n)) {}
+  ~RealFourierTransformPlan() {
+    gsl_fft_halfcomplex_wavetable_free(halfcomplex);
+    gsl_fft_real_wavetable_free(real);
+  }
+  gsl_fft_real_wavetable *real;
+  gsl_fft_halfcomplex_wavetable *halfcomplex;
+};
+
+struct ComplexFourierTransformPlan {
+  explicit ComplexFourierTransformPlan(const size_t n)
+      : wavetable(gsl_fft_complex_wavetable_alloc(n)) {}
+  ~ComplexFourierTransformPlan() {
+    gsl_fft_complex_wavetable_free(wavetable);
+  }
+  gsl_fft_complex_wavetable *wavetable;
+};
+
+struct RealFourierTransformScratch {
+  explicit RealFourierTransformScratch(const size_t n)
+      : workspace(gsl_fft_real_workspace_alloc(n)) {}
+  ~RealFourierTransformScratch() { gsl_fft_real_workspace_free(workspace); }
+  gsl_fft_real_workspace *workspace;
+};
+
+struct ComplexFourierTransformScratch {
+  explicit ComplexFourierTransformScratch(const size_t n)
+      : workspace(gsl_fft_complex_workspace_alloc(n)) {}
+  ~ComplexFourierTransformScratch() {
+    gsl_fft_complex_workspace_free(workspace);
+  }
+  gsl_fft_complex_workspace *workspace;
+};
+///@endcond
+
+namespace {
+/// The number of sizes whose plans are kept. A program using more sizes than
+/// this starts again with an empty cache.
+const size_t MAX_CACHED_PLANS = 64;
+
+/// Find the plan of a size, creating it if it is not cached
+template <class Plan> std::shared_ptr<const Plan> getPlan(const size_t n) {
+  if (n == 0) {
+    throw std::invalid_argument("Cannot Fourier transform 0 values.");
+  }
+  static std::map<size_t, std::shared_ptr<const Plan>> plans;
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto plan = plans.find(n);
+  if (plan != plans.end()) {
+    return plan->second;
+  }
+  if (plans.size() >= MAX_CACHED_PLANS) {
+    plans.clear();
+  }
+  return plans.emplace(n, std::make_shared<const Plan>(n)).first->second;
+}
+
+void checkStatus(const int status) {
+  if (status != GSL_SUCCESS) {
+    throw std::runtime_error("Fourier transform failed: " +
+                             std::string(gsl_strerror(status)));
+  }
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+// RealFourierTransform
+//-----------------------------------------------------------------------------
+/**
+ * @param n :: The number of real values in a transform
+ */
+RealFourierTransform::RealFourierTransform(const size_t n)
+    : m_n(n), m_plan(getPlan<RealFourierTransformPlan>(n)),
+      m_scratch(new RealFourierTransformScratch(n)) {}
+
+RealFourierTransform::~RealFourierTransform() = default;
+
+/**
+ * Transform real data into its halfcomplex Fourier transform.
+ * @param data :: count consecutive arrays of size() values
+ * @param count :: The number of transforms
+ */
+void RealFourierTransform::forward(double *data, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    checkStatus(gsl_fft_real_transform(data + i * m_n, 1, m_n, m_plan->real,
+                                       m_scratch->workspace));
+  }
+}
+
+/**
+ * Transform halfcomplex data back into real data, without normalisation.
+ * @param data :: count consecutive arrays of size() values
+ * @param count :: The number of transforms
+ */
+void RealFourierTransform::backward(double *data, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    checkStatus(gsl_fft_halfcomplex_transform(data + i * m_n, 1, m_n,
+                                              m_plan->halfcomplex,
+                                              m_scratch->workspace));
+  }
+}
+
+/**
+ * Transform halfcomplex data back into real data, including the
+ * normalisation by 1 / size().
+ * @param data :: count consecutive arrays of size() values
+ * @param count :: The number of transforms
+ */
+void RealFourierTransform::inverse(double *data, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    checkStatus(gsl_fft_halfcomplex_inverse(data + i * m_n, 1, m_n,
+                                            m_plan->halfcomplex,
+                                            m_scratch->workspace));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// ComplexFourierTransform
+//-----------------------------------------------------------------------------
+/**
+ * @param n :: The number of complex values in a transform
+ */
+ComplexFourierTransform::ComplexFourierTransform(const size_t n)
+    : m_n(n), m_plan(getPlan<ComplexFourierTransformPlan>(n)),
+      m_scratch(new ComplexFourierTransformScratch(n)) {}
+
+ComplexFourierTransform::~ComplexFourierTransform() = default;
+
+/**
+ * Forward transform of complex data.
+ * @param data :: count consecutive arrays of 2 * size() values
+ * @param count :: The number of transforms
+ */
+void ComplexFourierTransform::forward(double *data, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    checkStatus(gsl_fft_complex_forward(data + 2 * i * m_n, 1, m_n,
+                                        m_plan->wavetable,
+                                        m_scratch->workspace));
+  }
+}
+
+/**
+ * Inverse transform of complex data, including the normalisation by
+ * 1 / size().
+ * @param data :: count consecutive arrays of 2 * size() values
+ * @param count :: The number of transforms
+ */
+void ComplexFourierTransform::inverse(double *data, const size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    checkStatus(gsl_fft_complex_inverse(data + 2 * i * m_n, 1, m_n,
+                                        m_plan->wavetable,
+                                        m_scratch->workspace));
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,92 @@
+#include "MantidKernel/MemoryMappedFile.h"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mantid {
+namespace Kernel {
+
+/**
+ * Map a file into memory
+ * @param filename :: The file to map
+ * @throw std::runtime_error if the file cannot be mapped
+ */
+MemoryMappedFile::MemoryMappedFile(const std::string &filename) {
+  const std::string error("Unable to map file " + filename + " into memory");
+#ifdef _WIN32
+  m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (m_file == INVALID_HANDLE_VALUE) {
+    m_file = nullptr;
+    throw std::runtime_error(error);
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(m_file, &size)) {
+    CloseHandle(m_file);
+    throw std::runtime_error(error);
+  }
+  m_size = static_cast<size_t>(size.QuadPart);
+  if (m_size == 0)
+    return;
+  m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!m_mapping) {
+    CloseHandle(m_file);
+    throw std::runtime_error(error);
+  }
+  m_data = static_cast<const char *>(
+      MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+  if (!m_data) {
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+    throw std::runtime_error(error);
+  }
+#else
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error(error);
+  struct stat status;
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw std::runtime_error(error);
+  }
+  m_size = static_cast<size_t>(status.st_size);
+  if (m_size > 0) {
+    void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error(error);
+    }
+    // The readers of mapped files mostly walk through them once
+    madvise(data, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const char *>(data);
+  }
+  // The mapping stays valid after the descriptor is closed
+  close(fd);
+#endif
+}
+
+/// Unmap the file
+MemoryMappedFile::~MemoryMappedFile() {
+#ifdef _WIN32
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping)
+    CloseHandle(m_mapping);
+  if (m_file)
+    CloseHandle(m_file);
+#else
+  if (m_data)
+    munmap(const_cast<char *>(m_data), m_size);
+#endif
+}
+
+} // namespace Kernel
+} // namespace Mantid
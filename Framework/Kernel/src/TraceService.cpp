@@ -0,0 +1,198 @@
+#include "MantidKernel/TraceService.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/Memory.h"
+
+#include <Poco/Process.h>
+
+#include <json/json.h>
+
+#include <fstream>
+#include <thread>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// static logger
+Logger g_log("TraceService");
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Constructor for TraceServiceImpl. Recording is enabled if a trace file is
+ * configured.
+ */
+TraceServiceImpl::TraceServiceImpl()
+    : m_origin(std::chrono::steady_clock::now()), m_enabled(false),
+      m_filename(ConfigService::Instance().getString("tracing.filename")) {
+  if (!m_filename.empty())
+    setEnabled(true);
+}
+
+/**
+ * Start or stop recording events. The events recorded so far are kept.
+ * @param enabled :: true to record events
+ */
+void TraceServiceImpl::setEnabled(const bool enabled) {
+  m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/// @returns the current time in microseconds since the service was created
+int64_t TraceServiceImpl::now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - m_origin).count();
+}
+
+/**
+ * Record a span on the calling thread that started at the given time and
+ * ends now.
+ * @param name :: The name of the span
+ * @param category :: The category of the span, e.g. algorithm
+ * @param start :: The start of the span as returned by now()
+ * @param args :: Values to attach to the span
+ */
+void TraceServiceImpl::addSpan(const std::string &name,
+                               const std::string &category,
+                               const int64_t start, const Arguments &args) {
+  if (!isEnabled())
+    return;
+  addEvent({name, category, 'X', start, now() - start, currentThread(), args});
+}
+
+/**
+ * Record the value of a counter at the current time
+ * @param name :: The name of the counter
+ * @param value :: The value of the counter
+ */
+void TraceServiceImpl::addCounter(const std::string &name,
+                                  const double value) {
+  if (!isEnabled())
+    return;
+  addEvent(
+      {name, "counter", 'C', now(), 0, currentThread(), {{"value", value}}});
+}
+
+/// @returns the number of recorded events
+size_t TraceServiceImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_events.size();
+}
+
+/// Discard the recorded events
+void TraceServiceImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+}
+
+/**
+ * @returns the recorded events as a JSON object in the Chrome trace-event
+ * format
+ */
+std::string TraceServiceImpl::toChromeTrace() const {
+  const auto pid = static_cast<int>(Poco::Process::id());
+  ::Json::Value events(::Json::arrayValue);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &event : m_events) {
+      ::Json::Value json;
+      json["name"] = event.name;
+      json["cat"] = event.category;
+      json["ph"] = std::string(1, event.phase);
+      json["ts"] = static_cast<double>(event.timestamp);
+      if (event.phase == 'X')
+        json["dur"] = static_cast<double>(event.duration);
+      json["pid"] = pid;
+      json["tid"] = event.thread;
+      if (!event.args.empty()) {
+        ::Json::Value args(::Json::objectValue);
+        for (const auto &arg : event.args)
+          args[arg.first] = arg.second;
+        json["args"] = args;
+      }
+      events.append(json);
+    }
+  }
+  ::Json::Value trace;
+  trace["traceEvents"] = events;
+  trace["displayTimeUnit"] = "ms";
+  ::Json::FastWriter writer;
+  return writer.write(trace);
+}
+
+/**
+ * Save the recorded events in the Chrome trace-event format
+ * @param filename :: The file to write
+ * @throw std::runtime_error if the file cannot be written
+ */
+void TraceServiceImpl::saveChromeTrace(const std::string &filename) const {
+  std::ofstream file(filename.c_str());
+  if (!file)
+    throw std::runtime_error("Unable to open trace file " + filename);
+  file << toChromeTrace();
+  if (!file)
+    throw std::runtime_error("Unable to write trace file " + filename);
+}
+
+/// Save the trace to the configured file, if any, and stop recording
+void TraceServiceImpl::shutdown() {
+  setEnabled(false);
+  if (m_filename.empty())
+    return;
+  try {
+    saveChromeTrace(m_filename);
+    g_log.notice() << "Saved trace to " << m_filename << "\n";
+  } catch (std::runtime_error &e) {
+    g_log.error() << e.what() << "\n";
+  }
+}
+
+/// @returns a small number identifying the calling thread
+int TraceServiceImpl::currentThread() {
+  static std::atomic<int> threads{0};
+  thread_local const int thread = threads++;
+  return thread;
+}
+
+void TraceServiceImpl::addEvent(Event event) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.push_back(std::move(event));
+}
+
+//----------------------------------------------------------------------------------------------
+/** Start a span
+ * @param name :: The name of the span
+ * @param category :: The category of the span, e.g. algorithm
+ */
+TraceSpan::TraceSpan(const std::string &name, const std::string &category)
+    : m_recording(TraceService::Instance().isEnabled()) {
+  if (m_recording) {
+    m_name = name;
+    m_category = category;
+    m_start = TraceService::Instance().now();
+  }
+}
+
+/// Record the span, the memory high-water mark and the current memory use
+TraceSpan::~TraceSpan() {
+  if (!m_recording)
+    return;
+  MemoryStats memory(MEMORY_STATS_IGNORE_SYSTEM);
+  m_args.emplace_back("peak_memory",
+                      static_cast<double>(memory.getPeakRSS()));
+  auto &service = TraceService::Instance();
+  service.addSpan(m_name, m_category, m_start, m_args);
+  service.addCounter("memory", static_cast<double>(memory.getCurrentRSS()));
+}
+
+/**
+ * Attach a value to the span. Does nothing if the span is not recorded.
+ * @param name :: The name of the value
+ * @param value :: The value
+ */
+void TraceSpan::addArgument(const std::string &name, const double value) {
+  if (m_recording)
+    m_args.emplace_back(name, value);
+}
+
+} // namespace Kernel
+} // namespace Mantid
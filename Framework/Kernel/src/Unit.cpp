@@ -198,6 +198,13 @@ std::pair<double, double> Unit::conversionRange() const {
   return std::pair<double, double>(std::min(u1, u2), std::max(u1, u2));
 }
 
+/// The default is a general conversion that is not a power law
+bool Unit::tofPowerLaw(double &factor, double &power) const {
+  UNUSED_ARG(factor);
+  UNUSED_ARG(power);
+  return false;
+}
+
 namespace Units {
 
 /* =============================================================================
@@ -287,6 +294,12 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+bool TOF::tofPowerLaw(double &factor, double &power) const {
+  factor = 1.0;
+  power = 1.0;
+  return true;
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -395,6 +408,14 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+/// The elastic conversion is a straight scaling of the time-of-flight
+bool Wavelength::tofPowerLaw(double &factor, double &power) const {
+  if (emode == 1 || emode == 2)
+    return false;
+  factor = factorTo;
+  power = 1.0;
+  return true;
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -471,6 +492,12 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+bool Energy::tofPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -0.5;
+  return true;
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -577,6 +604,11 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+bool dSpacing::tofPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = 1.0;
+  return true;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -688,6 +720,12 @@ double MomentumTransfer::singleFromTOF(const double tof) const {
   return factorFrom / temp;
 }
 
+bool MomentumTransfer::tofPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -1.0;
+  return true;
+}
+
 double MomentumTransfer::conversionTOFMin() const {
   return factorFrom / DBL_MAX;
 }
@@ -741,6 +779,12 @@ double QSquared::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+bool QSquared::tofPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -0.5;
+  return true;
+}
+
 double QSquared::conversionTOFMin() const {
   if (factorTo > 0)
     return factorTo / sqrt(DBL_MAX);
@@ -1114,6 +1158,13 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+/// The elastic wavelength relation is not inherited
+bool SpinEchoLength::tofPowerLaw(double &factor, double &power) const {
+  UNUSED_ARG(factor);
+  UNUSED_ARG(power);
+  return false;
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1159,6 +1210,13 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+/// The elastic wavelength relation is not inherited
+bool SpinEchoTime::tofPowerLaw(double &factor, double &power) const {
+  UNUSED_ARG(factor);
+  UNUSED_ARG(power);
+  return false;
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
@@ -0,0 +1,78 @@
+#include "MantidKernel/UnitConversionPlan.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+/** Constructor
+ * @param source :: The unit to convert from
+ * @param destination :: The unit to convert to
+ * @param size :: The number of spectra to hold coefficients for
+ */
+UnitConversionPlan::UnitConversionPlan(const Unit &source,
+                                       const Unit &destination,
+                                       const size_t size)
+    : m_source(source.clone()), m_destination(destination.clone()),
+      m_geometry(size, SpectrumGeometry{0.0, 0.0, 0.0, 0, 0.0, 0.0}),
+      m_factor(size, 0.0),
+      m_power(size, std::numeric_limits<double>::quiet_NaN()) {}
+
+/** Set the geometry of a spectrum and precompute its power law, if the
+ * conversion has one. Not thread safe.
+ * @param index :: The spectrum index
+ * @param l1 :: The source-sample distance (in metres)
+ * @param l2 :: The sample-detector distance (in metres)
+ * @param twoTheta :: The scattering angle (in radians)
+ * @param emode :: The energy mode (0=elastic, 1=direct, 2=indirect)
+ * @param efixed :: Value of fixed energy: EI (emode=1) or EF (emode=2)
+ * @param delta :: Not currently used
+ * @throw std::out_of_range if the index is not in the plan
+ */
+void UnitConversionPlan::setSpectrum(const size_t index, const double l1,
+                                     const double l2, const double twoTheta,
+                                     const int emode, const double efixed,
+                                     const double delta) {
+  if (index >= size())
+    throw std::out_of_range("UnitConversionPlan::setSpectrum() - index out "
+                            "of range");
+  m_geometry[index] = SpectrumGeometry{l1, l2, twoTheta, emode, efixed, delta};
+  m_power[index] = std::numeric_limits<double>::quiet_NaN();
+
+  initialize(index, *m_source, *m_destination);
+  double sourceFactor, sourcePower, destinationFactor, destinationPower;
+  if (!m_source->tofPowerLaw(sourceFactor, sourcePower) ||
+      !m_destination->tofPowerLaw(destinationFactor, destinationPower))
+    return;
+  // tof = a * x^p = b * y^q, so y = (a / b)^(1 / q) * x^(p / q)
+  const double factor =
+      std::pow(sourceFactor / destinationFactor, 1.0 / destinationPower);
+  if (!std::isfinite(factor) || factor == 0.0)
+    return;
+  m_factor[index] = factor;
+  m_power[index] = sourcePower / destinationPower;
+}
+
+/// @return true if spectrum index converts as output = factor * input^power
+bool UnitConversionPlan::isPowerLaw(const size_t index) const {
+  return !std::isnan(m_power[index]);
+}
+
+/** Initialize a pair of units with the geometry of a spectrum, e.g. for
+ * converting events of a spectrum that is not a power law.
+ * @param index :: The spectrum index
+ * @param source :: A unit of the source type
+ * @param destination :: A unit of the destination type
+ */
+void UnitConversionPlan::initialize(const size_t index, Unit &source,
+                                    Unit &destination) const {
+  const auto &geometry = m_geometry[index];
+  source.initialize(geometry.l1, geometry.l2, geometry.twoTheta,
+                    geometry.emode, geometry.efixed, geometry.delta);
+  destination.initialize(geometry.l1, geometry.l2, geometry.twoTheta,
+                         geometry.emode, geometry.efixed, geometry.delta);
+}
+
+} // namespace Kernel
+} // namespace Mantid
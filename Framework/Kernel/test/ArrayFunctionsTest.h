@@ -0,0 +1,112 @@
+#ifndef MANTID_KERNEL_ARRAYFUNCTIONSTEST_H_
+#define MANTID_KERNEL_ARRAYFUNCTIONSTEST_H_
+
+#include "MantidKernel/Math/ArrayFunctions.h"
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace Mantid::Kernel::Math;
+
+class ArrayFunctionsTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ArrayFunctionsTest *createSuite() { return new ArrayFunctionsTest(); }
+  static void destroySuite(ArrayFunctionsTest *suite) { delete suite; }
+
+  void test_exp_agrees_with_std_exp() {
+    std::vector<double> x;
+    for (double value = -700.0; value < 700.0; value += 0.37) {
+      x.push_back(value);
+    }
+    std::vector<double> out(x.size());
+    vectorExp(x.data(), out.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      const double expected = std::exp(x[i]);
+      TS_ASSERT_DELTA(out[i] / expected, 1.0, 1e-15);
+    }
+  }
+
+  void test_exp_special_values() {
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> x{0.0, -inf, inf, -800.0, 800.0,
+                          std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> out(x.size());
+    vectorExp(x.data(), out.data(), x.size());
+    TS_ASSERT_EQUALS(out[0], 1.0);
+    TS_ASSERT_EQUALS(out[1], 0.0);
+    TS_ASSERT_EQUALS(out[2], inf);
+    TS_ASSERT_EQUALS(out[3], 0.0);
+    TS_ASSERT_EQUALS(out[4], inf);
+    TS_ASSERT(std::isnan(out[5]));
+  }
+
+  void test_exp_in_place() {
+    std::vector<double> x{-1.0, 0.5, 2.0};
+    vectorExp(x.data(), x.data(), x.size());
+    TS_ASSERT_DELTA(x[0], std::exp(-1.0), 1e-15);
+    TS_ASSERT_DELTA(x[1], std::exp(0.5), 1e-15);
+    TS_ASSERT_DELTA(x[2], std::exp(2.0), 1e-14);
+  }
+
+  void test_erfcx_agrees_with_erfc() {
+    // Cover the three regions of the approximation and negative arguments
+    std::vector<double> x;
+    for (double value = -5.0; value < 20.0; value += 0.013) {
+      x.push_back(value);
+    }
+    std::vector<double> out(x.size());
+    vectorErfcx(x.data(), out.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      // exp(x^2) * erfc(x) loses accuracy where erfc is small
+      if (x[i] > 5.0)
+        continue;
+      const double expected = std::exp(x[i] * x[i]) * std::erfc(x[i]);
+      TS_ASSERT_DELTA(out[i] / expected, 1.0, 1e-13);
+      TS_ASSERT_EQUALS(erfcx(x[i]), out[i]);
+    }
+  }
+
+  void test_erfcx_asymptotic() {
+    // erfcx(x) ~ 1 / (x sqrt(pi)) * (1 - 1 / (2x^2) + 3 / (4x^4))
+    for (double x : {100.0, 1e4, 1e8}) {
+      const double x2 = x * x;
+      const double expected =
+          (1.0 - 0.5 / x2 + 0.75 / (x2 * x2)) / (x * std::sqrt(M_PI));
+      TS_ASSERT_DELTA(erfcx(x) / expected, 1.0, 1e-10);
+    }
+    TS_ASSERT_EQUALS(erfcx(std::numeric_limits<double>::infinity()), 0.0);
+    TS_ASSERT_EQUALS(erfcx(0.0), 1.0);
+  }
+
+  void test_expErfc_agrees_with_exp_times_erfc() {
+    std::vector<double> a, b;
+    for (double ai = -20.0; ai < 20.0; ai += 1.7) {
+      for (double bi = -5.0; bi < 5.0; bi += 0.11) {
+        a.push_back(ai);
+        b.push_back(bi);
+      }
+    }
+    std::vector<double> out(a.size());
+    vectorExpErfc(a.data(), b.data(), out.data(), a.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+      const double expected = std::exp(a[i]) * std::erfc(b[i]);
+      TS_ASSERT_DELTA(out[i] / expected, 1.0, 1e-13);
+      TS_ASSERT_EQUALS(expErfc(a[i], b[i]), out[i]);
+    }
+  }
+
+  void test_expErfc_does_not_overflow() {
+    // exp(1000) overflows but exp(1000) * erfc(40) ~ 3.737e-263
+    const double value = expErfc(1000.0, 40.0);
+    const double expected = std::exp(1000.0 - 1600.0) * erfcx(40.0);
+    TS_ASSERT(std::isfinite(value));
+    TS_ASSERT_DELTA(value / expected, 1.0, 1e-12);
+    TS_ASSERT_DELTA(value / 3.73715e-263, 1.0, 1e-5);
+  }
+};
+
+#endif /* MANTID_KERNEL_ARRAYFUNCTIONSTEST_H_ */
@@ -358,6 +358,97 @@ public:
     TS_ASSERT_EQUALS(*svc.retrieve("item2345"), 2345);
   }
 
+  // Handler that looks up the replaced object while being notified
+  void handleBeforeReplaceWithLookup(
+      const Poco::AutoPtr<FakeDataService::BeforeReplaceNotification> &
+          notification) {
+    TS_ASSERT_EQUALS(svc.retrieve(notification->objectName()),
+                     notification->oldObject());
+    ++notificationFlag;
+  }
+
+  // Handler that adds another object while being notified
+  void handlePreDeleteWithAdd(
+      const Poco::AutoPtr<FakeDataService::PreDeleteNotification> &
+          notification) {
+    TS_ASSERT(!svc.doesExist(notification->objectName()));
+    svc.addOrReplace("added_by_observer", boost::make_shared<int>(7));
+    ++notificationFlag;
+  }
+
+  void test_observers_can_use_the_service() {
+    Poco::NObserver<DataServiceTest, FakeDataService::BeforeReplaceNotification>
+        observer(*this, &DataServiceTest::handleBeforeReplaceWithLookup);
+    svc.notificationCenter.addObserver(observer);
+    Poco::NObserver<DataServiceTest, FakeDataService::PreDeleteNotification>
+        observer2(*this, &DataServiceTest::handlePreDeleteWithAdd);
+    svc.notificationCenter.addObserver(observer2);
+
+    svc.add("one", boost::make_shared<int>(1));
+    svc.addOrReplace("one", boost::make_shared<int>(2));
+    svc.add("two", boost::make_shared<int>(3));
+    svc.rename("two", "one");
+    svc.remove("one");
+
+    TS_ASSERT_EQUALS(notificationFlag, 3);
+    TS_ASSERT_EQUALS(*svc.retrieve("added_by_observer"), 7);
+    svc.notificationCenter.removeObserver(observer);
+    svc.notificationCenter.removeObserver(observer2);
+  }
+
+  // Handler that removes the replaced object while being notified
+  void handleBeforeReplaceWithRemove(
+      const Poco::AutoPtr<FakeDataService::BeforeReplaceNotification> &
+          notification) {
+    svc.remove(notification->objectName());
+    svc.remove("renamed_away");
+    ++notificationFlag;
+  }
+
+  void test_objects_removed_while_unlocked_are_looked_up_again() {
+    Poco::NObserver<DataServiceTest, FakeDataService::BeforeReplaceNotification>
+        observer(*this, &DataServiceTest::handleBeforeReplaceWithRemove);
+    svc.notificationCenter.addObserver(observer);
+    Poco::NObserver<DataServiceTest, FakeDataService::AddNotification>
+        observer2(*this, &DataServiceTest::handleAddNotification);
+
+    svc.add("one", boost::make_shared<int>(1));
+    svc.notificationCenter.addObserver(observer2);
+    // The replaced object has gone so the new one is added
+    const auto added = vector.size();
+    TS_ASSERT_THROWS_NOTHING(
+        svc.addOrReplace("one", boost::make_shared<int>(2)));
+    TS_ASSERT_EQUALS(*svc.retrieve("one"), 2);
+    TS_ASSERT_EQUALS(vector.size(), added + 1);
+    svc.notificationCenter.removeObserver(observer2);
+
+    svc.add("renamed_away", boost::make_shared<int>(3));
+    TS_ASSERT_THROWS(svc.rename("renamed_away", "one"),
+                     Exception::NotFoundError);
+    TS_ASSERT(!svc.doesExist("renamed_away"));
+    TS_ASSERT(!svc.doesExist("one"));
+    TS_ASSERT_EQUALS(notificationFlag, 3);
+    svc.notificationCenter.removeObserver(observer);
+  }
+
+  void test_concurrent_reads_during_writes() {
+    for (int i = 0; i < 100; ++i)
+      svc.add("object" + std::to_string(i), boost::make_shared<int>(i));
+
+    int num = 5000;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < num; i++) {
+      const std::string name = "object" + std::to_string(i % 100);
+      if (i % 10 == 0) {
+        svc.addOrReplace(name, boost::make_shared<int>(i % 100));
+      } else {
+        TS_ASSERT(svc.doesExist(name));
+        TS_ASSERT_EQUALS(*svc.retrieve(name), i % 100);
+      }
+    }
+    TS_ASSERT_EQUALS(svc.size(), 100);
+  }
+
   void test_prefixToHide() {
     TS_ASSERT_EQUALS(FakeDataService::prefixToHide(), "__");
   }
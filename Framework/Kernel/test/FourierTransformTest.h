@@ -0,0 +1,101 @@
+#ifndef MANTID_KERNEL_FOURIERTRANSFORMTEST_H_
+#define MANTID_KERNEL_FOURIERTRANSFORMTEST_H_
+
+#include "MantidKernel/Math/FourierTransform.h"
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using Mantid::Kernel::ComplexFourierTransform;
+using Mantid::Kernel::RealFourierTransform;
+
+class FourierTransformTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FourierTransformTest *createSuite() {
+    return new FourierTransformTest();
+  }
+  static void destroySuite(FourierTransformTest *suite) { delete suite; }
+
+  void test_zero_size_throws() {
+    TS_ASSERT_THROWS(RealFourierTransform(0), std::invalid_argument);
+    TS_ASSERT_THROWS(ComplexFourierTransform(0), std::invalid_argument);
+  }
+
+  void test_real_forward_transform_of_cosine() {
+    const size_t n = 12;
+    std::vector<double> data(n);
+    for (size_t i = 0; i < n; ++i) {
+      data[i] = std::cos(2.0 * M_PI * 3.0 * static_cast<double>(i) / n);
+    }
+    RealFourierTransform fft(n);
+    TS_ASSERT_EQUALS(fft.size(), n);
+    fft.forward(data.data());
+    // The halfcomplex layout is r0, r1, i1, r2, i2, ..., r6
+    for (size_t i = 0; i < n; ++i) {
+      TS_ASSERT_DELTA(data[i], i == 5 ? n / 2.0 : 0.0, 1e-12);
+    }
+  }
+
+  void test_real_round_trip_of_several_arrays() {
+    const size_t n = 15;
+    const size_t count = 3;
+    std::vector<double> data(n * count);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = std::sin(0.3 * static_cast<double>(i * i));
+    }
+    const auto original = data;
+    RealFourierTransform fft(n);
+    fft.forward(data.data(), count);
+    // Each array is transformed on its own
+    std::vector<double> second(original.begin() + n,
+                               original.begin() + 2 * n);
+    RealFourierTransform(n).forward(second.data());
+    for (size_t i = 0; i < n; ++i) {
+      TS_ASSERT_DELTA(data[n + i], second[i], 1e-12);
+    }
+    fft.inverse(data.data(), count);
+    for (size_t i = 0; i < data.size(); ++i) {
+      TS_ASSERT_DELTA(data[i], original[i], 1e-12);
+    }
+  }
+
+  void test_real_backward_transform_is_not_normalised() {
+    const size_t n = 8;
+    std::vector<double> data{1.0, 2.0, 0.5, -1.0, 3.0, 0.0, 1.5, 2.5};
+    const auto original = data;
+    RealFourierTransform fft(n);
+    fft.forward(data.data());
+    fft.backward(data.data());
+    for (size_t i = 0; i < n; ++i) {
+      TS_ASSERT_DELTA(data[i], n * original[i], 1e-12);
+    }
+  }
+
+  void test_complex_forward_transform_of_exponential() {
+    const size_t n = 10;
+    std::vector<double> data(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+      const double phase = 2.0 * M_PI * 2.0 * static_cast<double>(i) / n;
+      data[2 * i] = std::cos(phase);
+      data[2 * i + 1] = std::sin(phase);
+    }
+    const auto original = data;
+    ComplexFourierTransform fft(n);
+    fft.forward(data.data());
+    for (size_t i = 0; i < n; ++i) {
+      TS_ASSERT_DELTA(data[2 * i], i == 2 ? static_cast<double>(n) : 0.0,
+                      1e-12);
+      TS_ASSERT_DELTA(data[2 * i + 1], 0.0, 1e-12);
+    }
+    fft.inverse(data.data());
+    for (size_t i = 0; i < data.size(); ++i) {
+      TS_ASSERT_DELTA(data[i], original[i], 1e-12);
+    }
+  }
+};
+
+#endif /* MANTID_KERNEL_FOURIERTRANSFORMTEST_H_ */
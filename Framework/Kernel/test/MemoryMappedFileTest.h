@@ -0,0 +1,49 @@
+#ifndef MANTID_KERNEL_MEMORYMAPPEDFILETEST_H_
+#define MANTID_KERNEL_MEMORYMAPPEDFILETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MemoryMappedFile.h"
+
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+
+#include <fstream>
+
+using Mantid::Kernel::MemoryMappedFile;
+
+class MemoryMappedFileTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MemoryMappedFileTest *createSuite() {
+    return new MemoryMappedFileTest();
+  }
+  static void destroySuite(MemoryMappedFileTest *suite) { delete suite; }
+
+  void test_contents_are_mapped() {
+    Poco::TemporaryFile file;
+    const std::string contents("Mapped contents\n");
+    {
+      std::ofstream stream(file.path().c_str(), std::ios::binary);
+      stream << contents;
+    }
+    MemoryMappedFile mapped(file.path());
+    TS_ASSERT_EQUALS(mapped.size(), contents.size());
+    TS_ASSERT_EQUALS(std::string(mapped.data(), mapped.size()), contents);
+  }
+
+  void test_empty_file() {
+    Poco::TemporaryFile file;
+    file.createFile();
+    MemoryMappedFile mapped(file.path());
+    TS_ASSERT_EQUALS(mapped.size(), 0);
+  }
+
+  void test_missing_file_throws() {
+    TS_ASSERT_THROWS(MemoryMappedFile("MemoryMappedFileTest_missing.bin"),
+                     std::runtime_error);
+  }
+};
+
+#endif /* MANTID_KERNEL_MEMORYMAPPEDFILETEST_H_ */
@@ -0,0 +1,103 @@
+#ifndef MANTID_KERNEL_TRACESERVICETEST_H_
+#define MANTID_KERNEL_TRACESERVICETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/TraceService.h"
+#include <json/json.h>
+
+using Mantid::Kernel::TraceService;
+using Mantid::Kernel::TraceSpan;
+
+class TraceServiceTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TraceServiceTest *createSuite() { return new TraceServiceTest(); }
+  static void destroySuite(TraceServiceTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_wasEnabled = TraceService::Instance().isEnabled();
+    TraceService::Instance().clear();
+  }
+
+  void tearDown() override {
+    TraceService::Instance().setEnabled(m_wasEnabled);
+    TraceService::Instance().clear();
+  }
+
+  void test_nothing_is_recorded_while_disabled() {
+    auto &service = TraceService::Instance();
+    service.setEnabled(false);
+    {
+      TraceSpan span("Span", "Test");
+      TS_ASSERT(!span.isRecording());
+      span.addArgument("value", 1.0);
+    }
+    service.addSpan("Span", "Test", service.now());
+    service.addCounter("Counter", 1.0);
+    TS_ASSERT_EQUALS(service.size(), 0);
+  }
+
+  void test_span_records_itself_and_memory_counter() {
+    auto &service = TraceService::Instance();
+    service.setEnabled(true);
+    {
+      TraceSpan span("Span", "Test");
+      TS_ASSERT(span.isRecording());
+      span.addArgument("bytes_read", 42.0);
+    }
+    TS_ASSERT_EQUALS(service.size(), 2);
+
+    const auto trace = parse(service.toChromeTrace());
+    const auto &events = trace["traceEvents"];
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0]["name"].asString(), "Span");
+    TS_ASSERT_EQUALS(events[0]["cat"].asString(), "Test");
+    TS_ASSERT_EQUALS(events[0]["ph"].asString(), "X");
+    TS_ASSERT(events[0].isMember("dur"));
+    TS_ASSERT(events[0].isMember("tid"));
+    TS_ASSERT_EQUALS(events[0]["args"]["bytes_read"].asDouble(), 42.0);
+    TS_ASSERT(events[0]["args"].isMember("peak_memory"));
+    TS_ASSERT_EQUALS(events[1]["ph"].asString(), "C");
+    TS_ASSERT(events[1]["args"].isMember("value"));
+  }
+
+  void test_nested_spans_are_recorded_innermost_first() {
+    auto &service = TraceService::Instance();
+    service.setEnabled(true);
+    const auto start = service.now();
+    service.addSpan("Inner", "Test", start);
+    service.addSpan("Outer", "Test", start);
+
+    const auto trace = parse(service.toChromeTrace());
+    const auto &events = trace["traceEvents"];
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0]["name"].asString(), "Inner");
+    TS_ASSERT_EQUALS(events[1]["name"].asString(), "Outer");
+    TS_ASSERT_EQUALS(events[0]["ts"].asDouble(), events[1]["ts"].asDouble());
+    TS_ASSERT(events[0]["dur"].asDouble() <= events[1]["dur"].asDouble());
+  }
+
+  void test_clear() {
+    auto &service = TraceService::Instance();
+    service.setEnabled(true);
+    service.addCounter("Counter", 1.0);
+    TS_ASSERT_EQUALS(service.size(), 1);
+    service.clear();
+    TS_ASSERT_EQUALS(service.size(), 0);
+    TS_ASSERT_EQUALS(parse(service.toChromeTrace())["traceEvents"].size(), 0);
+  }
+
+private:
+  ::Json::Value parse(const std::string &json) {
+    ::Json::Value value;
+    ::Json::Reader reader;
+    TS_ASSERT(reader.parse(json, value));
+    return value;
+  }
+
+  bool m_wasEnabled = false;
+};
+
+#endif /* MANTID_KERNEL_TRACESERVICETEST_H_ */
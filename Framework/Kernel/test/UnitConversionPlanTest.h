@@ -0,0 +1,121 @@
+#ifndef MANTID_KERNEL_UNITCONVERSIONPLANTEST_H_
+#define MANTID_KERNEL_UNITCONVERSIONPLANTEST_H_
+
+#include <cxxtest/TestSuite.h>
+#include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitConversionPlan.h"
+
+#include <stdexcept>
+
+using Mantid::Kernel::Unit;
+using Mantid::Kernel::UnitConversionPlan;
+using namespace Mantid::Kernel::Units;
+
+namespace {
+/// Convert the values through TOF, as Unit::toTOF/fromTOF do
+std::vector<double> convertViaTOF(Unit &source, Unit &destination,
+                                  std::vector<double> x, const double l1,
+                                  const double l2, const double twoTheta,
+                                  const int emode, const double efixed) {
+  std::vector<double> empty;
+  source.toTOF(x, empty, l1, l2, twoTheta, emode, efixed, 0.0);
+  destination.fromTOF(x, empty, l1, l2, twoTheta, emode, efixed, 0.0);
+  return x;
+}
+}
+
+class UnitConversionPlanTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static UnitConversionPlanTest *createSuite() {
+    return new UnitConversionPlanTest();
+  }
+  static void destroySuite(UnitConversionPlanTest *suite) { delete suite; }
+
+  void test_power_laws_match_conversion_via_TOF() {
+    TOF tof;
+    Wavelength wavelength;
+    Energy energy;
+    dSpacing d;
+    MomentumTransfer q;
+    QSquared q2;
+    std::vector<Unit *> units{&tof, &wavelength, &energy, &d, &q, &q2};
+    const std::vector<double> x{0.5, 1.0, 2.5, 1000.0};
+    for (auto source : units) {
+      for (auto destination : units) {
+        UnitConversionPlan plan(*source, *destination, 2);
+        plan.setSpectrum(0, 10.0, 1.1, 0.3, 0, 0.0);
+        plan.setSpectrum(1, 12.0, 2.5, -1.2, 0, 0.0);
+        for (size_t i = 0; i < 2; ++i) {
+          TSM_ASSERT(source->unitID() + "->" + destination->unitID(),
+                     plan.isPowerLaw(i));
+          auto converted = x;
+          plan.convert(i, converted.begin(), converted.end());
+          const auto expected =
+              convertViaTOF(*source, *destination, x, i == 0 ? 10.0 : 12.0,
+                            i == 0 ? 1.1 : 2.5, i == 0 ? 0.3 : -1.2, 0, 0.0);
+          for (size_t j = 0; j < x.size(); ++j)
+            TS_ASSERT_DELTA(converted[j] / expected[j], 1.0, 1e-12);
+        }
+      }
+    }
+  }
+
+  void test_inelastic_wavelength_is_converted_via_TOF() {
+    Wavelength wavelength;
+    Energy energy;
+    UnitConversionPlan plan(wavelength, energy, 1);
+    plan.setSpectrum(0, 10.0, 1.1, 0.3, 1, 12.0);
+    TS_ASSERT(!plan.isPowerLaw(0));
+    std::vector<double> converted{1.0, 2.0, 3.0};
+    plan.convert(0, converted.begin(), converted.end());
+    const auto expected = convertViaTOF(wavelength, energy, {1.0, 2.0, 3.0},
+                                        10.0, 1.1, 0.3, 1, 12.0);
+    TS_ASSERT_EQUALS(converted, expected);
+  }
+
+  void test_general_units_are_converted_via_TOF() {
+    TOF tof;
+    DeltaE deltaE;
+    UnitConversionPlan plan(tof, deltaE, 1);
+    plan.setSpectrum(0, 10.0, 1.1, 0.3, 1, 12.0);
+    TS_ASSERT(!plan.isPowerLaw(0));
+    std::vector<double> converted{4000.0, 5000.0};
+    plan.convert(0, converted.begin(), converted.end());
+    const auto expected =
+        convertViaTOF(tof, deltaE, {4000.0, 5000.0}, 10.0, 1.1, 0.3, 1, 12.0);
+    TS_ASSERT_EQUALS(converted, expected);
+  }
+
+  void test_zero_angle_is_not_a_power_law() {
+    TOF tof;
+    dSpacing d;
+    UnitConversionPlan plan(tof, d, 1);
+    plan.setSpectrum(0, 10.0, 1.1, 0.0, 0, 0.0);
+    TS_ASSERT(!plan.isPowerLaw(0));
+  }
+
+  void test_setSpectrum_throws_for_bad_index() {
+    TOF tof;
+    dSpacing d;
+    UnitConversionPlan plan(tof, d, 1);
+    TS_ASSERT_THROWS(plan.setSpectrum(1, 10.0, 1.1, 0.3, 0, 0.0),
+                     std::out_of_range);
+  }
+
+  void test_applyPowerLaw() {
+    for (const double power : {1.0, -1.0, 2.0, -2.0, 0.5, -0.5, 3.0}) {
+      std::vector<double> x{1.5, 2.0, 7.0};
+      UnitConversionPlan::applyPowerLaw(2.0, power, x.begin(), x.end(),
+                                        [](double &v) -> double & {
+                                          return v;
+                                        });
+      TS_ASSERT_DELTA(x[0], 2.0 * std::pow(1.5, power), 1e-12);
+      TS_ASSERT_DELTA(x[1], 2.0 * std::pow(2.0, power), 1e-12);
+      TS_ASSERT_DELTA(x[2], 2.0 * std::pow(7.0, power), 1e-12);
+    }
+  }
+};
+
+#endif /* MANTID_KERNEL_UNITCONVERSIONPLANTEST_H_ */
@@ -14,6 +14,7 @@
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 #include <climits>
+#include <functional>
 #include <nexus/NeXusFile.hpp>
 
 namespace Mantid {
@@ -141,6 +142,10 @@ private:
                     const int nxType,
                     const std::vector<std::string> &attributes,
                     const std::vector<std::string> &avalues) const;
+  /// Write a compressed 2D dataset one row at a time
+  void writeCompressedRows(
+      const std::string &name, size_t nRows, size_t rowLength,
+      const std::function<const double *(size_t)> &row) const;
   /// Returns true if the given property is a time series property
   bool isTimeSeries(Kernel::Property *prop) const;
   /// Write a time series log entry
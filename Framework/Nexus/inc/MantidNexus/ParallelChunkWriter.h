@@ -0,0 +1,83 @@
+#ifndef MANTID_NEXUS_PARALLELCHUNKWRITER_H_
+#define MANTID_NEXUS_PARALLELCHUNKWRITER_H_
+
+#include "MantidKernel/System.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace NeXus {
+
+/** ParallelChunkWriter : Writes the data of a chunked, deflate compressed
+  dataset in an HDF5 file. The chunks are compressed on several threads and
+  the compressed chunks are handed to HDF5 in order, so compression no longer
+  limits the speed of writing a large dataset.
+
+  The dataset must already exist, for instance created with NXcompmakedata,
+  and its chunks must span all dimensions but the first. The file may be open
+  through the NeXus API at the same time, HDF5 shares the file between both.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>.
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport ParallelChunkWriter {
+public:
+  ParallelChunkWriter(const std::string &filename, const std::string &path);
+  ~ParallelChunkWriter();
+  ParallelChunkWriter(const ParallelChunkWriter &) = delete;
+  ParallelChunkWriter &operator=(const ParallelChunkWriter &) = delete;
+
+  /// Whether the chunks of the dataset can be written by this class
+  bool isSupported() const { return m_dataset >= 0; }
+  /// The number of chunks along the first dimension of the dataset
+  size_t numberOfChunks() const { return m_numberOfChunks; }
+
+  void write(const std::function<const void *(size_t)> &chunkData);
+  void write(const void *data);
+
+private:
+  bool readLayout();
+
+  /// The path of the dataset in the file
+  const std::string m_path;
+  /// HDF5 identifiers of the file and the dataset
+  int64_t m_file = -1;
+  int64_t m_dataset = -1;
+  /// The deflate level set on the dataset
+  int m_level = 0;
+  /// The number of dimensions of the dataset
+  int m_rank = 0;
+  /// The size of the first dimension of the dataset and of a chunk
+  size_t m_rows = 0;
+  size_t m_chunkRows = 0;
+  /// The number of bytes in a row and in a whole chunk
+  size_t m_rowBytes = 0;
+  size_t m_chunkBytes = 0;
+  size_t m_numberOfChunks = 0;
+};
+
+} // namespace NeXus
+} // namespace Mantid
+
+#endif /* MANTID_NEXUS_PARALLELCHUNKWRITER_H_ */
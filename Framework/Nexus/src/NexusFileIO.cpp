@@ -1,5 +1,6 @@
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidNexus/NexusFileIO.h"
+#include "MantidNexus/ParallelChunkWriter.h"
 
 #include <Poco/File.h>
 #include <Poco/Path.h>
@@ -34,6 +36,8 @@ using namespace DataObjects;
 namespace {
 /// static logger
 Logger g_log("NexusFileIO");
+/// The number of values in each chunk of a compressed list
+constexpr int EVENT_CHUNK_SIZE = 262144;
 }
 
 /// Empty default constructor
@@ -342,17 +346,12 @@ int NexusFileIO::writeNexusProcessedData2D(
 
   // -------------- Actually write the 2D data ----------------------------
   if (write2Ddata) {
-    std::string name = "values";
-    NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                   m_nexuscompression, asize);
-    NXopendata(fileID, name.c_str());
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->y(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    writeCompressedRows("values", nSpect, nSpectBins, [&](size_t i) {
+      return localworkspace->y(spec[i]).rawData().data();
+    });
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
+    NXopendata(fileID, "values");
     int signal = 1;
     NXputattr(fileID, "signal", &signal, 1, NX_INT32);
     // More properties
@@ -368,16 +367,9 @@ int NexusFileIO::writeNexusProcessedData2D(
     NXclosedata(fileID);
 
     // error
-    name = "errors";
-    NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                   m_nexuscompression, asize);
-    NXopendata(fileID, name.c_str());
-    start[0] = 0;
-    for (size_t i = 0; i < nSpect; i++) {
-      int s = spec[i];
-      NXputslab(fileID, localworkspace->e(s).rawData().data(), start, asize);
-      start[0]++;
-    }
+    writeCompressedRows("errors", nSpect, nSpectBins, [&](size_t i) {
+      return localworkspace->e(spec[i]).rawData().data();
+    });
 
     if (m_progress != nullptr)
       m_progress->reportIncrement(1, "Writing data");
@@ -386,38 +378,20 @@ int NexusFileIO::writeNexusProcessedData2D(
     if (localworkspace->id() == "RebinnedOutput") {
       RebinnedOutput_const_sptr rebin_workspace =
           boost::dynamic_pointer_cast<const RebinnedOutput>(localworkspace);
-      name = "frac_area";
-      NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
-                     m_nexuscompression, asize);
-      NXopendata(fileID, name.c_str());
-      start[0] = 0;
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, rebin_workspace->readF(s).data(), start, asize);
-        start[0]++;
-      }
+      writeCompressedRows("frac_area", nSpect, nSpectBins, [&](size_t i) {
+        return rebin_workspace->readF(spec[i]).data();
+      });
       if (m_progress != nullptr)
         m_progress->reportIncrement(1, "Writing data");
     }
 
     // Potentially x error
     if (localworkspace->hasDx(0)) {
-      dims_array[0] = static_cast<int>(nSpect);
-      dims_array[1] = static_cast<int>(localworkspace->dx(0).size());
-      std::string dxErrorName = "xerrors";
-      NXcompmakedata(fileID, dxErrorName.c_str(), NX_FLOAT64, 2, dims_array,
-                     m_nexuscompression, asize);
-      NXopendata(fileID, dxErrorName.c_str());
-      start[0] = 0;
-      asize[1] = dims_array[1];
-      for (size_t i = 0; i < nSpect; i++) {
-        int s = spec[i];
-        NXputslab(fileID, localworkspace->dx(s).rawData().data(), start, asize);
-        start[0]++;
-      }
+      writeCompressedRows("xerrors", nSpect, localworkspace->dx(0).size(),
+                          [&](size_t i) {
+                            return localworkspace->dx(spec[i]).rawData().data();
+                          });
     }
-
-    NXclosedata(fileID);
   }
 
   // write X data, as single array or all values if "ragged"
@@ -797,15 +771,60 @@ int NexusFileIO::writeNexusProcessedDataEvent(
   return ((status == NX_ERROR) ? 3 : 0);
 }
 
+//-------------------------------------------------------------------------------------
+/** Write a 2D dataset with one row per chunk. The rows of HDF5 files are
+ * compressed on several threads at once and written straight into the file.
+ * @param name :: The name of the dataset in the open group
+ * @param nRows :: The number of rows
+ * @param rowLength :: The number of values in each row
+ * @param row :: Returns the values of a row. It may be called from several
+ * threads at once.
+ */
+void NexusFileIO::writeCompressedRows(
+    const std::string &name, size_t nRows, size_t rowLength,
+    const std::function<const double *(size_t)> &row) const {
+  int dims_array[2] = {static_cast<int>(nRows), static_cast<int>(rowLength)};
+  int asize[2] = {1, dims_array[1]};
+  NXcompmakedata(fileID, name.c_str(), NX_FLOAT64, 2, dims_array,
+                 m_nexuscompression, asize);
+  if (m_nexuscompression == NX_COMP_LZW && nRows > 1) {
+    ParallelChunkWriter writer(m_filename,
+                               m_filehandle->getPath() + "/" + name);
+    if (writer.isSupported()) {
+      writer.write(
+          [&row](size_t i) { return static_cast<const void *>(row(i)); });
+      return;
+    }
+  }
+
+  NXopendata(fileID, name.c_str());
+  int start[2] = {0, 0};
+  for (size_t i = 0; i < nRows; i++) {
+    NXputslab(fileID, row(i), start, asize);
+    start[0]++;
+  }
+  NXclosedata(fileID);
+}
+
 //-------------------------------------------------------------------------------------
 /** Write out an array to the open file. */
 void NexusFileIO::NXwritedata(const char *name, int datatype, int rank,
                               int *dims_array, void *data,
                               bool compress) const {
   if (compress) {
-    // We'll use the same slab/buffer size as the size of the array
+    // Long lists are split into chunks that can be compressed in parallel
+    std::vector<int> chunk(dims_array, dims_array + rank);
+    chunk[0] = std::max(1, std::min(chunk[0], EVENT_CHUNK_SIZE));
     NXcompmakedata(fileID, name, datatype, rank, dims_array, m_nexuscompression,
-                   dims_array);
+                   chunk.data());
+    if (m_nexuscompression == NX_COMP_LZW && chunk[0] < dims_array[0]) {
+      ParallelChunkWriter writer(m_filename,
+                                 m_filehandle->getPath() + "/" + name);
+      if (writer.isSupported()) {
+        writer.write(data);
+        return;
+      }
+    }
   } else {
     // Write uncompressed.
     NXmakedata(fileID, name, datatype, rank, dims_array);
@@ -0,0 +1,188 @@
+#include "MantidNexus/ParallelChunkWriter.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <hdf5.h>
+#include <hdf5_hl.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+namespace Mantid {
+namespace NeXus {
+
+namespace {
+/// The uncompressed size of the chunks compressed before writing them out
+constexpr size_t BATCH_BYTES = 64 * 1024 * 1024;
+
+/// Stops HDF5 printing errors while it is in scope
+class SilenceHDF5Errors {
+public:
+  SilenceHDF5Errors() {
+    H5Eget_auto2(H5E_DEFAULT, &m_function, &m_data);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+  }
+  ~SilenceHDF5Errors() { H5Eset_auto2(H5E_DEFAULT, m_function, m_data); }
+
+private:
+  H5E_auto2_t m_function = nullptr;
+  void *m_data = nullptr;
+};
+} // namespace
+
+/**
+ * Open a dataset for writing. If the dataset is not laid out as expected the
+ * writer is left unsupported and the caller should write the data itself.
+ * @param filename :: The HDF5 file
+ * @param path :: The full path of the dataset in the file
+ */
+ParallelChunkWriter::ParallelChunkWriter(const std::string &filename,
+                                         const std::string &path)
+    : m_path(path) {
+  SilenceHDF5Errors silence;
+  // The file is normally already open through the NeXus API. HDF5 requires
+  // every handle on a file to use the close degree of the first one.
+  for (auto degree : {H5F_CLOSE_STRONG, H5F_CLOSE_DEFAULT}) {
+    const hid_t access = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fclose_degree(access, degree);
+    m_file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, access);
+    H5Pclose(access);
+    if (m_file >= 0)
+      break;
+  }
+  if (m_file < 0)
+    return;
+  m_dataset = H5Dopen2(m_file, path.c_str(), H5P_DEFAULT);
+  if (m_dataset >= 0 && !readLayout()) {
+    H5Dclose(m_dataset);
+    m_dataset = -1;
+  }
+}
+
+/// Close the dataset and the file
+ParallelChunkWriter::~ParallelChunkWriter() {
+  if (m_dataset >= 0)
+    H5Dclose(m_dataset);
+  if (m_file >= 0)
+    H5Fclose(m_file);
+}
+
+/**
+ * Read the shape, chunking and compression of the dataset
+ * @return true if the chunks can be written directly
+ */
+bool ParallelChunkWriter::readLayout() {
+  const hid_t plist = H5Dget_create_plist(m_dataset);
+  const hid_t space = H5Dget_space(m_dataset);
+  const hid_t type = H5Dget_type(m_dataset);
+  bool supported = plist >= 0 && space >= 0 && type >= 0 &&
+                   H5Pget_layout(plist) == H5D_CHUNKED &&
+                   H5Pget_nfilters(plist) == 1;
+  if (supported) {
+    // Only plain deflate, as set by NXcompmakedata, is compressed here
+    unsigned int flags(0);
+    unsigned int values[1] = {0};
+    size_t nvalues(1);
+    unsigned int config(0);
+    supported = H5Pget_filter2(plist, 0, &flags, &nvalues, values, 0,
+                               nullptr, &config) == H5Z_FILTER_DEFLATE;
+    m_level = static_cast<int>(values[0]);
+  }
+  if (supported) {
+    m_rank = H5Sget_simple_extent_ndims(space);
+    std::vector<hsize_t> dims(std::max(m_rank, 1));
+    std::vector<hsize_t> chunk(dims.size());
+    H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+    supported = m_rank > 0 && H5Pget_chunk(plist, m_rank, chunk.data()) ==
+                                  m_rank;
+    m_rowBytes = H5Tget_size(type);
+    for (int i = 1; supported && i < m_rank; ++i) {
+      supported = chunk[i] == dims[i];
+      m_rowBytes *= static_cast<size_t>(dims[i]);
+    }
+    m_rows = static_cast<size_t>(dims[0]);
+    m_chunkRows = static_cast<size_t>(chunk[0]);
+    m_chunkBytes = m_chunkRows * m_rowBytes;
+    supported = supported && m_chunkBytes > 0;
+    if (supported)
+      m_numberOfChunks = (m_rows + m_chunkRows - 1) / m_chunkRows;
+  }
+  if (type >= 0)
+    H5Tclose(type);
+  if (space >= 0)
+    H5Sclose(space);
+  if (plist >= 0)
+    H5Pclose(plist);
+  return supported;
+}
+
+/**
+ * Compress all the chunks of the dataset and write them to the file.
+ * @param chunkData :: Returns the uncompressed data of a chunk given its
+ * index. It is called from several threads at once. The last chunk may extend
+ * past the end of the dataset and only its part inside the dataset is read.
+ * @throw std::runtime_error if a chunk cannot be compressed or written
+ */
+void ParallelChunkWriter::write(
+    const std::function<const void *(size_t)> &chunkData) {
+  if (!isSupported())
+    throw std::logic_error("The chunks of " + m_path +
+                           " cannot be written directly");
+  const size_t batchSize =
+      std::max(static_cast<size_t>(PARALLEL_GET_MAX_THREADS),
+               BATCH_BYTES / m_chunkBytes);
+  std::vector<std::vector<Bytef>> compressed(
+      std::min(batchSize, m_numberOfChunks));
+  std::vector<hsize_t> offset(m_rank, 0);
+
+  for (size_t first = 0; first < m_numberOfChunks; first += batchSize) {
+    const auto count =
+        static_cast<int64_t>(std::min(batchSize, m_numberOfChunks - first));
+    std::atomic<bool> failed{false};
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < count; ++i) {
+      const size_t chunk = first + i;
+      const auto *data = static_cast<const Bytef *>(chunkData(chunk));
+      // HDF5 expects the last chunk padded out to the full size
+      std::vector<Bytef> padded;
+      const size_t bytes =
+          std::min(m_chunkRows, m_rows - chunk * m_chunkRows) * m_rowBytes;
+      if (bytes < m_chunkBytes) {
+        padded.resize(m_chunkBytes, 0);
+        std::copy(data, data + bytes, padded.begin());
+        data = padded.data();
+      }
+      auto &buffer = compressed[i];
+      uLongf size = compressBound(static_cast<uLong>(m_chunkBytes));
+      buffer.resize(size);
+      if (compress2(buffer.data(), &size, data,
+                    static_cast<uLong>(m_chunkBytes), m_level) != Z_OK)
+        failed = true;
+      buffer.resize(size);
+    }
+    if (failed)
+      throw std::runtime_error("Unable to compress the data of " + m_path);
+
+    for (int64_t i = 0; i < count; ++i) {
+      offset[0] = static_cast<hsize_t>((first + i) * m_chunkRows);
+      if (H5DOwrite_chunk(m_dataset, H5P_DEFAULT, 0, offset.data(),
+                          compressed[i].size(), compressed[i].data()) < 0)
+        throw std::runtime_error("Unable to write the data of " + m_path);
+    }
+  }
+}
+
+/**
+ * Compress and write the data of the dataset from one contiguous array
+ * @param data :: The values of the whole dataset
+ */
+void ParallelChunkWriter::write(const void *data) {
+  const auto *bytes = static_cast<const char *>(data);
+  write([this, bytes](size_t chunk) {
+    return static_cast<const void *>(bytes + chunk * m_chunkBytes);
+  });
+}
+
+} // namespace NeXus
+} // namespace Mantid
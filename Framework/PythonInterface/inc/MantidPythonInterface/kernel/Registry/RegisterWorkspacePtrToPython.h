@@ -26,17 +26,72 @@
 #include "MantidPythonInterface/kernel/Registry/TypeRegistry.h"
 #include "MantidPythonInterface/kernel/WeakPtr.h"
 
+#include <boost/python/object/class_wrapper.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
 
 namespace Mantid {
 namespace PythonInterface {
 namespace Registry {
+/**
+ * Holds a weak pointer to a workspace for a Python object and counts itself
+ * as a weak handle of the workspace while it lives, so that the
+ * AnalysisDataService does not spill the workspace to disk and invalidate the
+ * Python variable. It holds a boost::weak_ptr<T> like the holder that
+ * register_ptr_to_python<boost::weak_ptr<T>> creates, so the weak pointer can
+ * still be extracted from the Python object.
+ */
+template <typename IType>
+class CountedWeakWorkspaceHolder
+    : public boost::python::objects::pointer_holder<boost::weak_ptr<IType>,
+                                                    IType> {
+public:
+  typedef boost::python::objects::pointer_holder<boost::weak_ptr<IType>, IType>
+      Base;
+
+  explicit CountedWeakWorkspaceHolder(boost::weak_ptr<IType> handle)
+      : Base(handle), m_handle(handle) {
+    if (const auto workspace = m_handle.lock())
+      workspace->addWeakHandle();
+  }
+  ~CountedWeakWorkspaceHolder() override {
+    // Nothing is counted any more once the workspace is gone
+    if (const auto workspace = m_handle.lock())
+      workspace->removeWeakHandle();
+  }
+
+private:
+  const boost::weak_ptr<IType> m_handle;
+};
+
+/**
+ * Converts a weak pointer to a workspace to Python as
+ * register_ptr_to_python<boost::weak_ptr<T>> would, but held by a
+ * CountedWeakWorkspaceHolder.
+ */
+template <typename IType>
+struct WeakWorkspacePtrToPython
+    : boost::python::to_python_converter<boost::weak_ptr<IType>,
+                                         WeakWorkspacePtrToPython<IType>,
+                                         true> {
+  typedef boost::python::objects::make_ptr_instance<
+      IType, CountedWeakWorkspaceHolder<IType>> MakeInstance;
+
+  static PyObject *convert(boost::weak_ptr<IType> handle) {
+    return MakeInstance::execute(handle);
+  }
+#ifndef BOOST_PYTHON_NO_PY_SIGNATURES
+  static PyTypeObject const *get_pytype() {
+    return MakeInstance::get_pytype();
+  }
+#endif
+};
+
 /**
  * Encapsulates the registration required for an interface type T
  * that sits on top of a Kernel::DataItem object. The constructor
  * does 3 things:
  *    - Calls register_ptr_to_python<boost::shared_ptr<T>>
- *    - Calls register_ptr_to_python<boost::weak_ptr<T>>
+ *    - Registers WeakWorkspacePtrToPython<T> for boost::weak_ptr<T>
  *    - Registers a new PropertyValueHandler for a boost::shared_ptr<T>
  */
 template <typename IType> struct DLLExport RegisterWorkspacePtrToPython {
@@ -48,7 +103,7 @@ template <typename IType> struct DLLExport RegisterWorkspacePtrToPython {
     using namespace Registry;
 
     register_ptr_to_python<IType_sptr>();
-    register_ptr_to_python<IType_wptr>();
+    WeakWorkspacePtrToPython<IType>();
     // properties can only ever store pointers to these
     TypeRegistry::subscribe<TypedPropertyValueHandler<IType_sptr>>();
   }
@@ -17,5 +17,25 @@ void export_AnalysisDataService() {
   pythonClass.def("Instance", &AnalysisDataService::Instance,
                   return_value_policy<reference_existing_object>(),
                   "Return a reference to the singleton instance")
-      .staticmethod("Instance");
+      .staticmethod("Instance")
+      .def("memoryUsage", &AnalysisDataServiceImpl::memoryUsage, arg("self"),
+           "Returns the memory used by the stored workspaces in bytes")
+      .def("memoryLimit", &AnalysisDataServiceImpl::memoryLimit, arg("self"),
+           "Returns the memory limit for the stored workspaces in bytes, 0 "
+           "if there is no limit")
+      .def("setMemoryLimit", &AnalysisDataServiceImpl::setMemoryLimit,
+           (arg("self"), arg("bytes")),
+           "Sets the memory limit for the stored workspaces in bytes, 0 for "
+           "no limit")
+      .def("spillDirectory", &AnalysisDataServiceImpl::spillDirectory,
+           arg("self"),
+           "Returns the directory that workspaces are spilled to above the "
+           "memory limit")
+      .def("setSpillDirectory", &AnalysisDataServiceImpl::setSpillDirectory,
+           (arg("self"), arg("directory")),
+           "Sets the directory that workspaces are spilled to above the "
+           "memory limit. An empty string disables spilling.")
+      .def("isSpilled", &AnalysisDataServiceImpl::isSpilled,
+           (arg("self"), arg("name")),
+           "Returns True if the named workspace is spilled to disk");
 }
@@ -6,12 +6,14 @@ from __future__ import (absolute_import, division,
                         print_function)
 
 from ._kernel import (ConfigServiceImpl, Logger, UnitFactoryImpl,
-                      UsageServiceImpl, PropertyManagerDataServiceImpl)
+                      UsageServiceImpl, TraceServiceImpl,
+                      PropertyManagerDataServiceImpl)
 
 ###############################################################################
 # Singletons - Make them just look like static classes
 ###############################################################################
 UsageService = UsageServiceImpl.Instance()
+TraceService = TraceServiceImpl.Instance()
 ConfigService = ConfigServiceImpl.Instance()
 config = ConfigService
 
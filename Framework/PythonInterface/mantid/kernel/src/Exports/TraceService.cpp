@@ -0,0 +1,41 @@
+#include "MantidPythonInterface/kernel/GetPointer.h"
+#include "MantidKernel/TraceService.h"
+#include <boost/python/class.hpp>
+#include <boost/python/reference_existing_object.hpp>
+
+using Mantid::Kernel::TraceService;
+using Mantid::Kernel::TraceServiceImpl;
+using namespace boost::python;
+
+GET_POINTER_SPECIALIZATION(TraceServiceImpl)
+
+void export_TraceService() {
+
+  class_<TraceServiceImpl, boost::noncopyable>("TraceServiceImpl", no_init)
+      .def("isEnabled", &TraceServiceImpl::isEnabled, arg("self"),
+           "Returns if the trace service is recording events.")
+
+      .def("setEnabled", &TraceServiceImpl::setEnabled,
+           (arg("self"), arg("enabled")),
+           "Starts or stops recording events.")
+
+      .def("size", &TraceServiceImpl::size, arg("self"),
+           "Returns the number of recorded events.")
+
+      .def("clear", &TraceServiceImpl::clear, arg("self"),
+           "Discards the recorded events.")
+
+      .def("toChromeTrace", &TraceServiceImpl::toChromeTrace, arg("self"),
+           "Returns the recorded events in the Chrome trace-event JSON "
+           "format.")
+
+      .def("saveChromeTrace", &TraceServiceImpl::saveChromeTrace,
+           (arg("self"), arg("filename")),
+           "Saves the recorded events in the Chrome trace-event JSON format. "
+           "The file can be viewed with chrome://tracing.")
+
+      .def("Instance", &TraceService::Instance,
+           return_value_policy<reference_existing_object>(),
+           "Returns a reference to the TraceService")
+      .staticmethod("Instance");
+}
@@ -1,5 +1,7 @@
 from __future__ import (absolute_import, division, print_function)
 
+import shutil
+import tempfile
 import unittest
 from testhelpers import run_algorithm
 from mantid.api import AnalysisDataService, AnalysisDataServiceImpl, MatrixWorkspace, Workspace
@@ -140,5 +142,41 @@ class AnalysisDataServiceTest(unittest.TestCase):
         for name in extra_names:
             mtd.remove(name)
 
+    def test_memory_limit(self):
+        self.assertEquals(AnalysisDataService.memoryLimit(), 0)
+        wsname = 'ADSTest_test_memory_limit'
+        self._run_createws(wsname)
+        self.assertTrue(AnalysisDataService.memoryUsage() > 0)
+        AnalysisDataService.setMemoryLimit(1000000000)
+        self.assertEquals(AnalysisDataService.memoryLimit(), 1000000000)
+        self.assertFalse(AnalysisDataService.isSpilled(wsname))
+        AnalysisDataService.setMemoryLimit(0)
+        AnalysisDataService.remove(wsname)
+
+    def test_workspaces_held_by_python_variables_are_not_spilled(self):
+        held = 'ADSTest_test_spill_held'
+        free = 'ADSTest_test_spill_free'
+        self._run_createws(held)
+        self._run_createws(free)
+        handle = mtd[held]
+        spill_dir = tempfile.mkdtemp()
+        try:
+            AnalysisDataService.setSpillDirectory(spill_dir)
+            AnalysisDataService.setMemoryLimit(1)
+            self.assertFalse(AnalysisDataService.isSpilled(held))
+            self.assertTrue(AnalysisDataService.isSpilled(free))
+            self.assertEquals(handle.readY(0)[1], 2.0)
+            self.assertEquals(mtd[free].readY(0)[1], 2.0)
+            # Once the variable is gone the workspace may be spilled
+            del handle
+            AnalysisDataService.setMemoryLimit(1)
+            self.assertTrue(AnalysisDataService.isSpilled(held))
+        finally:
+            AnalysisDataService.setMemoryLimit(0)
+            AnalysisDataService.setSpillDirectory('')
+            AnalysisDataService.remove(held)
+            AnalysisDataService.remove(free)
+            shutil.rmtree(spill_dir)
+
 if __name__ == '__main__':
     unittest.main()
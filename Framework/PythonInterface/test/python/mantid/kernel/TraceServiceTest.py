@@ -0,0 +1,33 @@
+from __future__ import (absolute_import, division, print_function)
+
+import json
+import unittest
+
+from mantid.kernel import (TraceService, TraceServiceImpl)
+
+class TraceServiceTest(unittest.TestCase):
+
+    def setUp(self):
+        self._was_enabled = TraceService.isEnabled()
+        TraceService.clear()
+
+    def tearDown(self):
+        TraceService.setEnabled(self._was_enabled)
+        TraceService.clear()
+
+    def test_singleton_returns_instance_of_TraceService(self):
+        self.assertTrue(isinstance(TraceService, TraceServiceImpl))
+
+    def test_getSetEnabled(self):
+        TraceService.setEnabled(True)
+        self.assertEquals(TraceService.isEnabled(), True)
+        TraceService.setEnabled(False)
+        self.assertEquals(TraceService.isEnabled(), False)
+
+    def test_empty_trace_is_valid_json(self):
+        self.assertEquals(TraceService.size(), 0)
+        trace = json.loads(TraceService.toChromeTrace())
+        self.assertEquals(trace["traceEvents"], [])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -52,7 +52,7 @@ MantidEVWorker::~MantidEVWorker() {}
  *          doesn't exist.
  */
 std::string MantidEVWorker::workspaceType(const std::string &ws_name) {
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
 
   if (!ADS.doesExist(ws_name))
     return std::string("");
@@ -277,7 +277,7 @@ bool MantidEVWorker::findPeaks(const std::string &ev_ws_name,
     alg->setProperty("MaxPeaks", (int64_t)num_to_find);
     alg->setProperty("DensityThresholdFactor", min_intensity);
     alg->setProperty("OutputWorkspace", peaks_ws_name);
-    const auto &ADS = AnalysisDataService::Instance();
+    auto &ADS = AnalysisDataService::Instance();
 
     if (alg->execute()) {
       Mantid::API::MatrixWorkspace_sptr mon_ws =
@@ -1000,7 +1000,7 @@ bool MantidEVWorker::showUB(const std::string &peaks_ws_name) {
     return false;
   }
 
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
   IPeaksWorkspace_sptr peaks_ws =
       ADS.retrieveWS<IPeaksWorkspace>(peaks_ws_name);
 
@@ -1077,7 +1077,7 @@ bool MantidEVWorker::getUB(const std::string &peaks_ws_name, bool lab_coords,
     return false;
   }
 
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
   IPeaksWorkspace_sptr peaks_ws =
       ADS.retrieveWS<IPeaksWorkspace>(peaks_ws_name);
 
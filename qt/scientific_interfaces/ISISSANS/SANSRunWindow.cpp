@@ -1669,7 +1669,7 @@ void SANSRunWindow::setGeometryDetails() {
   if (wsName.empty())
     return;
 
-  const auto &ADS = AnalysisDataService::Instance();
+  auto &ADS = AnalysisDataService::Instance();
 
   assert(ADS.doesExist(wsName));
   auto ws = ADS.retrieveWS<const Workspace>(wsName);